@@ -31,11 +31,19 @@
 /* Enable log module */
 #define LV_USE_LOG 1
 
-/* Memory settings */
+/* Memory settings: LVGL allocates from the size-class pools in LvglMemory
+ * (small objects) and the system heap (large buffers, PSRAM on the ESP32).
+ * LV_MEM_SIZE is only used by the built-in heap when LV_MEM_CUSTOM is 0. */
+#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM_INCLUDE "lvgl_memory.h"
+#define LV_MEM_CUSTOM_ALLOC lvgl_memory_alloc
+#define LV_MEM_CUSTOM_FREE lvgl_memory_free
+#define LV_MEM_CUSTOM_REALLOC lvgl_memory_realloc
 #define LV_MEM_SIZE (32U * 1024U)
 
-/* Enable if you want to see the memory usage in the lower right corner */
-#define LV_USE_MEM_MONITOR 1
+/* The memory monitor reads the built-in heap and shows zeros with LV_MEM_CUSTOM;
+ * LvglMemory reports pool usage per screen instead */
+#define LV_USE_MEM_MONITOR 0
 
 /* Enable if you want to see the FPS and CPU usage in the lower right corner */
 #define LV_USE_PERF_MONITOR 1
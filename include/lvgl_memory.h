@@ -0,0 +1,25 @@
+/**
+ * @file lvgl_memory.h
+ * @brief Allocator hooks for LVGL (LV_MEM_CUSTOM in lv_conf.h)
+ *
+ * LVGL is compiled as C, so only these functions are visible to it. They
+ * forward to LvglMemory (src/DisplayModule/lvgl/utils/LvglMemory.h).
+ */
+#ifndef LVGL_MEMORY_H
+#define LVGL_MEMORY_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void* lvgl_memory_alloc(size_t size);
+void lvgl_memory_free(void* ptr);
+void* lvgl_memory_realloc(void* ptr, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*LVGL_MEMORY_H*/
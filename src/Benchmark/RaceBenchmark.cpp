@@ -0,0 +1,315 @@
+/**
+ * @file RaceBenchmark.cpp
+ * @brief Native microbenchmarks for the race core (env:benchmark)
+ *
+ * Reports ns/op and allocations/op for the hot paths between a lap trigger
+ * and the screen. Allocations are counted through global operator new; LVGL
+ * objects come from the LvglMemory pools and are not included, but the pools'
+ * high-water marks are printed after the screen benchmarks. Console output of
+ * the measured code is discarded so terminal speed does not skew results.
+ *
+ * Run with: pio run -e benchmark -t exec (from the project directory, so the
+ * checked-in input trace under test/traces/ is found)
+ */
+#ifdef BENCHMARK
+
+#include <lvgl.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include "common/ArduinoCompat.h"
+#include "common/TimeManager.h"
+#include "common/TaskScheduler.h"
+#include "common/SnapshotBuffer.h"
+#include "common/TelemetryProtocol.h"
+#include "RaceModule/RaceModule.h"
+#include "DisplayModule/DisplayManager.h"
+#include "DisplayModule/lvgl/screens/RaceScreen.h"
+#include "DisplayModule/lvgl/utils/LvglMemory.h"
+#include "InputModule/InputManager.h"
+#include "InputModule/InputTrace.h"
+#include "InputModule/ReplayInput.h"
+#include "Sim/SimRaceController.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Allocation counting =====
+
+static size_t g_allocCount = 0;
+
+void* operator new(size_t size) {
+    g_allocCount++;
+    void* ptr = malloc(size ? size : 1);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+
+// ===== Harness =====
+
+// Deterministic clock so lap times and the lap filter behave the same every run
+static uint32_t g_clockMs = 0;
+
+static void advanceClock(uint32_t ms) {
+    g_clockMs += ms;
+    TimeManager::GetInstance().SetReplayTime(g_clockMs);
+}
+
+static void startRace(RaceMode mode, int numLaps, int raceTimeSeconds) {
+    RaceModule& race = RaceModule::getInstance();
+    race.resetRace();
+    race.prepareRace(mode, MAX_LANES, numLaps, raceTimeSeconds);
+    race.startCountdown();
+    race.startRace();
+}
+
+template <typename Body>
+static void runBenchmark(const char* name, uint32_t iterations, Body&& body) {
+    std::streambuf* console = std::cout.rdbuf(nullptr);
+
+    // Warm up caches and one-time allocations
+    for (uint32_t i = 0; i < iterations / 10 + 1; i++) {
+        body(i);
+    }
+
+    size_t allocsBefore = g_allocCount;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        body(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    size_t allocs = g_allocCount - allocsBefore;
+
+    std::cout.rdbuf(console);
+    std::cout.clear();
+
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    printf("%-36s %10u %12.1f ns/op %10.2f allocs/op\n",
+           name, iterations, ns / iterations, (double)allocs / iterations);
+}
+
+// ===== Offscreen LVGL display =====
+
+#define BENCH_HOR_RES 800
+#define BENCH_VER_RES 480
+#define BENCH_UI_LANES MAX_LANES
+
+// Recorded race replayed end to end through InputManager and SimRaceController
+#define BENCH_REPLAY_TRACE "test/traces/race_laps.itrc"
+
+static void benchFlush(lv_disp_drv_t* disp, const lv_area_t* /*area*/, lv_color_t* /*color_p*/) {
+    lv_disp_flush_ready(disp);
+}
+
+static void initOffscreenDisplay() {
+    static lv_disp_draw_buf_t drawBuf;
+    static lv_color_t buf[BENCH_HOR_RES * 40];
+    static lv_disp_drv_t dispDrv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&drawBuf, buf, nullptr, BENCH_HOR_RES * 40);
+    lv_disp_drv_init(&dispDrv);
+    dispDrv.hor_res = BENCH_HOR_RES;
+    dispDrv.ver_res = BENCH_VER_RES;
+    dispDrv.flush_cb = benchFlush;
+    dispDrv.draw_buf = &drawBuf;
+    lv_disp_drv_register(&dispDrv);
+}
+
+// ===== Benchmarks =====
+
+int main() {
+    std::streambuf* console = std::cout.rdbuf(nullptr);
+    DisplayManager::getInstance().initialize(nullptr, 0);
+    RaceModule& race = RaceModule::getInstance();
+    race.initialize();
+    initOffscreenDisplay();
+    advanceClock(1000);
+    std::cout.rdbuf(console);
+
+    printf("%-36s %10s %15s %20s\n", "Benchmark", "Iterations", "Time", "Allocations");
+
+    // Lap path: 8 lanes, each lane triggered every 1.6 s (above the minimum lap time)
+    startRace(RaceMode::TIMER, 0, 3600);
+    runBenchmark("RaceModule::registerLap", 100000, [&](uint32_t i) {
+        advanceClock(200);
+        race.registerLap((int)(i % MAX_LANES) + 1);
+    });
+
+    // Ranking: removing a lap re-ranks every lane, then the lap is put back; the
+    // clock steps past the glitch window so the trigger is accepted again
+    runBenchmark("RaceModule::removeLap+registerLap", 100000, [&](uint32_t i) {
+        int laneId = (int)(i % MAX_LANES) + 1;
+        advanceClock(DEFAULT_GLITCH_TIME + 10);
+        race.removeLap(laneId);
+        race.registerLap(laneId);
+    });
+
+    runBenchmark("RaceModule::createLaneSnapshot", 100000, [&](uint32_t) {
+        std::vector<RaceLaneData> snapshot = race.createLaneSnapshot();
+        (void)snapshot;
+    });
+
+    // Race core to display core handoff of one frame, as publishRaceData() and presentRaceData() do
+    SnapshotBuffer<RaceDataFrame> handoff;
+    const std::vector<RaceLaneData>& liveLanes = race.getAllLaneData();
+    runBenchmark("SnapshotBuffer publish+take", 100000, [&](uint32_t i) {
+        RaceDataFrame& frame = handoff.beginWrite();
+        frame.lanes.assign(liveLanes.begin(), liveLanes.end());
+        frame.publishedUs = i;
+        handoff.publish();
+        (void)handoff.takeLatest();
+    });
+
+    // The per-lane debug line of DisplayManager::updateRaceData, as an operator+ chain
+    const RaceLaneData& benchLane = race.getLaneData(1);
+    runBenchmark("String lane line (operator+)", 100000, [&](uint32_t) {
+        String laneInfo = "Lane " + String(benchLane.laneId) +
+                          " Lap: " + String(benchLane.currentLap) +
+                          "/" + String(benchLane.totalLaps) +
+                          " Last: " + String(benchLane.lastLapTime) + "ms" +
+                          " Best: " + String(benchLane.bestLapTime) + "ms" +
+                          " Total: " + String(benchLane.totalTime) + "ms";
+        (void)laneInfo;
+    });
+
+    // Every lane's times, as the race screens format them each tick
+    runBenchmark("formatTimeMMSSmmm x3 per lane", 100000, [&](uint32_t i) {
+        size_t length = 0;
+        for (int lane = 1; lane <= MAX_LANES; lane++) {
+            const RaceLaneData& data = race.getLaneData(lane);
+            length += formatTimeMMSSmmm(data.lastLapTime + i).length();
+            length += formatTimeMMSSmmm(data.bestLapTime).length();
+            length += formatTimeMMSS(data.totalTime + i).length();
+        }
+        (void)length;
+    });
+
+    runBenchmark("DisplayManager::formatRaceStatus", 20000, [&](uint32_t) {
+        RaceStatusText status = DisplayManager::getInstance().formatRaceStatus(race, false);
+        (void)status;
+    });
+
+    // The same state as a binary LaneState frame, and decoding it as a scoreboard would
+    TelemetryLaneState telemetryState = TelemetryLaneState();
+    telemetryState.laneCount = MAX_LANES;
+    for (int i = 0; i < MAX_LANES; i++) {
+        const RaceLaneData& lane = race.getLaneData(i + 1);
+        telemetryState.lanes[i] = {(uint8_t)lane.laneId, TELEMETRY_LANE_ENABLED, (uint8_t)lane.position,
+                                   (uint16_t)lane.currentLap, (uint16_t)lane.totalLaps,
+                                   lane.lastLapTime, lane.bestLapTime, lane.totalTime};
+    }
+    TelemetryEncoder telemetryEncoder;
+    uint8_t telemetryFrame[TELEMETRY_MAX_FRAME_BYTES];
+    size_t telemetryLength = 0;
+    runBenchmark("TelemetryEncoder::encodeLaneState", 100000, [&](uint32_t i) {
+        telemetryState.raceTimeMs = i;
+        telemetryLength = telemetryEncoder.encodeLaneState(telemetryState, telemetryFrame);
+    });
+
+    TelemetryDecoder telemetryDecoder;
+    runBenchmark("TelemetryDecoder::feed LaneState", 100000, [&](uint32_t) {
+        telemetryDecoder.feed(telemetryFrame, telemetryLength);
+    });
+
+    // Periodic refresh, as the race task runs it
+    startRace(RaceMode::LAPS, 100, 0);
+    runBenchmark("RaceModule::update", 20000, [&](uint32_t) {
+        advanceClock(RACE_UPDATE_INTERVAL_MS);
+        race.update();
+    });
+
+    // Main loop overhead: a pass over the race core's task set, one millisecond apart
+    TaskScheduler scheduler;
+    uint32_t taskRuns = 0;
+    scheduler.addPeriodicTask("input", TaskPriority::Input, INPUT_POLL_INTERVAL_MS, [&]() { taskRuns++; });
+    scheduler.addPeriodicTask("race", TaskPriority::Race, RACE_UPDATE_INTERVAL_MS, [&]() { taskRuns++; });
+    scheduler.addPeriodicTask("lights", TaskPriority::Race, LIGHTS_UPDATE_INTERVAL_MS, [&]() { taskRuns++; });
+    scheduler.addPeriodicTask("publish", TaskPriority::Display, DISPLAY_UPDATE_INTERVAL_MS, [&]() { taskRuns++; });
+    runBenchmark("TaskScheduler::runDue", 100000, [&](uint32_t i) {
+        scheduler.runDue(i);
+    });
+
+    // Screen path against the offscreen display
+    startRace(RaceMode::TIMER, 0, 3600);
+    for (uint32_t i = 0; i < MAX_LANES * 4; i++) {
+        advanceClock(200);
+        race.registerLap((int)(i % MAX_LANES) + 1);
+    }
+
+    LapsRaceUI lapsUI(BENCH_UI_LANES);
+    lapsUI.CreateUI(lv_scr_act());
+    RaceModeUI& raceUI = lapsUI;
+    std::vector<RaceLaneData> snapshot = race.createLaneSnapshot();
+    snapshot.resize(BENCH_UI_LANES);
+
+    runBenchmark("LapsRaceUI::UpdateRaceData", 2000, [&](uint32_t i) {
+        snapshot[i % snapshot.size()].totalTime += 10;
+        raceUI.UpdateRaceData(snapshot);
+    });
+
+    runBenchmark("LapsRaceUI::UpdateRaceData+render", 2000, [&](uint32_t i) {
+        snapshot[i % snapshot.size()].totalTime += 10;
+        raceUI.UpdateRaceData(snapshot);
+        lv_refr_now(nullptr);
+    });
+
+    // Screen rebuild: every object of the table is freed and created again
+    runBenchmark("LapsRaceUI::Cleanup+CreateUI", 500, [&](uint32_t) {
+        lapsUI.Cleanup();
+        lapsUI.CreateUI(lv_scr_act());
+    });
+    lapsUI.Cleanup();
+
+    // Lap times ticking in the TIMER rows, blitted from the digit atlas
+    TimerRaceUI timerUI(BENCH_UI_LANES);
+    timerUI.CreateUI(lv_scr_act());
+    RaceModeUI& timerRaceUI = timerUI;
+    runBenchmark("TimerRaceUI::UpdateRaceData+render", 2000, [&](uint32_t i) {
+        snapshot[i % snapshot.size()].lastLapTime += 10;
+        timerRaceUI.UpdateRaceData(snapshot);
+        lv_refr_now(nullptr);
+    });
+    timerUI.Cleanup();
+
+    LvglMemory& lvglMemory = LvglMemory::getInstance();
+    printf("%-36s %10u B high water, %u B heap, %u%% slack, %u failed\n", "LVGL memory",
+           (unsigned)lvglMemory.getHighWaterBytes(), (unsigned)lvglMemory.getLargeHighWaterBytes(),
+           (unsigned)lvglMemory.getSlackPercent(), (unsigned)lvglMemory.getFailedAllocations());
+    for (int i = 0; i < lvglMemory.getPoolCount(); i++) {
+        const LvglPoolStats& pool = lvglMemory.getPoolStats(i);
+        printf("  %3u B blocks %26u/%u high water, %u overflows\n", (unsigned)pool.blockSize,
+               (unsigned)pool.highWater, (unsigned)pool.blockCount, (unsigned)pool.overflows);
+    }
+
+    // Full input path: a recorded race replayed as fast as possible; every
+    // iteration starts a fresh race from the trace's own countdown command
+    InputTrace trace;
+    if (!trace.loadFromFile(BENCH_REPLAY_TRACE).isSuccess()) {
+        printf("%-36s skipped, cannot open %s\n", "ReplayInput race_laps trace", BENCH_REPLAY_TRACE);
+        return 0;
+    }
+    ReplayInput replay(trace);
+    InputManager::getInstance().initialize();
+    InputManager::getInstance().addInputModule(&replay);
+
+    runBenchmark("ReplayInput race_laps trace", 1000, [&](uint32_t) {
+        replay.start(ReplaySpeed::Maximum, 1);
+        while (replay.isRunning()) {
+            SimRaceController::getInstance().update();
+        }
+    });
+
+    return 0;
+}
+
+#endif // BENCHMARK
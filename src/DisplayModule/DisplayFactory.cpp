@@ -17,7 +17,8 @@ DisplayFactory* DisplayFactory::_instance = nullptr;
 
 DisplayFactory::DisplayFactory() 
     : _serialDisplay(nullptr)
-    , _lcdDisplay(nullptr){
+    , _lcdDisplay(nullptr)
+    , _webDisplay(nullptr) {
     DPRINTLN("DisplayFactory created");
 }
 
@@ -57,8 +58,10 @@ IBaseDisplay* DisplayFactory::createDisplay(DisplayType type) {
             return _lcdDisplay;
             
         case DisplayType::Web:
-            // Web display not implemented yet
-            return nullptr;
+            if (_webDisplay == nullptr) {
+                _webDisplay = new WebDisplay();
+            }
+            return _webDisplay;
             
         default:
             // Default to serial display
@@ -83,8 +86,7 @@ IBaseDisplay* DisplayFactory::getDisplay(DisplayType type) {
             return _lcdDisplay != nullptr ? _lcdDisplay : createDisplay(type);
             
         case DisplayType::Web:
-            // Web display not implemented yet
-            return nullptr;
+            return _webDisplay != nullptr ? _webDisplay : createDisplay(type);
             
         default:
             // Default to serial display
@@ -108,7 +110,7 @@ IGraphicalDisplay* DisplayFactory::getGraphicalDisplay(DisplayType type) {
             return _lcdDisplay != nullptr ? _lcdDisplay : createGraphicalDisplay(type);
             
         case DisplayType::Web:
-            // Web display not implemented yet
+            // Web display is not graphical
             return nullptr;
             
         case DisplayType::Serial:
@@ -128,6 +130,10 @@ void DisplayFactory::destroyInstance() {
             delete _instance->_lcdDisplay;
             _instance->_lcdDisplay = nullptr;
         }
+        if (_instance->_webDisplay) {
+            delete _instance->_webDisplay;
+            _instance->_webDisplay = nullptr;
+        }
         delete _instance;
         _instance = nullptr;
         DPRINTLN("DisplayFactory destroyed");
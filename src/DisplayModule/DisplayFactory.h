@@ -8,7 +8,7 @@
 #include "ESP32_8048S070_Lvgl_DisplayDriver.h"
 #endif
 #include "SerialDisplay.h"
-// #include "WebDisplay.h"
+#include "WebDisplay.h"
 
 /**
  * @brief Factory for creating display instances
@@ -71,5 +71,5 @@ private:
     // Pointers to managed display instances
     IBaseDisplay* _serialDisplay = nullptr;
     IGraphicalDisplay* _lcdDisplay = nullptr;
-    // IBaseDisplay* _webDisplay = nullptr;
+    WebDisplay* _webDisplay = nullptr;
 };
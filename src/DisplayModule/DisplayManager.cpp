@@ -3,8 +3,11 @@
 #include "Sim/TerminalSerial.h"
 #endif
 #include "DisplayFactory.h"
+#include "common/TimeManager.h"
+#include "common/CoreLoop.h"
 
 #ifdef SIMULATOR
+#include "drivers/SimulatorDisplayDriver/ThreadedDisplay.h"
 #include <iostream>
 #include <chrono>
 #include <ctime>
@@ -15,7 +18,8 @@
 
 // Throttle debug prints to once every 5 seconds
 #ifdef SIMULATOR
-static auto lastDebugPrint = std::chrono::steady_clock::now();
+// Per thread, since displays on render threads call into this file too
+static thread_local auto lastDebugPrint = std::chrono::steady_clock::now();
 const auto DEBUG_THROTTLE_MS = std::chrono::milliseconds(5000);
 
 // Helper macro for throttled debug prints in simulator
@@ -93,7 +97,7 @@ DisplayManager &DisplayManager::getInstance()
 }
 
 DisplayManager::DisplayManager()
-    : _activeDisplayCount(0), _currentScreen(ScreenType::Main), _initialized(false), _countdownDisplay("")
+    : _activeDisplayCount(0), _currentScreen(ScreenType::Main), _initialized(false)
 {
     DEBUG_PRINT_METHOD();
     // Initialize array to nullptrs
@@ -169,23 +173,16 @@ void DisplayManager::update()
         return;
     }
 
-    debug(String("Updating displays (count: ") + String(_activeDisplayCount) + ")");
-
-    // Update all active displays
+    // Update all active displays (runs every loop iteration, so no per-display logging)
     for (int i = 0; i < _activeDisplayCount; i++)
     {
         if (_activeDisplays[i] != nullptr)
         {
-            // Get display type safely
-            DisplayType type;
             {
-                // Use a scope to ensure type is only accessed if the pointer is valid
+                // Use a scope to ensure the display is only used if the pointer is valid
                 IBaseDisplay *display = _activeDisplays[i];
                 if (display)
                 {
-                    type = display->getDisplayType();
-                    debug(String("Updating display ") + String(i) +
-                          " (type: " + String(static_cast<int>(type)) + ")");
                     display->update();
                 }
                 else
@@ -204,6 +201,10 @@ void DisplayManager::update()
 void DisplayManager::setScreen(ScreenType screen)
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this, screen]() { setScreen(screen); }))
+    {
+        return;
+    }
     debug(String("DisplayManager::setScreen(") + String(static_cast<int>(screen)) + ")");
 
     // Skip if not initialized
@@ -362,6 +363,10 @@ void DisplayManager::setScreen(ScreenType screen)
 
 void DisplayManager::showMain()
 {
+    if (deferToDisplayCore([this]() { showMain(); }))
+    {
+        return;
+    }
 #ifdef SIMULATOR
     static TerminalSerial simSerial;
     simSerial.print("\n========== MAIN MENU ==========", true);
@@ -432,6 +437,10 @@ void DisplayManager::showMain()
 void DisplayManager::showRaceReady(RaceMode raceMode, int numLaps, int numLanes, uint32_t countdownInterval)
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this, raceMode, numLaps, numLanes, countdownInterval]() { showRaceReady(raceMode, numLaps, numLanes, countdownInterval); }))
+    {
+        return;
+    }
     // Skip if not initialized
     if (!_initialized)
     {
@@ -517,7 +526,7 @@ void DisplayManager::showRaceReady(RaceMode raceMode, int numLaps, int numLanes,
             break;
         }
         case DisplayType::Web:
-            // Handle Web display if needed
+            // The web page only shows race data
             break;
         }
     }
@@ -526,6 +535,10 @@ void DisplayManager::showRaceReady(RaceMode raceMode, int numLaps, int numLanes,
 void DisplayManager::showConfig()
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this]() { showConfig(); }))
+    {
+        return;
+    }
     // Skip if not initialized
     if (!_initialized)
     {
@@ -589,8 +602,7 @@ void DisplayManager::showConfig()
             break;
         }
         case DisplayType::Web:
-            Serial.println(F("DisplayManager::showConfig - Found Web display (not implemented)"));
-            // Handle Web display if needed
+            // The web page only shows race data
             break;
         default:
             Serial.print(F("DisplayManager::showConfig - Unknown display type: "));
@@ -603,6 +615,10 @@ void DisplayManager::showConfig()
 void DisplayManager::showRaceActive(RaceMode raceMode)
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this, raceMode]() { showRaceActive(raceMode); }))
+    {
+        return;
+    }
     // Skip if not initialized
     if (!_initialized)
     {
@@ -644,8 +660,7 @@ void DisplayManager::showRaceActive(RaceMode raceMode)
             break;
         }
         case DisplayType::Web:
-            debug("Found Web display (not implemented)", "DisplayManager");
-            // Handle Web display if needed
+            // The web page only shows race data
             break;
         default:
             warning("Unknown display type: " + String((int)type), "DisplayManager");
@@ -657,6 +672,10 @@ void DisplayManager::showRaceActive(RaceMode raceMode)
 void DisplayManager::showStats()
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this]() { showStats(); }))
+    {
+        return;
+    }
     // Skip if not initialized
     if (!_initialized)
     {
@@ -696,8 +715,7 @@ void DisplayManager::showStats()
             break;
         }
         case DisplayType::Web:
-            debug("Found Web display (not implemented)", "DisplayManager");
-            // Handle Web display if needed
+            // The web page only shows race data
             break;
         default:
             warning("Unknown display type: " + String((int)type), "DisplayManager");
@@ -706,6 +724,113 @@ void DisplayManager::showStats()
     }
 }
 
+void DisplayManager::markRaceDataDirty(bool urgent)
+{
+    _raceDataDirty = true;
+    _raceDataUrgent = _raceDataUrgent || urgent;
+}
+
+void DisplayManager::flushRaceData()
+{
+    if (publishRaceData())
+    {
+        presentRaceData();
+    }
+}
+
+bool DisplayManager::publishRaceData()
+{
+    if (!_initialized || !_raceDataDirty)
+    {
+        return false;
+    }
+
+    // Urgent data still waits out one LCD refresh, so a lap burst is one push
+    uint32_t now = TimeManager::GetInstance().GetCurrentTimeMs();
+    uint32_t interval = _raceDataUrgent ? DISPLAY_URGENT_MIN_INTERVAL_MS : _raceDataFrameIntervalMs;
+    if (_raceDataPushCount > 0 && now - _lastRaceDataPushMs < interval)
+    {
+        return false;
+    }
+
+    _raceDataDirty = false;
+    _raceDataUrgent = false;
+    _lastRaceDataPushMs = now;
+    _raceDataPushCount++;
+
+    // The display core may still be drawing an older frame; this slot is ours alone
+    RaceDataFrame &frame = _raceDataBuffer.beginWrite();
+    frame.lanes = RaceModule::getInstance().createLaneSnapshot();
+    frame.publishedUs = micros();
+    sendLaneTelemetry(frame.lanes);
+    _raceDataBuffer.publish();
+    return true;
+}
+
+bool DisplayManager::presentRaceData()
+{
+    const RaceDataFrame *frame = _raceDataBuffer.takeLatest();
+    if (frame == nullptr)
+    {
+        return false;
+    }
+
+    uint32_t latencyUs = micros() - frame->publishedUs;
+    if (latencyUs > _maxRaceDataLatencyUs)
+    {
+        _maxRaceDataLatencyUs = latencyUs;
+    }
+    updateRaceData(frame->lanes);
+    return true;
+}
+
+void DisplayManager::runDeferredCalls()
+{
+    std::deque<std::function<void()>> calls;
+    {
+        std::lock_guard<std::mutex> lock(_deferredMutex);
+        calls.swap(_deferredCalls);
+    }
+    for (const std::function<void()> &call : calls)
+    {
+        call();
+    }
+}
+
+bool DisplayManager::deferToDisplayCore(std::function<void()> call)
+{
+    CoreLoop *core = _displayCore;
+    if (core == nullptr || !core->isRunning() || core->isCurrentThread())
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_deferredMutex);
+        if (_deferredCalls.size() >= DISPLAY_DEFERRED_CALL_LIMIT)
+        {
+            _droppedDisplayCalls++;
+            return true;
+        }
+        _deferredCalls.push_back(call);
+    }
+    core->wake();
+    return true;
+}
+
+void DisplayManager::setRaceDataFrameRate(uint8_t framesPerSecond)
+{
+    if (framesPerSecond < 1)
+    {
+        framesPerSecond = 1;
+    }
+    if (framesPerSecond > 60)
+    {
+        framesPerSecond = 60;
+    }
+    _raceDataFrameIntervalMs = 1000 / framesPerSecond;
+}
+
 void DisplayManager::updateRaceData(const std::vector<RaceLaneData> &laneData)
 {
     DEBUG_PRINT_METHOD();
@@ -723,12 +848,22 @@ void DisplayManager::updateRaceData(const std::vector<RaceLaneData> &laneData)
     {
         if (lane.enabled)
         {
-            String laneInfo = "Lane " + String(lane.laneId) +
-                              " Lap: " + String(lane.currentLap) +
-                              "/" + String(lane.totalLaps) +
-                              " Last: " + String(lane.lastLapTime) + "ms" +
-                              " Best: " + String(lane.bestLapTime) + "ms" +
-                              " Total: " + String(lane.totalTime) + "ms";
+            // Built in one buffer: appending never reallocates
+            String laneInfo;
+            laneInfo.reserve(96);
+            laneInfo += "Lane ";
+            laneInfo += lane.laneId;
+            laneInfo += " Lap: ";
+            laneInfo += lane.currentLap;
+            laneInfo += "/";
+            laneInfo += lane.totalLaps;
+            laneInfo += " Last: ";
+            laneInfo += lane.lastLapTime;
+            laneInfo += "ms Best: ";
+            laneInfo += lane.bestLapTime;
+            laneInfo += "ms Total: ";
+            laneInfo += lane.totalTime;
+            laneInfo += "ms";
             debug(laneInfo, "DisplayManager");
         }
     }
@@ -759,26 +894,29 @@ void DisplayManager::updateRaceData(const std::vector<RaceLaneData> &laneData)
         case DisplayType::Serial:
         {
             debug("Found Serial display, showing race data summary", "DisplayManager");
-            // For Serial display, just show a summary of the race data
-            _activeDisplays[i]->print(F("\n--- Race Data Update ---\n"));
-
-            for (const auto &lane : laneData)
+#ifdef SIMULATOR
+            // On a render thread the summary is printed from the newest snapshot only
+            if (_threadedTextDisplays[i] != nullptr)
             {
-                if (lane.enabled)
-                {
-                    String laneInfo = "Lane " + String(lane.laneId) +
-                                      ", Pos: " + String(lane.position) +
-                                      ", Last: " + formatTimeMMSSmmm(lane.lastLapTime) +
-                                      ", Total: " + formatTimeMMSSmmm(lane.totalTime);
-                    _activeDisplays[i]->print(laneInfo);
-                }
+                _threadedTextDisplays[i]->updateRaceData(laneData);
+                break;
             }
+#endif
+            printRaceData(_activeDisplays[i], laneData);
             break;
         }
         case DisplayType::Web:
-            debug("Found Web display (not implemented)", "DisplayManager");
-            // Handle Web display if needed
+        {
+#ifdef SIMULATOR
+            if (_threadedTextDisplays[i] != nullptr)
+            {
+                _threadedTextDisplays[i]->updateRaceData(laneData);
+                break;
+            }
+#endif
+            static_cast<WebDisplay *>(_activeDisplays[i])->updateRaceData(laneData);
             break;
+        }
         default:
             warning("Unknown display type: " + String((int)type), "DisplayManager");
             break;
@@ -789,6 +927,10 @@ void DisplayManager::updateRaceData(const std::vector<RaceLaneData> &laneData)
 void DisplayManager::showCountdown(int currentStep, bool isComplete)
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this, currentStep, isComplete]() { showCountdown(currentStep, isComplete); }))
+    {
+        return;
+    }
     // Skip if not initialized
     if (!_initialized)
     {
@@ -796,10 +938,10 @@ void DisplayManager::showCountdown(int currentStep, bool isComplete)
     }
 
     // Format the countdown display
-    String countdownText = formatCountdown(currentStep, isComplete);
+    CountdownText countdownText = formatCountdown(currentStep, isComplete);
 
     // Debug the countdown step
-    debug("DisplayManager::showCountdown - Step: " + String(currentStep) + ", Text: " + countdownText, "DisplayManager");
+    debug("DisplayManager::showCountdown - Step: " + String(currentStep) + ", Text: " + countdownText.c_str(), "DisplayManager");
 
     // Display countdown on all active displays
     for (int i = 0; i < _activeDisplayCount; i++)
@@ -811,7 +953,7 @@ void DisplayManager::showCountdown(int currentStep, bool isComplete)
 
             // Print the countdown text with emphasis
             _activeDisplays[i]->print("\n==== COUNTDOWN ====");
-            _activeDisplays[i]->print(countdownText);
+            _activeDisplays[i]->print(countdownText.c_str());
             _activeDisplays[i]->print("==================\n");
         }
     }
@@ -820,6 +962,10 @@ void DisplayManager::showCountdown(int currentStep, bool isComplete)
 void DisplayManager::startLightSequence()
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this]() { startLightSequence(); }))
+    {
+        return;
+    }
     // Skip if not initialized
     if (!_initialized)
     {
@@ -844,20 +990,95 @@ void DisplayManager::startLightSequence()
     }
 }
 
-String DisplayManager::formatTimeMMSSmmm(uint32_t timeMs)
+void DisplayManager::printRaceData(IBaseDisplay *display, const std::vector<RaceLaneData> &laneData)
+{
+    // For Serial display, just show a summary of the race data
+    display->print(F("\n--- Race Data Update ---\n"));
+
+    for (const auto &lane : laneData)
+    {
+        if (lane.enabled)
+        {
+            FixedString<64> laneInfo("Lane ");
+            laneInfo.appendInt(lane.laneId);
+            laneInfo += ", Pos: ";
+            laneInfo.appendInt(lane.position);
+            laneInfo += ", Last: ";
+            laneInfo.appendTimeMMSSmmm(lane.lastLapTime);
+            laneInfo += ", Total: ";
+            laneInfo.appendTimeMMSSmmm(lane.totalTime);
+            display->print(laneInfo.c_str());
+        }
+    }
+}
+
+#ifdef SIMULATOR
+int DisplayManager::enableRenderThreads()
+{
+    DEBUG_PRINT_METHOD();
+    int threaded = 0;
+    for (int i = 0; i < _activeDisplayCount; i++)
+    {
+        if (_renderProxies[i])
+        {
+            threaded++;
+            continue;
+        }
+        if (_activeDisplays[i] == nullptr)
+        {
+            continue;
+        }
+
+        IBaseDisplay *display = _activeDisplays[i];
+        if (_activeDisplayTypes[i] == DisplayType::LCD)
+        {
+            _renderProxies[i].reset(new ThreadedGraphicalDisplay(static_cast<IGraphicalDisplay *>(display)));
+        }
+        else
+        {
+            _threadedTextDisplays[i] = new ThreadedBaseDisplay(display, [this](IBaseDisplay *target, const std::vector<RaceLaneData> &data)
+                                                               {
+                if (target->getDisplayType() == DisplayType::Web)
+                {
+                    static_cast<WebDisplay *>(target)->updateRaceData(data);
+                }
+                else
+                {
+                    printRaceData(target, data);
+                } });
+            _renderProxies[i].reset(_threadedTextDisplays[i]);
+        }
+        _directDisplays[i] = display;
+        _activeDisplays[i] = _renderProxies[i].get();
+        threaded++;
+    }
+
+    if (threaded > 0)
+    {
+        info("Running " + String(threaded) + " display(s) on render threads", "DisplayManager");
+    }
+    return threaded;
+}
+
+void DisplayManager::disableRenderThreads()
 {
     DEBUG_PRINT_METHOD();
-    uint32_t totalSeconds = timeMs / 1000;
-    uint32_t minutes = totalSeconds / 60;
-    uint32_t seconds = totalSeconds % 60;
-    uint32_t millis = timeMs % 1000;
-
-    char buffer[16]; // MM:SS:mmm\0
-    snprintf(buffer, sizeof(buffer), "%02lu:%02lu:%03lu", (unsigned long)minutes, (unsigned long)seconds, (unsigned long)millis);
-    return String(buffer);
+    for (int i = 0; i < 3; i++)
+    {
+        if (!_renderProxies[i])
+        {
+            continue;
+        }
+        // Destroying the proxy runs its queued calls and joins the thread
+        _activeDisplays[i] = _directDisplays[i];
+        _renderProxies[i].reset();
+        _threadedTextDisplays[i] = nullptr;
+        _directDisplays[i] = nullptr;
+    }
 }
+#endif
 
-String DisplayManager::formatCountdown(int currentStep, bool isComplete)
+CountdownText DisplayManager::formatCountdown(int currentStep, bool isComplete)
 {
     DEBUG_PRINT_METHOD();
     // Format the countdown display
@@ -865,20 +1086,17 @@ String DisplayManager::formatCountdown(int currentStep, bool isComplete)
     static const int countdownStart = 5; // Match the value in LightsModule
     if (currentStep == countdownStart)
     {
-        _countdownDisplay = "";
+        _countdownDisplay.clear();
     }
 
     if (currentStep > 0)
     {
         // First number or adding to sequence
-        if (_countdownDisplay.isEmpty())
-        {
-            _countdownDisplay = String(currentStep);
-        }
-        else
+        if (!_countdownDisplay.isEmpty())
         {
-            _countdownDisplay += "..." + String(currentStep);
+            _countdownDisplay += "...";
         }
+        _countdownDisplay.appendInt(currentStep);
     }
     else if (isComplete)
     {
@@ -886,8 +1104,8 @@ String DisplayManager::formatCountdown(int currentStep, bool isComplete)
         _countdownDisplay += "...GO!";
 
         // Reset for next countdown
-        String result = _countdownDisplay;
-        _countdownDisplay = "";
+        CountdownText result = _countdownDisplay;
+        _countdownDisplay.clear();
         return result;
     }
 
@@ -904,23 +1122,32 @@ void DisplayManager::showRaceStatus(const RaceModule &raceModule, bool isPaused)
     }
 
     // Format the race status
-    String raceStatus = formatRaceStatus(raceModule, isPaused);
+    RaceStatusText raceStatus = formatRaceStatus(raceModule, isPaused);
 
-    // Display race status on all active displays
+    // Formatted here, where the race data is; drawn on the display core
+    if (deferToDisplayCore([this, raceStatus]() { printToAll(raceStatus.c_str()); }))
+    {
+        return;
+    }
+    printToAll(raceStatus.c_str());
+}
+
+void DisplayManager::printToAll(const char *text)
+{
     for (int i = 0; i < _activeDisplayCount; i++)
     {
         if (_activeDisplays[i] != nullptr)
         {
             _activeDisplays[i]->clear();
-            _activeDisplays[i]->print(raceStatus);
+            _activeDisplays[i]->print(text);
         }
     }
 }
 
-String DisplayManager::formatRaceStatus(const RaceModule &raceModule, bool isPaused)
+RaceStatusText DisplayManager::formatRaceStatus(const RaceModule &raceModule, bool isPaused)
 {
     DEBUG_PRINT_METHOD();
-    String status = "";
+    RaceStatusText status;
 
     // Add race mode
     RaceMode mode = raceModule.getRaceMode();
@@ -962,8 +1189,13 @@ String DisplayManager::formatRaceStatus(const RaceModule &raceModule, bool isPau
         const RaceLaneData &lane = raceModule.getLaneData(i);
         if (lane.enabled)
         {
-            status += "Lane " + String(i) + ": ";
-            status += String(lane.currentLap) + "/" + String(lane.totalLaps) + " laps";
+            status += "Lane ";
+            status.appendInt(i);
+            status += ": ";
+            status.appendInt(lane.currentLap);
+            status += '/';
+            status.appendInt(lane.totalLaps);
+            status += " laps";
             if (lane.finished)
             {
                 status += " (FINISHED)";
@@ -978,6 +1210,10 @@ String DisplayManager::formatRaceStatus(const RaceModule &raceModule, bool isPau
 void DisplayManager::showMessage(const String &message)
 {
     DEBUG_PRINT_METHOD();
+    if (deferToDisplayCore([this, message]() { showMessage(message); }))
+    {
+        return;
+    }
     // Skip if not initialized
     if (!_initialized)
     {
@@ -1063,6 +1299,57 @@ void DisplayManager::raceLog(const String &message)
 #endif
 }
 
+void DisplayManager::sendLapTelemetry(int laneId)
+{
+    if (!_telemetrySink)
+    {
+        return;
+    }
+
+    const RaceLaneData &lane = RaceModule::getInstance().getLaneData(laneId);
+    TelemetryLap lap;
+    lap.laneId = (uint8_t)lane.laneId;
+    lap.lap = (uint16_t)lane.currentLap;
+    lap.lapTime = lane.lastLapTime;
+    lap.timestamp = lane.lastLapTimestamp;
+
+    uint8_t frame[TELEMETRY_MAX_FRAME_BYTES];
+    _telemetrySink(frame, _telemetryEncoder.encodeLap(lap, frame));
+}
+
+void DisplayManager::sendLaneTelemetry(const std::vector<RaceLaneData> &laneData)
+{
+    if (!_telemetrySink)
+    {
+        return;
+    }
+
+    const RaceModule &raceModule = RaceModule::getInstance();
+    TelemetryLaneState state;
+    state.raceTimeMs = raceModule.getRaceTimeMs();
+    state.raceState = (uint8_t)raceModule.getRaceState();
+    state.laneCount = 0;
+    for (const RaceLaneData &lane : laneData)
+    {
+        if (state.laneCount == TELEMETRY_MAX_LANES)
+        {
+            break;
+        }
+        TelemetryLane &out = state.lanes[state.laneCount++];
+        out.laneId = (uint8_t)lane.laneId;
+        out.flags = (lane.enabled ? TELEMETRY_LANE_ENABLED : 0) | (lane.finished ? TELEMETRY_LANE_FINISHED : 0);
+        out.position = (uint8_t)lane.position;
+        out.currentLap = (uint16_t)lane.currentLap;
+        out.totalLaps = (uint16_t)lane.totalLaps;
+        out.lastLapTime = lane.lastLapTime;
+        out.bestLapTime = lane.bestLapTime;
+        out.totalTime = lane.totalTime;
+    }
+
+    uint8_t frame[TELEMETRY_MAX_FRAME_BYTES];
+    _telemetrySink(frame, _telemetryEncoder.encodeLaneState(state, frame));
+}
+
 void DisplayManager::debug(const String &message, const String &moduleName)
 {
     DEBUG_PRINT_METHOD();
@@ -2,6 +2,7 @@
 
 #ifdef SIMULATOR
 #include <string>
+#include <memory>
 #else
 #include <Arduino.h>
 #endif
@@ -10,6 +11,33 @@
 #include "RaceModule/RaceModule.h"
 #include "DisplayModule/DisplayModule.h"
 #include "DisplayModule/DisplayFactory.h"
+#include "common/TelemetryProtocol.h"
+#include "common/FixedString.h"
+#include "common/SnapshotBuffer.h"
+#include <deque>
+#include <mutex>
+
+class CoreLoop;
+#ifdef SIMULATOR
+class ThreadedBaseDisplay;
+#endif
+
+// Receives each encoded telemetry frame (see common/TelemetryProtocol.h)
+using TelemetrySink = std::function<void(const uint8_t*, size_t)>;
+
+// Race status: a mode/state line and one line per lane, e.g. "Lane 8: 10/10 laps (FINISHED)"
+typedef FixedString<320> RaceStatusText;
+
+// Countdown sequence, e.g. "5...4...3...2...1...GO!"
+typedef FixedString<32> CountdownText;
+
+/**
+ * @brief Race data handed from the race core to the display core
+ */
+struct RaceDataFrame {
+    std::vector<RaceLaneData> lanes;    // Enabled lanes, as createLaneSnapshot() returns them
+    uint32_t publishedUs;               // micros() at publishing, for the handoff latency
+};
 
 /**
  * @brief Screen types for the display
@@ -134,6 +162,114 @@ public:
      */
     void updateRaceData(const std::vector<RaceLaneData>& laneData);
     
+    /**
+     * @brief Note that race data changed; the displays get it with the next frame
+     * 
+     * Notifications are coalesced: however many arrive, flushRaceData() takes one
+     * snapshot and pushes it once. Urgent notifications (laps) skip the wait for
+     * the next frame and go out on the next flush.
+     * 
+     * @param urgent true to push without waiting for the frame interval
+     */
+    void markRaceDataDirty(bool urgent = false);
+    
+    /**
+     * @brief Push pending race data to the displays if a frame is due
+     * 
+     * publishRaceData() followed by presentRaceData(), for a loop that runs
+     * race logic and displays on the same thread.
+     */
+    void flushRaceData();
+    
+    /**
+     * @brief Hand pending race data to the display core if a frame is due
+     * 
+     * Race core side of flushRaceData(): takes one createLaneSnapshot(),
+     * sends it as telemetry and publishes it through a lock-free buffer.
+     * Never waits for the display core.
+     * 
+     * @return true if a snapshot was published
+     */
+    bool publishRaceData();
+    
+    /**
+     * @brief Push the newest published race data to the displays
+     * 
+     * Display core side of flushRaceData(). Snapshots published since the
+     * last call are skipped; only the newest is drawn.
+     * 
+     * @return true if there was new race data
+     */
+    bool presentRaceData();
+    
+    /**
+     * @brief Set the rate at which non-urgent race data is pushed
+     * 
+     * @param framesPerSecond Frames per second (1-60)
+     */
+    void setRaceDataFrameRate(uint8_t framesPerSecond);
+    
+    /**
+     * @brief Get the number of race data pushes made so far
+     * 
+     * @return uint32_t Number of snapshots published by publishRaceData()
+     */
+    uint32_t getRaceDataPushCount() const { return _raceDataPushCount; }
+    
+    /**
+     * @brief Get the number of published snapshots drawn by presentRaceData()
+     */
+    uint32_t getRaceDataPresentCount() const { return _raceDataBuffer.getTakenCount(); }
+    
+    /**
+     * @brief Get the longest time from publishing a snapshot to drawing it
+     */
+    uint32_t getMaxRaceDataLatencyUs() const { return _maxRaceDataLatencyUs; }
+    
+    /**
+     * @brief Run display calls on a separate display core
+     * 
+     * While the core is running, display calls made on any other thread
+     * (screen changes, messages, the countdown) are queued and run by
+     * runDeferredCalls() on the display core, so the race core never draws
+     * and never waits for drawing. Set before the core starts; pass nullptr
+     * after it stopped, then call runDeferredCalls() once more.
+     * 
+     * @param core Loop that calls runDeferredCalls() and update(), or nullptr
+     */
+    void setDisplayCore(CoreLoop* core) { _displayCore = core; }
+    
+    /**
+     * @brief Run the display calls queued by other threads, oldest first
+     * 
+     * Call at the start of each display core pass.
+     */
+    void runDeferredCalls();
+    
+    /**
+     * @brief Get the number of display calls dropped because the queue was full
+     */
+    uint32_t getDroppedDisplayCalls() const { return _droppedDisplayCalls; }
+    
+#ifdef SIMULATOR
+    /**
+     * @brief Move each active display onto its own render thread
+     * 
+     * Every later call to a display is queued for its thread, and race data
+     * is handed over as a snapshot that replaces one not yet drawn, so a slow
+     * display neither holds up the race logic nor the other displays. Call
+     * after initialize(); displays added by a later initialize() stay direct.
+     * 
+     * @return int Number of displays running on render threads
+     */
+    int enableRenderThreads();
+    
+    /**
+     * @brief Finish queued drawing, stop the render threads and drive the displays directly again
+     */
+    void disableRenderThreads();
+#endif
+    
     /**
      * @brief Show the race status
      * 
@@ -215,14 +351,31 @@ public:
      */
     void raceLog(const String& message);
 
+    /**
+     * @brief Send binary race telemetry to a sink
+     * 
+     * Once set, every race data push by publishRaceData() is also sent as a
+     * LaneState frame, and sendLapTelemetry() sends Lap frames.
+     * 
+     * @param sink Receives each frame; an empty sink turns telemetry off
+     */
+    void setTelemetrySink(TelemetrySink sink) { _telemetrySink = sink; }
+
+    /**
+     * @brief Send a Lap telemetry frame for the lap just registered on a lane
+     * 
+     * @param laneId Lane identifier (1-based)
+     */
+    void sendLapTelemetry(int laneId);
+
     /**
      * @brief Format the race status display for logging
      * 
      * @param raceModule Reference to the race module
      * @param isPaused   Whether the race is paused
-     * @return String    Formatted race status for logs
+     * @return RaceStatusText Formatted race status for logs
      */
-    String formatRaceStatus(const RaceModule& raceModule, bool isPaused);
+    RaceStatusText formatRaceStatus(const RaceModule& raceModule, bool isPaused);
 
 private:
     /**
@@ -245,17 +398,40 @@ private:
      * 
      * @param currentStep The current countdown step
      * @param isComplete Whether the countdown is complete
-     * @return String The formatted countdown display
+     * @return CountdownText The formatted countdown display
      */
-    String formatCountdown(int currentStep, bool isComplete);
+    CountdownText formatCountdown(int currentStep, bool isComplete);
     
     /**
-     * @brief Format the time in MM:SS.mmm format
+     * @brief Print a race data summary to a text display
+     * 
+     * @param display Display to print to
+     * @param laneData Lane data to summarize
+     */
+    void printRaceData(IBaseDisplay* display, const std::vector<RaceLaneData>& laneData);
+
+    /**
+     * @brief Clear every active display and print text on it
+     * 
+     * @param text Text to print
+     */
+    void printToAll(const char* text);
+
+    /**
+     * @brief Send a LaneState telemetry frame if a sink is set
      * 
-     * @param timeMs The time in milliseconds
-     * @return String The formatted time
+     * @param laneData Lane data just pushed to the displays
      */
-    String formatTimeMMSSmmm(uint32_t timeMs);
+    void sendLaneTelemetry(const std::vector<RaceLaneData>& laneData);
+
+    /**
+     * @brief Queue a display call made off the display core
+     * 
+     * @param call Call to run on the display core
+     * @return false if the caller is on the display core, or there is none,
+     *         and should make the call itself
+     */
+    bool deferToDisplayCore(std::function<void()> call);
 
     // Static instance for singleton pattern
     static DisplayManager* _instance;
@@ -272,5 +448,33 @@ private:
     bool _initialized = false;
     
     // Countdown display state
-    String _countdownDisplay;
+    CountdownText _countdownDisplay;
+    
+    // Race data scheduling (see markRaceDataDirty())
+    bool _raceDataDirty = false;
+    bool _raceDataUrgent = false;
+    uint32_t _raceDataFrameIntervalMs = 1000 / DEFAULT_DISPLAY_FRAME_RATE;
+    uint32_t _lastRaceDataPushMs = 0;
+    uint32_t _raceDataPushCount = 0;
+    
+    // Race core to display core handoff (see publishRaceData())
+    SnapshotBuffer<RaceDataFrame> _raceDataBuffer;
+    uint32_t _maxRaceDataLatencyUs = 0;
+    
+    // Display calls from other threads (see setDisplayCore())
+    CoreLoop* _displayCore = nullptr;
+    std::mutex _deferredMutex;
+    std::deque<std::function<void()>> _deferredCalls;
+    uint32_t _droppedDisplayCalls = 0;
+    
+    // Binary telemetry (see setTelemetrySink())
+    TelemetryEncoder _telemetryEncoder;
+    TelemetrySink _telemetrySink;
+    
+#ifdef SIMULATOR
+    // Render thread proxies (see enableRenderThreads()); null for direct displays
+    std::unique_ptr<IBaseDisplay> _renderProxies[3];
+    ThreadedBaseDisplay* _threadedTextDisplays[3] = {};
+    IBaseDisplay* _directDisplays[3] = {};
+#endif
 };
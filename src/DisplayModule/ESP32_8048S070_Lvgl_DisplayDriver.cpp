@@ -4,6 +4,7 @@
 #include "../DisplayModule/lvgl/screens/RaceReadyScreen.h" // Relative path
 #include "../DisplayModule/lvgl/screens/PauseScreen.h" // Pause screen
 #include "../DisplayModule/lvgl/screens/StopScreen.h" // Stop screen
+#include "../DisplayModule/lvgl/utils/LvglMemory.h" // LVGL memory per screen
 #include "../common/Types.h"        // For RaceData, ErrorInfo etc.
 #include "../DisplayModule/DisplayManager.h" // For DisplayManager
 #include "../RaceDataStub.h" // For test mode
@@ -228,17 +229,8 @@ bool ESP32_8048S070_Lvgl_DisplayDriver::initialize() {
 
 void ESP32_8048S070_Lvgl_DisplayDriver::update() {
     DEBUG_PRINT_METHOD();
-    static uint32_t lastUpdate = 0;
-    const uint32_t updateInterval = 16;  // ~60fps (16.67ms)
-    
-    uint32_t now = millis();
-    if (now - lastUpdate >= updateInterval) {
-        lv_timer_handler();
-        lastUpdate = now;
-    }
-    
-    // Small delay to prevent 100% CPU usage
-    vTaskDelay(1);
+    // Paced by the display task (DISPLAY_UPDATE_INTERVAL_MS), which also does the sleeping
+    lv_timer_handler();
     
     // If we're using LV_TICK_CUSTOM=1, ensure TimeManager is updating LVGL ticks
     // This is handled by SystemController calling TimeManager::update()
@@ -445,15 +437,11 @@ void ESP32_8048S070_Lvgl_DisplayDriver::drawMain() {
     
     if (ui_MainMenuScreen) {
         DPRINTLN("Loading Main Menu screen...");
+        LvglMemory::getInstance().beginScreen("MainMenu");
         lv_scr_load(ui_MainMenuScreen);
         
-        // Force a full refresh of the display
-        lv_refr_now(NULL);
-        
-        // Process any pending LVGL tasks
-        lv_task_handler();
-        
-        DPRINTLN("Main Menu screen loaded and refreshed");
+        // Rendered by the next update() cycle
+        DPRINTLN("Main Menu screen loaded");
     } else {
         DPRINTLN("ERROR: Main Menu screen is null!");
     }
@@ -614,11 +602,7 @@ void ESP32_8048S070_Lvgl_DisplayDriver::drawRaceReady() {
         // Call Show() which will handle the screen loading
         race_ready_screen_->Show();
         
-        // Force an immediate update
-        DPRINTLN("Forcing screen refresh");
-        lv_refr_now(nullptr);
-        
-        DPRINTLN("Race ready screen shown and updated successfully");
+        DPRINTLN("Race ready screen shown successfully");
     } else {
         DPRINTLN("ERROR: RaceReadyScreen instance is null");
     }
@@ -633,13 +617,15 @@ void ESP32_8048S070_Lvgl_DisplayDriver::updateCountdownDisplay(int currentStep)
     }
     
     // Update the countdown text
-    lv_obj_t * countdown_label = lv_obj_get_child(ui_CountdownScreen, 0);
+    lv_obj_t * countdown_label = _countdownLabel.GetObj();
     if (countdown_label) {
         if (currentStep > 0) {
-            lv_label_set_text_fmt(countdown_label, "%d", currentStep);
+            char text[12];
+            snprintf(text, sizeof(text), "%d", currentStep);
+            _countdownLabel.SetText(text);
             lv_obj_set_style_text_color(countdown_label, lv_color_hex(0xFF0000), 0);
         } else {
-            lv_label_set_text(countdown_label, "GO!");
+            _countdownLabel.SetText("GO!");  // Not in the atlas; drawn as a regular label
             lv_obj_set_style_text_color(countdown_label, lv_color_hex(0x00FF00), 0);
         }
         lv_obj_center(countdown_label);
@@ -686,53 +672,10 @@ void ESP32_8048S070_Lvgl_DisplayDriver::drawRaceActive(RaceMode raceMode) {
     
     raceScreen.Show();
     
-    // In a proper architecture, we shouldn't be directly accessing RaceModule or RaceDataStub here
-    // The DisplayManager should be passing race data to us through updateRaceData()
-    // For testing purposes, we'll just set up the screen without any data
-    // The main.cpp will call DisplayManager.updateRaceData() with the stub data
-    
+    // Show() reset the mode UI to placeholders; lane data arrives through
+    // DisplayManager::updateRaceData() on the next race update
     DPRINTLN("Setting up RaceActive screen - waiting for data through updateRaceData()");
     
-    // For testing purposes, we'll always assume we're in the Active state
-    RaceState currentState = RaceState::Active;
-    DPRINTF("Current race state: %d\n", static_cast<int>(currentState));
-    
-  
-    // Initialize with empty race data - proper data will come through updateRaceData()
-    std::vector<RaceLaneData> currentRaceData;
-    DPRINTF("Initial race data size: %d\n", currentRaceData.size());
-    
-    // Log detailed lane data if available
-    if (!currentRaceData.empty()) {
-        DPRINTLN("Lane Data:");
-        for (const auto& lane : currentRaceData) {
-            DPRINTF("  Lane %d: %s, Laps: %d/%d, Enabled: %s, Finished: %s\n",
-                  lane.laneId,
-                  lane.racerName.c_str(),
-                  lane.currentLap,
-                  lane.totalLaps,
-                  lane.enabled ? "true" : "false",
-                  lane.finished ? "true" : "false");
-        }
-        
-        // Always update UI with current data
-        DPRINTF("Updating UI with %d lanes of race data\n", currentRaceData.size());
-        raceScreen.GetActiveRaceModeUI()->UpdateRaceData(currentRaceData);
-    } else {
-        DPRINTLN("No race data available - initializing with empty data");
-        // Initialize with empty data to show the UI structure
-        std::vector<RaceLaneData> emptyRaceData;
-        raceScreen.GetActiveRaceModeUI()->UpdateRaceData(emptyRaceData);
-        
-        // Commented out along with the race preparation code
-        /*
-        // If we just tried to prepare a race but still have no data, log an error
-        if (needsRacePrep) {
-            DPRINTLN("ERROR: Failed to prepare default race!");
-        }
-        */
-    }
-    
     raceScreen.Update();
 }
 
@@ -985,8 +928,8 @@ void ESP32_8048S070_Lvgl_DisplayDriver::createCountdownScreen() {
     lv_obj_set_style_bg_color(ui_CountdownScreen, lv_color_hex(0x000000), LV_PART_MAIN);
     
     // Add countdown label
-    lv_obj_t * countdown_label = lv_label_create(ui_CountdownScreen);
-    lv_label_set_text(countdown_label, "3");
+    lv_obj_t * countdown_label = _countdownLabel.Create(ui_CountdownScreen);
+    _countdownLabel.SetText("3");
     lv_obj_set_style_text_color(countdown_label, lv_color_hex(0xFF0000), 0);
     lv_obj_set_style_text_font(countdown_label, &lv_font_montserrat_48, 0);
     lv_obj_center(countdown_label);
@@ -1015,10 +958,6 @@ void ESP32_8048S070_Lvgl_DisplayDriver::drawStats() {
     // Show the stats screen
     _statsScreen->Show();
     
-    // Force an immediate update
-    lv_timer_handler();
-    update();
-    
     DPRINTLN("Stats screen shown");
 }
 
@@ -1042,10 +981,6 @@ void ESP32_8048S070_Lvgl_DisplayDriver::drawPause() {
     // Show the pause screen
     pauseScreen->Show();
     
-    // Force an immediate update
-    lv_timer_handler();
-    update();
-    
     DPRINTLN("Pause screen shown");
 }
 
@@ -1069,9 +1004,5 @@ void ESP32_8048S070_Lvgl_DisplayDriver::drawStop() {
     // Show the stop screen
     stopScreen->Show();
     
-    // Force an immediate update
-    lv_timer_handler();
-    update();
-    
     DPRINTLN("Stop screen shown");
 }
@@ -138,6 +138,7 @@ private:
     lv_obj_t* ui_RaceActiveScreen;   // Active race display screen
     ConfigScreen* config_screen_;    // Config screen implementation
     lv_obj_t* ui_CountdownScreen;    // Countdown overlay (part of RaceReady)
+    TimeLabel _countdownLabel;       // Countdown number, drawn from the digit atlas
     class RaceReadyScreen* race_ready_screen_; // RaceReadyScreen instance
 
     // Label for basic print/printf output (optional)
@@ -0,0 +1,374 @@
+#include "WebDisplay.h"
+#include <cstdarg>
+#include <cstdio>
+
+#ifdef SIMULATOR
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+#else
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <cerrno>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// Bytes moved per recv() / send() call
+#define WEB_IO_CHUNK_BYTES 512
+
+static const intptr_t NO_SOCKET = -1;
+
+// Page served at "/"; it opens a WebSocket back to the same host and applies the race messages
+static const char RACE_PAGE[] =
+    "<!DOCTYPE html><html><head><meta charset=\"utf-8\">"
+    "<meta name=\"viewport\" content=\"width=device-width,initial-scale=1\">"
+    "<title>Display4 Race</title><style>"
+    "body{font-family:sans-serif;margin:0;background:#111;color:#eee}"
+    "table{width:100%;border-collapse:collapse;font-size:1.2em}"
+    "th,td{padding:.4em;text-align:right;border-bottom:1px solid #333}"
+    "th:nth-child(2),td:nth-child(2){text-align:left}"
+    ".off{opacity:.4}#log{font-size:.8em;color:#888;padding:.4em}"
+    "</style></head><body>"
+    "<table><thead><tr><th>Pos</th><th>Racer</th><th>Lap</th><th>Last</th><th>Best</th><th>Total</th></tr></thead>"
+    "<tbody id=\"lanes\"></tbody></table><div id=\"log\"></div><script>"
+    "var lanes={};"
+    "function t(ms){if(!ms)return'-';var s=ms/1000,m=Math.floor(s/60);"
+    "return(m?m+':'+(s%60).toFixed(3).padStart(6,'0'):s.toFixed(3));}"
+    "function draw(){var b=document.getElementById('lanes'),r=Object.values(lanes);"
+    "r.sort(function(a,c){return(a.pos||99)-(c.pos||99)});b.innerHTML='';"
+    "r.forEach(function(l){var e=document.createElement('tr');if(!l.on)e.className='off';"
+    "[l.pos||'-',l.name||('Lane '+l.id),l.lap+'/'+l.laps,t(l.last),t(l.best),t(l.total)].forEach(function(v){"
+    "var d=document.createElement('td');d.textContent=v;e.appendChild(d)});b.appendChild(e)})}"
+    "function connect(){var w=new WebSocket('ws://'+location.host+'/ws');"
+    "w.onmessage=function(e){var m=JSON.parse(e.data);"
+    "if(m.type=='log'){document.getElementById('log').textContent=m.text;return}"
+    "if(m.type=='full')lanes={};"
+    "m.lanes.forEach(function(l){lanes[l.id]=Object.assign(lanes[l.id]||{},l)});draw()};"
+    "w.onclose=function(){setTimeout(connect,1000)}}"
+    "connect();</script></body></html>";
+
+static void closeSocket(intptr_t socketHandle) {
+#ifdef _WIN32
+    closesocket((SOCKET)socketHandle);
+#else
+    close((int)socketHandle);
+#endif
+}
+
+static bool setNonBlocking(intptr_t socketHandle) {
+#ifdef _WIN32
+    u_long mode = 1;
+    return ioctlsocket((SOCKET)socketHandle, FIONBIO, &mode) == 0;
+#else
+    int flags = fcntl((int)socketHandle, F_GETFL, 0);
+    return flags >= 0 && fcntl((int)socketHandle, F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+}
+
+// True if the last socket call failed only because it would have blocked
+static bool wouldBlock() {
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+}
+
+WebDisplay::Client::Client(intptr_t socket)
+    : socket(socket)
+    , webSocket(false)
+    , closeWhenSent(false)
+    , closed(false)
+    , queue(WEB_CLIENT_QUEUE_BYTES) {
+}
+
+WebDisplay::WebDisplay(uint16_t port)
+    : _port(port)
+    , _listenSocket(NO_SOCKET)
+    , _resyncCount(0)
+    , _initialized(false) {
+}
+
+WebDisplay::~WebDisplay() {
+    for (Client& client : _clients) {
+        closeClient(client);
+    }
+    if (_listenSocket != NO_SOCKET) {
+        closeSocket(_listenSocket);
+    }
+}
+
+bool WebDisplay::initialize() {
+    if (_initialized) {
+        return true;
+    }
+
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        return false;
+    }
+#endif
+#ifndef SIMULATOR
+    // Spectators join the timer's own network unless it is already on one
+    if (WiFi.status() != WL_CONNECTED) {
+        WiFi.softAP(WEB_DISPLAY_AP_SSID);
+    }
+#endif
+
+    intptr_t listenSocket = (intptr_t)socket(AF_INET, SOCK_STREAM, 0);
+    if (listenSocket == NO_SOCKET) {
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(_port);
+    if (bind(listenSocket, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(listenSocket, WEB_DISPLAY_MAX_CLIENTS) != 0 ||
+        !setNonBlocking(listenSocket)) {
+        closeSocket(listenSocket);
+        return false;
+    }
+
+    // Report the port actually bound when a free one was requested
+    socklen_t addressLength = sizeof(address);
+    if (getsockname(listenSocket, (struct sockaddr*)&address, &addressLength) == 0) {
+        _port = ntohs(address.sin_port);
+    }
+
+    _listenSocket = listenSocket;
+    _initialized = true;
+    return true;
+}
+
+void WebDisplay::update() {
+    if (!_initialized) {
+        return;
+    }
+
+    acceptClients();
+
+    for (Client& client : _clients) {
+        readClient(client);
+        if (!client.closed) {
+            if (client.webSocket) {
+                handleFrames(client);
+            } else {
+                handleRequest(client);
+            }
+        }
+        if (!client.closed) {
+            writeClient(client);
+        }
+    }
+
+    for (size_t i = 0; i < _clients.size();) {
+        if (_clients[i].closed) {
+            _clients.erase(_clients.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+void WebDisplay::clear() {
+    // Nothing to clear; browsers redraw from race data
+}
+
+void WebDisplay::print(const String& message, bool newLine) {
+    (void)newLine;
+    std::string payload;
+    WebRaceFeed::encodeLog(message.c_str(), payload);
+    for (Client& client : _clients) {
+        if (client.webSocket && !client.closed) {
+            queueFrame(client, WebSocketOpcode::Text, payload);
+        }
+    }
+}
+
+void WebDisplay::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    print(String(buffer));
+}
+
+DisplayType WebDisplay::getDisplayType() const {
+    return DisplayType::Web;
+}
+
+void WebDisplay::updateRaceData(const std::vector<RaceLaneData>& laneData) {
+    std::string payload;
+    if (!_feed.encodeUpdate(laneData, payload)) {
+        return;
+    }
+
+    // Encoded once; clients waiting for a resync get the full state instead
+    std::string frame;
+    WebSocketProtocol::appendFrame(frame, WebSocketOpcode::Text, payload.data(), payload.size());
+    for (Client& client : _clients) {
+        if (client.webSocket && !client.closed && !client.queue.needsResync()) {
+            client.queue.push(frame);
+        }
+    }
+}
+
+void WebDisplay::acceptClients() {
+    while (true) {
+        intptr_t clientSocket = (intptr_t)accept(_listenSocket, nullptr, nullptr);
+        if (clientSocket == NO_SOCKET) {
+            return;
+        }
+        if ((int)_clients.size() >= WEB_DISPLAY_MAX_CLIENTS || !setNonBlocking(clientSocket)) {
+            closeSocket(clientSocket);
+            continue;
+        }
+        _clients.push_back(Client(clientSocket));
+    }
+}
+
+void WebDisplay::readClient(Client& client) {
+    char buffer[WEB_IO_CHUNK_BYTES];
+    int received = recv(client.socket, buffer, sizeof(buffer), 0);
+    if (received > 0) {
+        client.received.append(buffer, received);
+    } else if (received == 0 || !wouldBlock()) {
+        closeClient(client);
+    }
+}
+
+void WebDisplay::handleRequest(Client& client) {
+    size_t headerEnd = client.received.find("\r\n\r\n");
+    if (headerEnd == std::string::npos) {
+        if (client.received.size() > WEB_REQUEST_MAX_BYTES) {
+            closeClient(client);
+        }
+        return;
+    }
+
+    std::string request = client.received.substr(0, headerEnd + 4);
+    client.received.erase(0, headerEnd + 4);
+
+    size_t pathStart = request.find(' ');
+    size_t pathEnd = pathStart == std::string::npos ? std::string::npos : request.find(' ', pathStart + 1);
+    std::string method = request.substr(0, pathStart);
+    std::string path = pathEnd == std::string::npos ? std::string() : request.substr(pathStart + 1, pathEnd - pathStart - 1);
+
+    std::string upgrade = WebSocketProtocol::headerValue(request, "Upgrade");
+    std::string key = WebSocketProtocol::headerValue(request, "Sec-WebSocket-Key");
+    bool wantsWebSocket = !key.empty() && (upgrade == "websocket" || upgrade == "WebSocket");
+
+    if (method == "GET" && wantsWebSocket) {
+        client.queue.push(WebSocketProtocol::handshakeResponse(key));
+        client.webSocket = true;
+
+        std::string payload;
+        _feed.encodeFull(payload);
+        queueFrame(client, WebSocketOpcode::Text, payload);
+        return;
+    }
+
+    std::string response;
+    if (method == "GET" && (path == "/" || path == "/index.html")) {
+        char header[160];
+        snprintf(header, sizeof(header),
+                 "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\n"
+                 "Content-Length: %u\r\nConnection: close\r\n\r\n",
+                 (unsigned)(sizeof(RACE_PAGE) - 1));
+        response = header;
+        response.append(RACE_PAGE, sizeof(RACE_PAGE) - 1);
+    } else {
+        response = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+    }
+    client.queue.push(response);
+    client.closeWhenSent = true;
+}
+
+void WebDisplay::handleFrames(Client& client) {
+    while (!client.closed && !client.closeWhenSent) {
+        WebSocketFrame frame;
+        int used = WebSocketProtocol::parseFrame(
+            reinterpret_cast<const uint8_t*>(client.received.data()), client.received.size(), frame);
+        if (used == 0) {
+            return;
+        }
+        if (used < 0) {
+            closeClient(client);
+            return;
+        }
+        client.received.erase(0, used);
+
+        switch (frame.opcode) {
+            case WebSocketOpcode::Close:
+                queueFrame(client, WebSocketOpcode::Close, frame.payload);
+                client.closeWhenSent = true;
+                break;
+            case WebSocketOpcode::Ping:
+                queueFrame(client, WebSocketOpcode::Pong, frame.payload);
+                break;
+            default:
+                // Browsers only listen; anything else they send is ignored
+                break;
+        }
+    }
+}
+
+void WebDisplay::writeClient(Client& client) {
+    // A client that fell behind continues from the current state
+    if (client.queue.needsResync() && client.queue.empty()) {
+        std::string payload;
+        _feed.encodeFull(payload);
+        client.queue.clearResync();
+        queueFrame(client, WebSocketOpcode::Text, payload);
+        _resyncCount++;
+    }
+
+    size_t length;
+    const char* data = client.queue.front(length);
+    while (length > 0) {
+        size_t chunk = length < WEB_IO_CHUNK_BYTES ? length : WEB_IO_CHUNK_BYTES;
+        int sent = send(client.socket, data, chunk, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            if (sent < 0 && !wouldBlock()) {
+                closeClient(client);
+            }
+            return;
+        }
+        client.queue.consume(sent);
+        data = client.queue.front(length);
+    }
+
+    if (client.closeWhenSent) {
+        closeClient(client);
+    }
+}
+
+void WebDisplay::queueFrame(Client& client, WebSocketOpcode opcode, const std::string& payload) {
+    std::string frame;
+    WebSocketProtocol::appendFrame(frame, opcode, payload.data(), payload.size());
+    client.queue.push(frame);
+}
+
+void WebDisplay::closeClient(Client& client) {
+    if (!client.closed) {
+        closeSocket(client.socket);
+        client.closed = true;
+    }
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "DisplayModule.h"
+#include "WebRaceFeed.h"
+#include "WebSocketProtocol.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Port the web display listens on (0 picks a free port)
+#ifdef SIMULATOR
+#define WEB_DISPLAY_PORT 8080
+#else
+#define WEB_DISPLAY_PORT 80
+#endif
+
+// Browsers served at once; further connections are closed straight away
+#define WEB_DISPLAY_MAX_CLIENTS 4
+
+// Unsent bytes per client before it is resynced with a full message
+#define WEB_CLIENT_QUEUE_BYTES 8192
+
+// Longest HTTP request header accepted
+#define WEB_REQUEST_MAX_BYTES 2048
+
+// Wi-Fi access point started on the ESP32 when no network is connected
+#define WEB_DISPLAY_AP_SSID "Display4"
+
+/**
+ * @brief Web display implementation
+ *
+ * Serves a race page over HTTP and live race data over a WebSocket, so
+ * spectators can follow a race in a browser. The server is non-blocking and
+ * does all its work in update(): accepting connections, reading requests and
+ * writing as much of each client's send queue as the socket takes.
+ *
+ * Race data is delta-encoded by a WebRaceFeed: each updateRaceData() encodes
+ * the changed fields once and queues that message for every client. A client
+ * that cannot keep up overflows its WebSendQueue, which drops its waiting
+ * deltas and sends it a single full message once it has caught up.
+ */
+class WebDisplay : public IBaseDisplay {
+public:
+    /**
+     * @brief Construct a new Web Display object
+     *
+     * @param port TCP port to listen on (0 picks a free port)
+     */
+    explicit WebDisplay(uint16_t port = WEB_DISPLAY_PORT);
+
+    /**
+     * @brief Destroy the Web Display object, closing all connections
+     */
+    ~WebDisplay() override;
+
+    /**
+     * @brief Start listening
+     *
+     * On the ESP32 a Wi-Fi access point is started first if the station
+     * is not connected.
+     *
+     * @return true if the server socket is listening
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Serve connections; call regularly from the main loop
+     *
+     * Never blocks. Accepts new connections, handles requests and control
+     * frames, and sends pending data.
+     */
+    void update() override;
+
+    /**
+     * @brief No-op; the page is redrawn from race data
+     */
+    void clear() override;
+
+    /**
+     * @brief Send a log line to connected browsers
+     *
+     * @param message The message to send
+     * @param newLine Ignored; each message is one line
+     */
+    void print(const String& message, bool newLine = true) override;
+
+    /**
+     * @brief Send a formatted log line to connected browsers
+     *
+     * @param format The format string
+     * @param ... The format arguments
+     */
+    void printf(const char* format, ...) override;
+
+    /**
+     * @brief Get the display type
+     *
+     * @return DisplayType Always DisplayType::Web
+     */
+    DisplayType getDisplayType() const override;
+
+    /**
+     * @brief Queue the changes in race data for every connected browser
+     *
+     * @param laneData Current lane data
+     */
+    void updateRaceData(const std::vector<RaceLaneData>& laneData);
+
+    /**
+     * @brief Set the port to listen on; takes effect at the next initialize()
+     *
+     * @param port TCP port (0 picks a free port)
+     */
+    void setPort(uint16_t port) { _port = port; }
+
+    /**
+     * @brief Get the port the server listens on
+     *
+     * @return uint16_t Bound port once initialized, otherwise the configured one
+     */
+    uint16_t getPort() const { return _port; }
+
+    int getClientCount() const { return (int)_clients.size(); }
+    uint32_t getResyncCount() const { return _resyncCount; }
+
+private:
+    /**
+     * @brief One browser connection
+     */
+    struct Client {
+        intptr_t socket;
+        bool webSocket;         // Upgraded; receives race data
+        bool closeWhenSent;     // Close once the queue is empty (plain HTTP)
+        bool closed;
+        std::string received;   // Request or frame bytes not yet handled
+        WebSendQueue queue;
+
+        explicit Client(intptr_t socket);
+    };
+
+    void acceptClients();
+    void readClient(Client& client);
+    void handleRequest(Client& client);
+    void handleFrames(Client& client);
+    void writeClient(Client& client);
+    void queueFrame(Client& client, WebSocketOpcode opcode, const std::string& payload);
+    void closeClient(Client& client);
+
+    uint16_t _port;
+    intptr_t _listenSocket;
+    std::vector<Client> _clients;
+    WebRaceFeed _feed;
+    uint32_t _resyncCount;
+    bool _initialized;
+};
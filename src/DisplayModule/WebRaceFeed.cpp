@@ -0,0 +1,185 @@
+#include "WebRaceFeed.h"
+#include <cstdio>
+
+// ===== WebRaceFeed =====
+
+WebRaceFeed::WebRaceFeed()
+    : _hasState(false) {
+}
+
+bool WebRaceFeed::encodeUpdate(const std::vector<RaceLaneData>& laneData, std::string& message) {
+    // Lanes added or removed: the clients start over from a full message
+    if (!_hasState || laneData.size() != _lanes.size()) {
+        _lanes = laneData;
+        _hasState = true;
+        encodeFull(message);
+        return true;
+    }
+
+    message = "{\"type\":\"delta\",\"lanes\":[";
+    size_t emptyLength = message.size();
+    for (size_t i = 0; i < laneData.size(); i++) {
+        size_t before = message.size();
+        if (before > emptyLength) {
+            message += ',';
+        }
+        size_t laneStart = message.size();
+        appendLane(message, laneData[i], &_lanes[i]);
+        if (message.size() == laneStart) {
+            message.resize(before);
+        }
+    }
+
+    if (message.size() == emptyLength) {
+        return false;
+    }
+    message += "]}";
+    _lanes = laneData;
+    return true;
+}
+
+void WebRaceFeed::encodeFull(std::string& message) const {
+    message = "{\"type\":\"full\",\"lanes\":[";
+    for (size_t i = 0; i < _lanes.size(); i++) {
+        if (i > 0) {
+            message += ',';
+        }
+        appendLane(message, _lanes[i], nullptr);
+    }
+    message += "]}";
+}
+
+void WebRaceFeed::encodeLog(const char* text, std::string& message) {
+    message = "{\"type\":\"log\",\"text\":";
+    appendString(message, text);
+    message += '}';
+}
+
+void WebRaceFeed::reset() {
+    _lanes.clear();
+    _hasState = false;
+}
+
+// Appends the lane's fields that differ from previous (all of them without one), or nothing
+void WebRaceFeed::appendLane(std::string& out, const RaceLaneData& lane, const RaceLaneData* previous) {
+    size_t start = out.size();
+    char number[16];
+
+    out += "{\"id\":";
+    snprintf(number, sizeof(number), "%d", lane.laneId);
+    out += number;
+    size_t idEnd = out.size();
+
+    if (!previous || lane.racerName != previous->racerName) {
+        out += ",\"name\":";
+        appendString(out, lane.racerName.c_str());
+    }
+    if (!previous || lane.enabled != previous->enabled) {
+        out += lane.enabled ? ",\"on\":true" : ",\"on\":false";
+    }
+    if (!previous || lane.finished != previous->finished) {
+        out += lane.finished ? ",\"fin\":true" : ",\"fin\":false";
+    }
+
+    struct Field {
+        const char* name;
+        long value;
+        long previousValue;
+    };
+    const Field fields[] = {
+        {"lap", lane.currentLap, previous ? previous->currentLap : 0},
+        {"laps", lane.totalLaps, previous ? previous->totalLaps : 0},
+        {"pos", lane.position, previous ? previous->position : 0},
+        {"last", (long)lane.lastLapTime, previous ? (long)previous->lastLapTime : 0},
+        {"best", (long)lane.bestLapTime, previous ? (long)previous->bestLapTime : 0},
+        {"total", (long)lane.totalTime, previous ? (long)previous->totalTime : 0},
+    };
+    for (const Field& field : fields) {
+        if (!previous || field.value != field.previousValue) {
+            snprintf(number, sizeof(number), "%ld", field.value);
+            out += ",\"";
+            out += field.name;
+            out += "\":";
+            out += number;
+        }
+    }
+
+    if (previous && out.size() == idEnd) {
+        out.resize(start);
+        return;
+    }
+    out += '}';
+}
+
+void WebRaceFeed::appendString(std::string& out, const char* text) {
+    out += '"';
+    for (const char* p = text; *p; p++) {
+        char c = *p;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+// ===== WebSendQueue =====
+
+WebSendQueue::WebSendQueue(size_t limitBytes)
+    : _frontOffset(0)
+    , _queuedBytes(0)
+    , _limitBytes(limitBytes)
+    , _needsResync(false)
+    , _droppedFrames(0) {
+}
+
+bool WebSendQueue::push(const std::string& data) {
+    // An empty queue takes any frame, so a full message bigger than the limit still goes out
+    if (!_frames.empty() && _queuedBytes + data.size() > _limitBytes) {
+        // Keep a frame that is partly on the wire, drop everything behind it
+        size_t keep = _frontOffset > 0 ? 1 : 0;
+        while (_frames.size() > keep) {
+            _queuedBytes -= _frames.back().size();
+            _frames.pop_back();
+            _droppedFrames++;
+        }
+        _droppedFrames++;
+        _needsResync = true;
+        return false;
+    }
+
+    _frames.push_back(data);
+    _queuedBytes += data.size();
+    return true;
+}
+
+const char* WebSendQueue::front(size_t& length) const {
+    if (_frames.empty()) {
+        length = 0;
+        return nullptr;
+    }
+    length = _frames.front().size() - _frontOffset;
+    return _frames.front().data() + _frontOffset;
+}
+
+void WebSendQueue::consume(size_t length) {
+    while (length > 0 && !_frames.empty()) {
+        size_t remaining = _frames.front().size() - _frontOffset;
+        size_t used = length < remaining ? length : remaining;
+        _frontOffset += used;
+        _queuedBytes -= used;
+        length -= used;
+        if (_frontOffset == _frames.front().size()) {
+            _frames.pop_front();
+            _frontOffset = 0;
+        }
+    }
+}
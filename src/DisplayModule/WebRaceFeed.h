@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include "RaceModule/RaceModule.h"
+
+/**
+ * @brief Turns race data snapshots into JSON messages for web clients
+ *
+ * The first snapshot, and any snapshot with a different lane count, is sent
+ * as a full message. After that only the fields that changed are sent:
+ *
+ *   {"type":"full","lanes":[{"id":1,"name":"","lap":0,...},...]}
+ *   {"type":"delta","lanes":[{"id":2,"lap":3,"last":4211,"total":12876}]}
+ *
+ * Lanes are keyed by "id". Every client that has applied the full message
+ * and the deltas since stays in step, so a delta is encoded once and shared.
+ */
+class WebRaceFeed {
+public:
+    WebRaceFeed();
+
+    /**
+     * @brief Encode the changes since the previous snapshot
+     *
+     * @param laneData New snapshot
+     * @param message Receives the delta, or a full message when the lanes changed
+     * @return true if there was anything to send
+     */
+    bool encodeUpdate(const std::vector<RaceLaneData>& laneData, std::string& message);
+
+    /**
+     * @brief Encode the whole current state, for clients that are joining or catching up
+     *
+     * @param message Receives the full message
+     */
+    void encodeFull(std::string& message) const;
+
+    /**
+     * @brief Encode a log line
+     *
+     * @param text Line to show
+     * @param message Receives the message
+     */
+    static void encodeLog(const char* text, std::string& message);
+
+    /**
+     * @brief Forget the current state, so the next update is a full message
+     */
+    void reset();
+
+private:
+    static void appendLane(std::string& out, const RaceLaneData& lane, const RaceLaneData* previous);
+    static void appendString(std::string& out, const char* text);
+
+    std::vector<RaceLaneData> _lanes;   // State the clients have
+    bool _hasState;
+};
+
+/**
+ * @brief Outgoing messages for one web client, with a byte limit
+ *
+ * When a message does not fit, the messages still waiting are dropped (a
+ * message already partly sent is kept, so the stream stays valid) and the
+ * queue is marked for a resync: the owner stops queuing deltas and sends
+ * one full message once the queue has drained. A slow client therefore
+ * costs a bounded amount of memory and jumps to the current state.
+ */
+class WebSendQueue {
+public:
+    /**
+     * @param limitBytes Most bytes the queue holds
+     */
+    explicit WebSendQueue(size_t limitBytes);
+
+    /**
+     * @brief Queue bytes to send
+     *
+     * @param data Encoded frame
+     * @return false if the limit was hit and waiting frames were dropped
+     */
+    bool push(const std::string& data);
+
+    /**
+     * @brief Bytes waiting at the front of the queue
+     *
+     * @param length Receives the number of bytes, 0 if the queue is empty
+     * @return const char* Bytes to send next
+     */
+    const char* front(size_t& length) const;
+
+    /**
+     * @brief Remove bytes that were sent
+     *
+     * @param length Number of bytes sent from front()
+     */
+    void consume(size_t length);
+
+    bool empty() const { return _frames.empty(); }
+    size_t getQueuedBytes() const { return _queuedBytes; }
+    bool needsResync() const { return _needsResync; }
+    void clearResync() { _needsResync = false; }
+    uint32_t getDroppedFrames() const { return _droppedFrames; }
+
+private:
+    std::deque<std::string> _frames;
+    size_t _frontOffset;        // Bytes of the front frame already sent
+    size_t _queuedBytes;        // Unsent bytes
+    size_t _limitBytes;
+    bool _needsResync;
+    uint32_t _droppedFrames;
+};
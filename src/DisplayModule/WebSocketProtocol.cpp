@@ -0,0 +1,215 @@
+#include "WebSocketProtocol.h"
+#include <cctype>
+#include <cstring>
+
+// Appended to the client key before hashing (RFC 6455, section 1.3)
+static const char WEBSOCKET_GUID[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// Client frames larger than this are refused; clients only send control frames
+#define WEBSOCKET_MAX_CLIENT_PAYLOAD 1024
+
+std::string WebSocketProtocol::acceptKey(const std::string& clientKey) {
+    std::string input = clientKey;
+    input += WEBSOCKET_GUID;
+
+    uint8_t digest[20];
+    sha1(reinterpret_cast<const uint8_t*>(input.data()), input.size(), digest);
+    return base64(digest, sizeof(digest));
+}
+
+std::string WebSocketProtocol::handshakeResponse(const std::string& clientKey) {
+    std::string response =
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: ";
+    response += acceptKey(clientKey);
+    response += "\r\n\r\n";
+    return response;
+}
+
+void WebSocketProtocol::appendFrame(std::string& out, WebSocketOpcode opcode, const char* payload, size_t length) {
+    out.push_back(static_cast<char>(0x80 | static_cast<uint8_t>(opcode)));
+    if (length < 126) {
+        out.push_back(static_cast<char>(length));
+    } else if (length <= 0xFFFF) {
+        out.push_back(static_cast<char>(126));
+        out.push_back(static_cast<char>((length >> 8) & 0xFF));
+        out.push_back(static_cast<char>(length & 0xFF));
+    } else {
+        out.push_back(static_cast<char>(127));
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>((static_cast<uint64_t>(length) >> shift) & 0xFF));
+        }
+    }
+    out.append(payload, length);
+}
+
+int WebSocketProtocol::parseFrame(const uint8_t* data, size_t length, WebSocketFrame& frame) {
+    if (length < 2) {
+        return 0;
+    }
+
+    bool masked = (data[1] & 0x80) != 0;
+    uint64_t payloadLength = data[1] & 0x7F;
+    size_t offset = 2;
+
+    // Clients must mask every frame
+    if (!masked) {
+        return -1;
+    }
+
+    if (payloadLength == 126) {
+        if (length < offset + 2) {
+            return 0;
+        }
+        payloadLength = (static_cast<uint64_t>(data[2]) << 8) | data[3];
+        offset += 2;
+    } else if (payloadLength == 127) {
+        if (length < offset + 8) {
+            return 0;
+        }
+        payloadLength = 0;
+        for (int i = 0; i < 8; i++) {
+            payloadLength = (payloadLength << 8) | data[offset + i];
+        }
+        offset += 8;
+    }
+
+    if (payloadLength > WEBSOCKET_MAX_CLIENT_PAYLOAD) {
+        return -1;
+    }
+    if (length < offset + 4 + payloadLength) {
+        return 0;
+    }
+
+    const uint8_t* mask = data + offset;
+    offset += 4;
+
+    frame.final = (data[0] & 0x80) != 0;
+    frame.opcode = static_cast<WebSocketOpcode>(data[0] & 0x0F);
+    frame.payload.resize(static_cast<size_t>(payloadLength));
+    for (size_t i = 0; i < payloadLength; i++) {
+        frame.payload[i] = static_cast<char>(data[offset + i] ^ mask[i % 4]);
+    }
+    return static_cast<int>(offset + payloadLength);
+}
+
+std::string WebSocketProtocol::headerValue(const std::string& request, const char* name) {
+    size_t nameLength = strlen(name);
+    size_t lineStart = request.find("\r\n");
+
+    while (lineStart != std::string::npos) {
+        lineStart += 2;
+        size_t lineEnd = request.find("\r\n", lineStart);
+        if (lineEnd == std::string::npos || lineEnd == lineStart) {
+            break;
+        }
+
+        if (lineEnd - lineStart > nameLength && request[lineStart + nameLength] == ':') {
+            bool match = true;
+            for (size_t i = 0; i < nameLength && match; i++) {
+                match = tolower(static_cast<unsigned char>(request[lineStart + i])) ==
+                        tolower(static_cast<unsigned char>(name[i]));
+            }
+            if (match) {
+                size_t valueStart = lineStart + nameLength + 1;
+                while (valueStart < lineEnd && request[valueStart] == ' ') {
+                    valueStart++;
+                }
+                size_t valueEnd = lineEnd;
+                while (valueEnd > valueStart && request[valueEnd - 1] == ' ') {
+                    valueEnd--;
+                }
+                return request.substr(valueStart, valueEnd - valueStart);
+            }
+        }
+        lineStart = lineEnd;
+    }
+    return std::string();
+}
+
+// SHA-1 is only used for the handshake, so a compact implementation is enough
+void WebSocketProtocol::sha1(const uint8_t* data, size_t length, uint8_t digest[20]) {
+    uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+
+    // Message plus 0x80, zero padding and the 64-bit bit length, in 64-byte blocks
+    size_t paddedLength = ((length + 8) / 64 + 1) * 64;
+    std::string message(reinterpret_cast<const char*>(data), length);
+    message.push_back(static_cast<char>(0x80));
+    message.resize(paddedLength, '\0');
+    uint64_t bitLength = static_cast<uint64_t>(length) * 8;
+    for (int i = 0; i < 8; i++) {
+        message[paddedLength - 1 - i] = static_cast<char>((bitLength >> (i * 8)) & 0xFF);
+    }
+
+    for (size_t block = 0; block < paddedLength; block += 64) {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++) {
+            const uint8_t* p = reinterpret_cast<const uint8_t*>(message.data()) + block + i * 4;
+            w[i] = (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+                   (static_cast<uint32_t>(p[2]) << 8) | p[3];
+        }
+        for (int i = 16; i < 80; i++) {
+            uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+            w[i] = (x << 1) | (x >> 31);
+        }
+
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i = 0; i < 80; i++) {
+            uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5A827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+            uint32_t temp = ((a << 5) | (a >> 27)) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = (b << 30) | (b >> 2);
+            b = a;
+            a = temp;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    }
+
+    for (int i = 0; i < 5; i++) {
+        digest[i * 4] = static_cast<uint8_t>(h[i] >> 24);
+        digest[i * 4 + 1] = static_cast<uint8_t>(h[i] >> 16);
+        digest[i * 4 + 2] = static_cast<uint8_t>(h[i] >> 8);
+        digest[i * 4 + 3] = static_cast<uint8_t>(h[i]);
+    }
+}
+
+std::string WebSocketProtocol::base64(const uint8_t* data, size_t length) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    out.reserve((length + 2) / 3 * 4);
+
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t chunk = static_cast<uint32_t>(data[i]) << 16;
+        if (i + 1 < length) {
+            chunk |= static_cast<uint32_t>(data[i + 1]) << 8;
+        }
+        if (i + 2 < length) {
+            chunk |= data[i + 2];
+        }
+        out.push_back(alphabet[(chunk >> 18) & 0x3F]);
+        out.push_back(alphabet[(chunk >> 12) & 0x3F]);
+        out.push_back(i + 1 < length ? alphabet[(chunk >> 6) & 0x3F] : '=');
+        out.push_back(i + 2 < length ? alphabet[chunk & 0x3F] : '=');
+    }
+    return out;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief WebSocket opcodes (RFC 6455)
+ */
+enum class WebSocketOpcode : uint8_t {
+    Continuation = 0x0,
+    Text = 0x1,
+    Binary = 0x2,
+    Close = 0x8,
+    Ping = 0x9,
+    Pong = 0xA
+};
+
+/**
+ * @brief One frame received from a client
+ */
+struct WebSocketFrame {
+    WebSocketOpcode opcode;
+    bool final;
+    std::string payload;        // Unmasked payload
+};
+
+/**
+ * @brief The server side of the WebSocket protocol used by WebDisplay
+ *
+ * Covers the opening handshake, unfragmented server frames and parsing of
+ * (masked) client frames. Transport is left to the caller. Works on
+ * std::string so the same code runs with Arduino's String on the ESP32.
+ */
+class WebSocketProtocol {
+public:
+    /**
+     * @brief Compute the Sec-WebSocket-Accept value for a client key
+     *
+     * @param clientKey Value of the client's Sec-WebSocket-Key header
+     * @return std::string Base64 SHA-1 of the key and the protocol GUID
+     */
+    static std::string acceptKey(const std::string& clientKey);
+
+    /**
+     * @brief Build the 101 response that completes the opening handshake
+     *
+     * @param clientKey Value of the client's Sec-WebSocket-Key header
+     * @return std::string Full HTTP response
+     */
+    static std::string handshakeResponse(const std::string& clientKey);
+
+    /**
+     * @brief Append an unmasked, unfragmented server frame to a buffer
+     *
+     * @param out Buffer to append to
+     * @param opcode Frame opcode
+     * @param payload Payload bytes
+     * @param length Payload length
+     */
+    static void appendFrame(std::string& out, WebSocketOpcode opcode, const char* payload, size_t length);
+
+    /**
+     * @brief Parse one client frame from the start of a buffer
+     *
+     * @param data Received bytes
+     * @param length Number of received bytes
+     * @param frame Parsed frame, with the payload unmasked
+     * @return int Bytes used by the frame, 0 if more data is needed, -1 if the data is not a valid frame
+     */
+    static int parseFrame(const uint8_t* data, size_t length, WebSocketFrame& frame);
+
+    /**
+     * @brief Find an HTTP header value in a request, ignoring the name's case
+     *
+     * @param request Request line and headers
+     * @param name Header name without the colon
+     * @return std::string Trimmed value, empty if the header is missing
+     */
+    static std::string headerValue(const std::string& request, const char* name);
+
+private:
+    static void sha1(const uint8_t* data, size_t length, uint8_t digest[20]);
+    static std::string base64(const uint8_t* data, size_t length);
+};
@@ -1,7 +1,6 @@
 #include "SerialBridge.h"
 #include <Windows.h>
 #include <iostream>
-#include <chrono>
 #include "common/log_message.h"
 
 
@@ -11,7 +10,13 @@ SerialBridge& SerialBridge::getInstance() {
     return instance;
 }
 
-SerialBridge::SerialBridge() : serialPort_(INVALID_HANDLE_VALUE), running_(false) {
+SerialBridge::SerialBridge()
+    : serialPort_(INVALID_HANDLE_VALUE)
+    , stopEvent_(NULL)
+    , writeEvent_(NULL)
+    , running_(false)
+    , writeBatches_(0)
+    , droppedFrames_(0) {
 }
 
 SerialBridge::~SerialBridge() {
@@ -21,9 +26,9 @@ SerialBridge::~SerialBridge() {
 bool SerialBridge::initialize(const std::string& portName, int baudRate) {
     // Close any existing connection
     close();
-    
+
     log_message("Initializing serial bridge on port %s at %d baud", portName.c_str(), baudRate);
-    
+
     // Open the serial port
     HANDLE hSerial = CreateFileA(
         portName.c_str(),
@@ -31,155 +36,220 @@ bool SerialBridge::initialize(const std::string& portName, int baudRate) {
         0,                          // No sharing
         NULL,                       // No security
         OPEN_EXISTING,              // Open existing port only
-        0,                          // Non-overlapped I/O
+        FILE_FLAG_OVERLAPPED,       // Reads and writes are waited on together
         NULL                        // Null for comm devices
     );
-    
+
     if (hSerial == INVALID_HANDLE_VALUE) {
         DWORD error = GetLastError();
         log_message("Error opening serial port: %lu", error);
         return false;
     }
-    
+
     // Configure the serial port
     DCB dcbSerialParams = {0};
     dcbSerialParams.DCBlength = sizeof(dcbSerialParams);
-    
+
     if (!GetCommState(hSerial, &dcbSerialParams)) {
         log_message("Error getting serial port state");
         CloseHandle(hSerial);
         return false;
     }
-    
+
     dcbSerialParams.BaudRate = baudRate;
     dcbSerialParams.ByteSize = 8;
     dcbSerialParams.StopBits = ONESTOPBIT;
     dcbSerialParams.Parity = NOPARITY;
-    
+
     if (!SetCommState(hSerial, &dcbSerialParams)) {
         log_message("Error setting serial port state");
         CloseHandle(hSerial);
         return false;
     }
-    
-    // Set timeouts
+
+    // A read completes as soon as any bytes have arrived (or after 1 s with none);
+    // writes have no timeout
     COMMTIMEOUTS timeouts = {0};
-    timeouts.ReadIntervalTimeout = 50;
-    timeouts.ReadTotalTimeoutConstant = 50;
-    timeouts.ReadTotalTimeoutMultiplier = 10;
-    timeouts.WriteTotalTimeoutConstant = 50;
-    timeouts.WriteTotalTimeoutMultiplier = 10;
-    
+    timeouts.ReadIntervalTimeout = MAXDWORD;
+    timeouts.ReadTotalTimeoutMultiplier = MAXDWORD;
+    timeouts.ReadTotalTimeoutConstant = 1000;
+
     if (!SetCommTimeouts(hSerial, &timeouts)) {
         log_message("Error setting serial port timeouts");
         CloseHandle(hSerial);
         return false;
     }
-    
+
     // Store the handle
     serialPort_ = hSerial;
-    
-    // Start the read thread
+    stopEvent_ = CreateEvent(NULL, TRUE, FALSE, NULL);
+    writeEvent_ = CreateEvent(NULL, FALSE, FALSE, NULL);
+    reader_.reset();
+
+    // Start the I/O thread
     running_ = true;
-    readThread_ = std::thread(&SerialBridge::readThreadFunc, this);
-    
+    ioThread_ = std::thread(&SerialBridge::ioThreadFunc, this);
+
     log_message("Serial bridge initialized successfully");
     return true;
 }
 
 void SerialBridge::close() {
-    // Stop the read thread
+    // Stop the I/O thread
     if (running_) {
         running_ = false;
-        if (readThread_.joinable()) {
-            readThread_.join();
+        SetEvent(static_cast<HANDLE>(stopEvent_));
+        if (ioThread_.joinable()) {
+            ioThread_.join();
         }
     }
-    
+
     // Close the serial port
     if (serialPort_ != INVALID_HANDLE_VALUE) {
         CloseHandle(static_cast<HANDLE>(serialPort_));
         serialPort_ = INVALID_HANDLE_VALUE;
+        CloseHandle(static_cast<HANDLE>(stopEvent_));
+        CloseHandle(static_cast<HANDLE>(writeEvent_));
+        stopEvent_ = NULL;
+        writeEvent_ = NULL;
         log_message("Serial bridge closed");
     }
+
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    pendingWrites_.clear();
 }
 
-bool SerialBridge::send(const std::string& data) {
+bool SerialBridge::sendFrame(SerialFrameType type, const uint8_t* payload, size_t length) {
     if (serialPort_ == INVALID_HANDLE_VALUE) {
         return false;
     }
-    
-    DWORD bytesWritten;
-    bool success = WriteFile(
-        static_cast<HANDLE>(serialPort_),
-        data.c_str(),
-        static_cast<DWORD>(data.size()),
-        &bytesWritten,
-        NULL
-    );
-    
-    if (!success || bytesWritten != data.size()) {
-        log_message("Error writing to serial port");
-        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        if (pendingWrites_.size() + SERIAL_FRAME_OVERHEAD + length > SERIAL_BRIDGE_MAX_PENDING_BYTES ||
+            !pendingWrites_.append(type, payload, length)) {
+            droppedFrames_++;
+            return false;
+        }
     }
-    
+
+    SetEvent(static_cast<HANDLE>(writeEvent_));
     return true;
 }
 
-bool SerialBridge::dataAvailable() {
-    std::lock_guard<std::mutex> lock(incomingMutex_);
-    return !incomingData_.empty();
+bool SerialBridge::send(const std::string& data) {
+    return sendFrame(SerialFrameType::Text, reinterpret_cast<const uint8_t*>(data.data()), data.size());
 }
 
-std::string SerialBridge::read() {
-    std::lock_guard<std::mutex> lock(incomingMutex_);
-    if (incomingData_.empty()) {
-        return "";
+void SerialBridge::update() {
+    {
+        std::lock_guard<std::mutex> lock(receivedMutex_);
+        if (received_.empty()) {
+            return;
+        }
+        processing_.swap(received_);
     }
-    
-    std::string data = incomingData_.front();
-    incomingData_.pop();
-    return data;
+
+    reader_.feed(processing_.data(), processing_.size(), frameHandler_);
+    processing_.clear();
 }
 
-void SerialBridge::update() {
-    // Nothing to do here, the read thread handles reading
+void SerialBridge::storeReceived(const uint8_t* data, size_t length) {
+    std::lock_guard<std::mutex> lock(receivedMutex_);
+    // If update() is not keeping up, drop the new bytes; the frame reader resyncs
+    if (received_.size() + length > SERIAL_BRIDGE_MAX_RECEIVED_BYTES) {
+        return;
+    }
+    received_.insert(received_.end(), data, data + length);
 }
 
-void SerialBridge::readThreadFunc() {
-    const int bufferSize = 256;
-    char buffer[bufferSize];
-    
+void SerialBridge::ioThreadFunc() {
+    HANDLE port = static_cast<HANDLE>(serialPort_);
+    uint8_t readBuffer[SERIAL_BRIDGE_READ_CHUNK];
+    SerialFrameWriter inFlight;
+
+    OVERLAPPED readOverlapped = {0};
+    OVERLAPPED writeOverlapped = {0};
+    readOverlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+    writeOverlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+    bool reading = false;
+    bool writing = false;
+
     while (running_) {
-        if (serialPort_ == INVALID_HANDLE_VALUE) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            continue;
+        // Keep one read pending at all times
+        bool readCompleted = false;
+        if (!reading) {
+            DWORD bytesRead = 0;
+            ResetEvent(readOverlapped.hEvent);
+            if (ReadFile(port, readBuffer, sizeof(readBuffer), &bytesRead, &readOverlapped)) {
+                storeReceived(readBuffer, bytesRead);
+                readCompleted = true;
+            } else if (GetLastError() == ERROR_IO_PENDING) {
+                reading = true;
+            } else {
+                log_message("Error reading from serial port: %lu", GetLastError());
+                break;
+            }
         }
-        
-        DWORD bytesRead;
-        bool success = ReadFile(
-            static_cast<HANDLE>(serialPort_),
-            buffer,
-            bufferSize - 1,
-            &bytesRead,
-            NULL
-        );
-        
-        if (success && bytesRead > 0) {
-            buffer[bytesRead] = '\0';
-            std::string data(buffer, bytesRead);
-            
-            // Add to the queue
+
+        // Write everything queued since the last write in one go
+        if (!writing) {
             {
-                std::lock_guard<std::mutex> lock(incomingMutex_);
-                incomingData_.push(data);
+                std::lock_guard<std::mutex> lock(writeMutex_);
+                pendingWrites_.swap(inFlight);
+            }
+            if (!inFlight.empty()) {
+                ResetEvent(writeOverlapped.hEvent);
+                if (!WriteFile(port, inFlight.data(), static_cast<DWORD>(inFlight.size()), NULL, &writeOverlapped) &&
+                    GetLastError() != ERROR_IO_PENDING) {
+                    log_message("Error writing to serial port: %lu", GetLastError());
+                    inFlight.clear();
+                } else {
+                    writing = true;
+                }
             }
-            
-            // Log the received data
-            log_message("Serial received: %s", data.c_str());
         }
-        
-        // Sleep a bit to avoid hogging the CPU
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        // More bytes may already be waiting
+        if (readCompleted) {
+            continue;
+        }
+
+        // Sleep until bytes arrive, the write finishes, frames are queued or close() is called
+        HANDLE events[3] = {
+            static_cast<HANDLE>(stopEvent_),
+            readOverlapped.hEvent,
+            writing ? writeOverlapped.hEvent : static_cast<HANDLE>(writeEvent_)
+        };
+        DWORD result = WaitForMultipleObjects(3, events, FALSE, INFINITE);
+        if (result == WAIT_OBJECT_0 + 1) {
+            DWORD bytesRead = 0;
+            if (GetOverlappedResult(port, &readOverlapped, &bytesRead, FALSE)) {
+                storeReceived(readBuffer, bytesRead);
+            }
+            reading = false;
+        } else if (result == WAIT_OBJECT_0 + 2 && writing) {
+            DWORD bytesWritten = 0;
+            if (!GetOverlappedResult(port, &writeOverlapped, &bytesWritten, FALSE) || bytesWritten != inFlight.size()) {
+                log_message("Error writing to serial port");
+            }
+            writeBatches_++;
+            inFlight.clear();
+            writing = false;
+        } else if (result != WAIT_OBJECT_0 + 2) {
+            break;
+        }
+    }
+
+    // Cancel what is still pending and wait for it before the buffers go away
+    CancelIo(port);
+    DWORD ignored = 0;
+    if (reading) {
+        GetOverlappedResult(port, &readOverlapped, &ignored, TRUE);
+    }
+    if (writing) {
+        GetOverlappedResult(port, &writeOverlapped, &ignored, TRUE);
     }
+    CloseHandle(readOverlapped.hEvent);
+    CloseHandle(writeOverlapped.hEvent);
 }
@@ -2,90 +2,139 @@
 
 #include <string>
 #include <mutex>
-#include <queue>
+#include <vector>
 #include <thread>
 #include <atomic>
+#include "common/SerialFraming.h"
+
+// Bytes read from the port per ReadFile call
+#define SERIAL_BRIDGE_READ_CHUNK 1024
+
+// Frames not yet written before send() starts refusing new ones
+#define SERIAL_BRIDGE_MAX_PENDING_BYTES 16384
+
+// Received bytes held for update() before new ones are dropped
+#define SERIAL_BRIDGE_MAX_RECEIVED_BYTES 65536
 
 /**
  * @brief Serial communication bridge for the simulator
- * 
+ *
  * This class provides a way to send and receive serial data in the simulator
- * environment, bridging between the simulator and a real serial port.
+ * environment, bridging between the simulator and a real serial port, for
+ * example an ESP32 running the firmware.
+ *
+ * Data on the port is framed (see common/SerialFraming.h). One I/O thread
+ * waits on the port with overlapped I/O, so it wakes as soon as bytes arrive
+ * or frames are queued instead of polling. Frames queued while a write is in
+ * flight are batched into the next single write. Received bytes are handed
+ * to update(), which reassembles frames and calls the frame handler on the
+ * caller's thread. All buffers are reused, so steady traffic does not
+ * allocate.
  */
 class SerialBridge {
 public:
     /**
      * @brief Get the singleton instance
-     * 
+     *
      * @return SerialBridge& The singleton instance
      */
     static SerialBridge& getInstance();
-    
+
     /**
      * @brief Initialize the serial bridge
-     * 
+     *
      * @param portName The name of the serial port (e.g., "COM3")
      * @param baudRate The baud rate (e.g., 115200)
      * @return true if initialization was successful
      * @return false if initialization failed
      */
     bool initialize(const std::string& portName, int baudRate);
-    
+
     /**
      * @brief Close the serial connection
      */
     void close();
-    
+
     /**
-     * @brief Send data to the serial port
-     * 
-     * @param data The data to send
-     * @return true if the data was sent successfully
-     * @return false if the data could not be sent
+     * @brief Queue a frame for the serial port
+     *
+     * Returns straight away; the I/O thread writes the frame together with
+     * any others queued meanwhile.
+     *
+     * @param type Frame type
+     * @param payload Payload bytes
+     * @param length Payload length (at most SERIAL_FRAME_MAX_PAYLOAD)
+     * @return true if the frame was queued
+     * @return false if the port is closed, the payload is too long or the queue is full
      */
-    bool send(const std::string& data);
-    
+    bool sendFrame(SerialFrameType type, const uint8_t* payload, size_t length);
+
     /**
-     * @brief Check if data is available to read
-     * 
-     * @return true if data is available
-     * @return false if no data is available
+     * @brief Queue text as a Text frame
+     *
+     * @param data The text to send
+     * @return true if the frame was queued
      */
-    bool dataAvailable();
-    
+    bool send(const std::string& data);
+
     /**
-     * @brief Read data from the serial port
-     * 
-     * @return std::string The data read from the serial port
+     * @brief Set the handler for received frames
+     *
+     * @param handler Called from update() for each complete frame
      */
-    std::string read();
-    
+    void setFrameHandler(SerialFrameHandler handler) { frameHandler_ = handler; }
+
     /**
      * @brief Update the serial bridge
-     * 
-     * This should be called regularly in the main loop.
+     *
+     * Reassembles the bytes received since the last call and hands complete
+     * frames to the frame handler. This should be called regularly in the
+     * main loop.
      */
     void update();
 
+    uint32_t getFramesReceived() const { return reader_.getFramesReceived(); }
+    uint32_t getBytesDiscarded() const { return reader_.getBytesDiscarded(); }
+    uint32_t getWriteBatches() const { return writeBatches_; }
+    uint32_t getDroppedFrames() const { return droppedFrames_; }
+
 private:
     SerialBridge();
     ~SerialBridge();
-    
+
     // Prevent copying
     SerialBridge(const SerialBridge&) = delete;
     SerialBridge& operator=(const SerialBridge&) = delete;
-    
-    // Serial port handle
+
+    // Serial port handle, opened for overlapped I/O
     void* serialPort_;
-    
-    // Thread for reading from the serial port
-    std::thread readThread_;
+
+    // Events that wake the I/O thread: close() and queued frames
+    void* stopEvent_;
+    void* writeEvent_;
+
+    // Thread for reading from and writing to the serial port
+    std::thread ioThread_;
     std::atomic<bool> running_;
-    
-    // Queue for incoming data
-    std::queue<std::string> incomingData_;
-    std::mutex incomingMutex_;
-    
-    // Read thread function
-    void readThreadFunc();
+
+    // Frames queued by send(); the I/O thread swaps the whole batch out
+    SerialFrameWriter pendingWrites_;
+    std::mutex writeMutex_;
+    std::atomic<uint32_t> writeBatches_;
+    std::atomic<uint32_t> droppedFrames_;
+
+    // Bytes read by the I/O thread, swapped into processing_ by update()
+    std::vector<uint8_t> received_;
+    std::vector<uint8_t> processing_;
+    std::mutex receivedMutex_;
+
+    // Frame reassembly, on the thread that calls update()
+    SerialFrameReader reader_;
+    SerialFrameHandler frameHandler_;
+
+    // I/O thread function
+    void ioThreadFunc();
+
+    // Keep bytes read from the port for update()
+    void storeReceived(const uint8_t* data, size_t length);
 };
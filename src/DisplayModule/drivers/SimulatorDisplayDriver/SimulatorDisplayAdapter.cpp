@@ -18,6 +18,13 @@ SimulatorDisplayAdapter* SimulatorDisplayAdapter::instance_ = nullptr;
 #define DISP_HOR_RES 800
 #define DISP_VER_RES 480
 
+// Race screen shared by drawRaceActive() and updateRaceData(); built on
+// first use and kept, so switching modes only swaps cached mode UIs
+static RaceScreen& raceScreen() {
+    static RaceScreen screen;
+    return screen;
+}
+
 SimulatorDisplayAdapter::SimulatorDisplayAdapter() 
     : cursor_x_(0)
     , cursor_y_(0)
@@ -246,11 +253,8 @@ void SimulatorDisplayAdapter::drawConfig() {
 void SimulatorDisplayAdapter::drawRaceActive(RaceMode raceMode) {
     std::cout << "SimulatorDisplayAdapter: Drawing race active screen with mode " << static_cast<int>(raceMode) << std::endl;
     
-    // Create and show the race screen
-    static RaceScreen raceScreen;
-    // Just show the race screen without passing the race mode
-    // The race mode would need to be set separately or handled differently
-    raceScreen.Show();
+    raceScreen().SetRaceMode(raceMode);
+    raceScreen().Show();
 }
 
 void SimulatorDisplayAdapter::startLightSequence() {
@@ -264,9 +268,11 @@ void SimulatorDisplayAdapter::startLightSequence() {
 void SimulatorDisplayAdapter::updateRaceData(const std::vector<RaceLaneData>& laneData) {
     std::cout << "SimulatorDisplayAdapter: Updating race data with " << laneData.size() << " lanes" << std::endl;
     
-    // Delegate to the race screen
-    // This would need to be implemented in RaceScreen
-    // For now, we'll just log it
+    // Delegate to the active mode UI of the race screen
+    RaceModeUI* modeUI = raceScreen().GetActiveRaceModeUI();
+    if (modeUI) {
+        modeUI->UpdateRaceData(laneData);
+    }
 }
 
 void SimulatorDisplayAdapter::drawStats() {
@@ -28,6 +28,11 @@ bool SimulatorSerialDisplay::initialize() {
     
     // Initialize the serial bridge
     if (SerialBridge::getInstance().initialize(_portName, _baudRate)) {
+        SerialBridge::getInstance().setFrameHandler([](SerialFrameType type, const uint8_t* payload, size_t length) {
+            if (type == SerialFrameType::Text) {
+                log_message("Serial received: %.*s", (int)length, (const char*)payload);
+            }
+        });
         _initialized = true;
         log_message("SimulatorSerialDisplay: Initialized on port %s at %d baud", _portName.c_str(), _baudRate);
         return true;
@@ -38,7 +43,7 @@ bool SimulatorSerialDisplay::initialize() {
 }
 
 void SimulatorSerialDisplay::update() {
-    // Process any incoming serial data
+    // Hand received frames to the frame handler
     if (_initialized && !_portName.empty()) {
         SerialBridge::getInstance().update();
     }
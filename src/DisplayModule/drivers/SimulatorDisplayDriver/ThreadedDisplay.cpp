@@ -0,0 +1,274 @@
+#ifdef SIMULATOR
+
+#include "ThreadedDisplay.h"
+#include <cstdarg>
+#include <cstdio>
+
+// ===== RenderWorker =====
+
+RenderWorker::RenderWorker()
+    : _hasRaceData(false)
+    , _busy(false)
+    , _running(false)
+    , _droppedJobs(0)
+    , _replacedSnapshots(0)
+    , _drawnSnapshots(0) {
+}
+
+RenderWorker::~RenderWorker() {
+    stop();
+}
+
+void RenderWorker::start(std::function<void(const std::vector<RaceLaneData>&)> drawRaceData) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_running) {
+        return;
+    }
+    _drawRaceData = drawRaceData;
+    _running = true;
+    _thread = std::thread(&RenderWorker::run, this);
+}
+
+void RenderWorker::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running) {
+            return;
+        }
+        _running = false;
+    }
+    _wake.notify_one();
+    _thread.join();
+}
+
+bool RenderWorker::post(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_jobs.size() >= RENDER_WORKER_QUEUE_DEPTH) {
+            _droppedJobs++;
+            return false;
+        }
+        _jobs.push_back(std::move(job));
+    }
+    _wake.notify_one();
+    return true;
+}
+
+void RenderWorker::postRaceData(const std::vector<RaceLaneData>& laneData) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_hasRaceData) {
+            _replacedSnapshots++;
+        }
+        _raceData = laneData;
+        _hasRaceData = true;
+    }
+    _wake.notify_one();
+}
+
+void RenderWorker::drain() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this] { return !_running || (_jobs.empty() && !_hasRaceData && !_busy); });
+}
+
+uint32_t RenderWorker::getDroppedJobs() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _droppedJobs;
+}
+
+uint32_t RenderWorker::getReplacedSnapshots() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _replacedSnapshots;
+}
+
+uint32_t RenderWorker::getDrawnSnapshots() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _drawnSnapshots;
+}
+
+void RenderWorker::run() {
+    std::vector<RaceLaneData> laneData;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _wake.wait(lock, [this] { return !_running || !_jobs.empty() || _hasRaceData; });
+
+        // Jobs keep their order (screen changes before the data drawn on them)
+        if (!_jobs.empty()) {
+            std::function<void()> job = std::move(_jobs.front());
+            _jobs.pop_front();
+            _busy = true;
+            lock.unlock();
+            job();
+            lock.lock();
+            _busy = false;
+        } else if (_hasRaceData) {
+            laneData.swap(_raceData);
+            _hasRaceData = false;
+            _busy = true;
+            lock.unlock();
+            if (_drawRaceData) {
+                _drawRaceData(laneData);
+            }
+            lock.lock();
+            _busy = false;
+            _drawnSnapshots++;
+        } else if (!_running) {
+            break;
+        }
+
+        if (_jobs.empty() && !_hasRaceData) {
+            _idle.notify_all();
+        }
+    }
+    _idle.notify_all();
+}
+
+// ===== ThreadedBaseDisplay =====
+
+ThreadedBaseDisplay::ThreadedBaseDisplay(IBaseDisplay* display, RaceDataPrinter printRaceData)
+    : _display(display) {
+    _worker.start([display, printRaceData](const std::vector<RaceLaneData>& laneData) {
+        if (printRaceData) {
+            printRaceData(display, laneData);
+        }
+    });
+}
+
+ThreadedBaseDisplay::~ThreadedBaseDisplay() {
+    _worker.stop();
+}
+
+bool ThreadedBaseDisplay::initialize() {
+    bool result = false;
+    _worker.post([this, &result] { result = _display->initialize(); });
+    _worker.drain();
+    return result;
+}
+
+void ThreadedBaseDisplay::update() {
+    _worker.post([this] { _display->update(); });
+}
+
+void ThreadedBaseDisplay::clear() {
+    _worker.post([this] { _display->clear(); });
+}
+
+void ThreadedBaseDisplay::print(const String& message, bool newLine) {
+    _worker.post([this, message, newLine] { _display->print(message, newLine); });
+}
+
+void ThreadedBaseDisplay::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    print(String(buffer), false);
+}
+
+// ===== ThreadedGraphicalDisplay =====
+
+ThreadedGraphicalDisplay::ThreadedGraphicalDisplay(IGraphicalDisplay* display)
+    : _display(display)
+    , _width(display->getWidth())
+    , _height(display->getHeight()) {
+    _worker.start([this](const std::vector<RaceLaneData>& laneData) { _display->updateRaceData(laneData); });
+}
+
+ThreadedGraphicalDisplay::~ThreadedGraphicalDisplay() {
+    _worker.stop();
+}
+
+bool ThreadedGraphicalDisplay::initialize() {
+    bool result = false;
+    _worker.post([this, &result] { result = _display->initialize(); });
+    _worker.drain();
+    return result;
+}
+
+void ThreadedGraphicalDisplay::update() {
+    _worker.post([this] { _display->update(); });
+}
+
+void ThreadedGraphicalDisplay::clear() {
+    _worker.post([this] { _display->clear(); });
+}
+
+void ThreadedGraphicalDisplay::print(const String& message, bool newLine) {
+    _worker.post([this, message, newLine] { _display->print(message, newLine); });
+}
+
+void ThreadedGraphicalDisplay::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    print(String(buffer), false);
+}
+
+void ThreadedGraphicalDisplay::setCursor(int x, int y) {
+    _worker.post([this, x, y] { _display->setCursor(x, y); });
+}
+
+void ThreadedGraphicalDisplay::setTextColor(uint32_t color) {
+    _worker.post([this, color] { _display->setTextColor(color); });
+}
+
+void ThreadedGraphicalDisplay::setTextSize(uint8_t size) {
+    _worker.post([this, size] { _display->setTextSize(size); });
+}
+
+void ThreadedGraphicalDisplay::drawRect(int x, int y, int w, int h, uint32_t color) {
+    _worker.post([this, x, y, w, h, color] { _display->drawRect(x, y, w, h, color); });
+}
+
+void ThreadedGraphicalDisplay::fillRect(int x, int y, int w, int h, uint32_t color) {
+    _worker.post([this, x, y, w, h, color] { _display->fillRect(x, y, w, h, color); });
+}
+
+void ThreadedGraphicalDisplay::drawCircle(int x, int y, int r, uint32_t color) {
+    _worker.post([this, x, y, r, color] { _display->drawCircle(x, y, r, color); });
+}
+
+void ThreadedGraphicalDisplay::fillCircle(int x, int y, int r, uint32_t color) {
+    _worker.post([this, x, y, r, color] { _display->fillCircle(x, y, r, color); });
+}
+
+void ThreadedGraphicalDisplay::drawMain() {
+    _worker.post([this] { _display->drawMain(); });
+}
+
+void ThreadedGraphicalDisplay::drawRaceReady() {
+    _worker.post([this] { _display->drawRaceReady(); });
+}
+
+void ThreadedGraphicalDisplay::drawConfig() {
+    _worker.post([this] { _display->drawConfig(); });
+}
+
+void ThreadedGraphicalDisplay::drawRaceActive(RaceMode raceMode) {
+    _worker.post([this, raceMode] { _display->drawRaceActive(raceMode); });
+}
+
+void ThreadedGraphicalDisplay::startLightSequence() {
+    _worker.post([this] { _display->startLightSequence(); });
+}
+
+void ThreadedGraphicalDisplay::updateRaceData(const std::vector<RaceLaneData>& laneData) {
+    _worker.postRaceData(laneData);
+}
+
+void ThreadedGraphicalDisplay::drawStats() {
+    _worker.post([this] { _display->drawStats(); });
+}
+
+void ThreadedGraphicalDisplay::drawPause() {
+    _worker.post([this] { _display->drawPause(); });
+}
+
+void ThreadedGraphicalDisplay::drawStop() {
+    _worker.post([this] { _display->drawStop(); });
+}
+
+#endif // SIMULATOR
@@ -0,0 +1,173 @@
+#pragma once
+
+#ifdef SIMULATOR
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "DisplayModule/DisplayModule.h"
+#include "RaceModule/RaceModule.h"
+
+// Display calls a worker holds before it starts dropping new ones
+#define RENDER_WORKER_QUEUE_DEPTH 64
+
+/**
+ * @brief Runs one display's calls on its own thread
+ *
+ * Display calls are queued as jobs and run in order. Race data goes
+ * into a separate slot where a newer snapshot replaces an older one
+ * that has not been drawn yet. A slow display therefore only ever
+ * draws the latest race state and never holds up its caller.
+ */
+class RenderWorker {
+public:
+    RenderWorker();
+    ~RenderWorker();
+
+    /**
+     * @brief Start the worker thread
+     * @param drawRaceData Called on the worker with each race data snapshot
+     */
+    void start(std::function<void(const std::vector<RaceLaneData>&)> drawRaceData);
+
+    /**
+     * @brief Run the queued jobs, then stop and join the worker thread
+     */
+    void stop();
+
+    /**
+     * @brief Queue a job behind the ones already waiting
+     * @param job Call to run on the worker thread
+     * @return false if the queue was full and the job was dropped
+     */
+    bool post(std::function<void()> job);
+
+    /**
+     * @brief Hand over a race data snapshot, replacing one not yet drawn
+     * @param laneData Lane data to draw
+     */
+    void postRaceData(const std::vector<RaceLaneData>& laneData);
+
+    /**
+     * @brief Block until every queued job and snapshot has been handled
+     */
+    void drain();
+
+    uint32_t getDroppedJobs() const;
+    uint32_t getReplacedSnapshots() const;
+    uint32_t getDrawnSnapshots() const;
+
+private:
+    void run();
+
+    std::thread _thread;
+    mutable std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _idle;
+    std::deque<std::function<void()>> _jobs;
+    std::vector<RaceLaneData> _raceData;
+    std::function<void(const std::vector<RaceLaneData>&)> _drawRaceData;
+    bool _hasRaceData;
+    bool _busy;
+    bool _running;
+    uint32_t _droppedJobs;
+    uint32_t _replacedSnapshots;
+    uint32_t _drawnSnapshots;
+};
+
+/**
+ * @brief IBaseDisplay that forwards every call to another display's render thread
+ *
+ * Calls return as soon as they are queued. print() and printf() format the
+ * text on the calling thread. getDisplayType() is answered directly.
+ * Text displays have no updateRaceData() of their own, so the owner passes
+ * the function that prints race data to the wrapped display.
+ */
+class ThreadedBaseDisplay : public IBaseDisplay {
+public:
+    typedef std::function<void(IBaseDisplay*, const std::vector<RaceLaneData>&)> RaceDataPrinter;
+
+    /**
+     * @param display Display to drive; not owned, must outlive this object
+     * @param printRaceData Prints a race data snapshot to the wrapped display
+     */
+    ThreadedBaseDisplay(IBaseDisplay* display, RaceDataPrinter printRaceData);
+    ~ThreadedBaseDisplay() override;
+
+    /**
+     * @brief Hand race data to the render thread, replacing a snapshot not yet printed
+     * @param laneData Lane data to print
+     */
+    void updateRaceData(const std::vector<RaceLaneData>& laneData) { _worker.postRaceData(laneData); }
+
+    bool initialize() override;
+    void update() override;
+    void clear() override;
+    void print(const String& message, bool newLine = true) override;
+    void printf(const char* format, ...) override;
+    DisplayType getDisplayType() const override { return _display->getDisplayType(); }
+
+    RenderWorker& getWorker() { return _worker; }
+
+private:
+    IBaseDisplay* _display;
+    RenderWorker _worker;
+};
+
+/**
+ * @brief IGraphicalDisplay that runs another display on its own render thread
+ *
+ * All of the wrapped display's drawing, including every LVGL call it makes,
+ * happens on that thread. updateRaceData() goes through the worker's
+ * snapshot slot, so a display that is behind skips straight to the newest data.
+ */
+class ThreadedGraphicalDisplay : public IGraphicalDisplay {
+public:
+    /**
+     * @param display Display to drive; not owned, must outlive this object
+     */
+    explicit ThreadedGraphicalDisplay(IGraphicalDisplay* display);
+    ~ThreadedGraphicalDisplay() override;
+
+    // IBaseDisplay
+    bool initialize() override;
+    void update() override;
+    void clear() override;
+    void print(const String& message, bool newLine = true) override;
+    void printf(const char* format, ...) override;
+    DisplayType getDisplayType() const override { return _display->getDisplayType(); }
+
+    // IGraphicalDisplay
+    void setCursor(int x, int y) override;
+    void setTextColor(uint32_t color) override;
+    void setTextSize(uint8_t size) override;
+    void drawRect(int x, int y, int w, int h, uint32_t color) override;
+    void fillRect(int x, int y, int w, int h, uint32_t color) override;
+    void drawCircle(int x, int y, int r, uint32_t color) override;
+    void fillCircle(int x, int y, int r, uint32_t color) override;
+    int getWidth() const override { return _width; }
+    int getHeight() const override { return _height; }
+    void drawMain() override;
+    void drawRaceReady() override;
+    void drawConfig() override;
+    void drawRaceActive(RaceMode raceMode) override;
+    void startLightSequence() override;
+    void updateRaceData(const std::vector<RaceLaneData>& laneData) override;
+    void drawStats() override;
+    void drawPause() override;
+    void drawStop() override;
+
+    RenderWorker& getWorker() { return _worker; }
+
+private:
+    IGraphicalDisplay* _display;
+    RenderWorker _worker;
+    int _width;
+    int _height;
+};
+
+#endif // SIMULATOR
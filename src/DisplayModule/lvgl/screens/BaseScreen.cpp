@@ -1,5 +1,7 @@
 #include "BaseScreen.h"
 #include "../utils/ColorUtils.h"
+#include "../utils/UITheme.h"
+#include "../utils/LvglMemory.h"
 #include <lvgl.h>
 #include <string>
 
@@ -31,12 +33,11 @@ void BaseScreen::CreateScreenLayout() {
     // Create main screen
     screen_ = lv_obj_create(NULL);
     lv_obj_set_size(screen_, LV_HOR_RES, LV_VER_RES);
-    lv_obj_set_style_bg_color(screen_, ColorUtils::Black(), 0);
+    lv_obj_add_style(screen_, UITheme::Screen(), 0);
 
     // Create title label - centered in 70px header
     title_label_ = lv_label_create(screen_);
-    lv_obj_set_style_text_font(title_label_, &lv_font_montserrat_32, 0);
-    lv_obj_set_style_text_color(title_label_, ColorUtils::White(), 0);
+    lv_obj_add_style(title_label_, UITheme::ScreenTitle(), 0);
     
     // Get the height of the text to center it properly
     lv_point_t text_size;
@@ -46,7 +47,7 @@ void BaseScreen::CreateScreenLayout() {
     int title_y = (70 - text_size.y) / 2;
     lv_obj_align(title_label_, LV_ALIGN_TOP_MID, 0, title_y);
 
-    // Create content area (acts as a frame)
+    // Create content area (acts as a frame; transparent and borderless once styles are removed)
     content_area_ = lv_obj_create(screen_);
     lv_obj_remove_style_all(content_area_);  // Start with clean styling
     
@@ -55,20 +56,10 @@ void BaseScreen::CreateScreenLayout() {
                     LV_VER_RES - TITLE_HEIGHT - BUTTON_HEIGHT - BOTTOM_MARGIN);
     lv_obj_align_to(content_area_, title_label_, LV_ALIGN_OUT_BOTTOM_MID, 0, 20);
     
-    // Set content area styling (just a frame)
-    lv_obj_set_style_bg_opa(content_area_, LV_OPA_0, 0);  // Transparent background
-    lv_obj_set_style_border_width(content_area_, 0, 0);   // No border for the frame
-    
-    // Create content container that will hold the actual screen content
+    // Create content container that will hold the actual screen content (padded flex column)
     content_container_ = lv_obj_create(content_area_);
     lv_obj_remove_style_all(content_container_);
-    lv_obj_set_size(content_container_, lv_pct(100), lv_pct(100));
-    lv_obj_align(content_container_, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_obj_set_style_bg_opa(content_container_, LV_OPA_TRANSP, LV_PART_MAIN);
-    lv_obj_set_style_pad_all(content_container_, CONTENT_PADDING, LV_PART_MAIN);
-    lv_obj_set_style_pad_row(content_container_, CONTENT_ROW_SPACING, LV_PART_MAIN);
-    lv_obj_set_flex_flow(content_container_, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_flex_align(content_container_, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
+    lv_obj_add_style(content_container_, UITheme::ContentContainer(), LV_PART_MAIN);
     lv_obj_set_scrollbar_mode(content_container_, LV_SCROLLBAR_MODE_AUTO);
 
     // Add debug borders for layout visualization
@@ -76,37 +67,27 @@ void BaseScreen::CreateScreenLayout() {
     lv_obj_t* header_border = lv_obj_create(screen_);
     lv_obj_set_size(header_border, LV_HOR_RES, 70);
     lv_obj_align(header_border, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_obj_set_style_border_width(header_border, 2, 0);
-    lv_obj_set_style_border_color(header_border, lv_color_white(), 0);
-    lv_obj_set_style_bg_opa(header_border, LV_OPA_0, 0);  // Transparent background
+    lv_obj_add_style(header_border, UITheme::DebugBorder(), 0);
 
     // Content border (70-400)
     lv_obj_t* content_border = lv_obj_create(screen_);
     lv_obj_set_size(content_border, LV_HOR_RES, 330);  // 400-70=330
     lv_obj_align(content_border, LV_ALIGN_TOP_LEFT, 0, 70);
-    lv_obj_set_style_border_width(content_border, 2, 0);
-    lv_obj_set_style_border_color(content_border, lv_color_white(), 0);
-    lv_obj_set_style_bg_opa(content_border, LV_OPA_0, 0);  // Transparent background
+    lv_obj_add_style(content_border, UITheme::DebugBorder(), 0);
 
     // Footer border (400-480)
     lv_obj_t* footer_border = lv_obj_create(screen_);
     lv_obj_set_size(footer_border, LV_HOR_RES, 80);  // 480-400=80
     lv_obj_align(footer_border, LV_ALIGN_TOP_LEFT, 0, 400);
-    lv_obj_set_style_border_width(footer_border, 2, 0);
-    lv_obj_set_style_border_color(footer_border, lv_color_white(), 0);
-    lv_obj_set_style_bg_opa(footer_border, LV_OPA_0, 0);  // Transparent background
+    lv_obj_add_style(footer_border, UITheme::DebugBorder(), 0);
     
     // Add debug grid
     CreateDebugGrid(screen_);
 }
 
 void BaseScreen::CreateDebugGrid(lv_obj_t* parent) {
-    lv_color_t grid_color = lv_color_make(255, 0, 0);  // Red
-    lv_style_t style_line;
-    lv_style_init(&style_line);
-    lv_style_set_line_color(&style_line, grid_color);
-    lv_style_set_line_width(&style_line, 1);
-    lv_style_set_line_rounded(&style_line, false);
+    // Shared style: a style passed to lv_obj_add_style must outlive the objects using it
+    lv_style_t* style_line = UITheme::DebugGridLine();
 
     // Vertical lines at x=2 and x=798
     for (int x : {2, 798}) {
@@ -117,7 +98,7 @@ void BaseScreen::CreateDebugGrid(lv_obj_t* parent) {
         
         lv_obj_t* line = lv_line_create(parent);
         lv_line_set_points(line, line_points, 2);
-        lv_obj_add_style(line, &style_line, 0);
+        lv_obj_add_style(line, style_line, 0);
         
         // Add ticks and labels every 50px
         for (int y = 0; y <= 480; y += 50) {
@@ -128,14 +109,13 @@ void BaseScreen::CreateDebugGrid(lv_obj_t* parent) {
             
             lv_obj_t* tick = lv_line_create(parent);
             lv_line_set_points(tick, tick_points, 2);
-            lv_obj_add_style(tick, &style_line, 0);
+            lv_obj_add_style(tick, style_line, 0);
             
             // Label
             if (x == 2) {  // Only label on left side to avoid clutter
                 lv_obj_t* label = lv_label_create(parent);
                 lv_label_set_text_fmt(label, "%d", y);
-                lv_obj_set_style_text_color(label, grid_color, 0);
-                lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+                lv_obj_add_style(label, UITheme::DebugGridLabel(), 0);
                 lv_obj_align(label, LV_ALIGN_TOP_LEFT, x + 10, y - 6);
             }
         }
@@ -150,7 +130,7 @@ void BaseScreen::CreateDebugGrid(lv_obj_t* parent) {
         
         lv_obj_t* line = lv_line_create(parent);
         lv_line_set_points(line, line_points, 2);
-        lv_obj_add_style(line, &style_line, 0);
+        lv_obj_add_style(line, style_line, 0);
         
         // Add ticks and labels every 50px
         for (int x = 0; x <= 800; x += 50) {
@@ -161,14 +141,13 @@ void BaseScreen::CreateDebugGrid(lv_obj_t* parent) {
             
             lv_obj_t* tick = lv_line_create(parent);
             lv_line_set_points(tick, tick_points, 2);
-            lv_obj_add_style(tick, &style_line, 0);
+            lv_obj_add_style(tick, style_line, 0);
             
             // Label
             if (y == 2) {  // Only label on top to avoid clutter
                 lv_obj_t* label = lv_label_create(parent);
                 lv_label_set_text_fmt(label, "%d", x);
-                lv_obj_set_style_text_color(label, grid_color, 0);
-                lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+                lv_obj_add_style(label, UITheme::DebugGridLabel(), 0);
                 lv_obj_align(label, LV_ALIGN_TOP_LEFT, x - 10, y + 12);
             }
         }
@@ -208,6 +187,7 @@ void BaseScreen::CreateNavigationButtons(const char* left_text, const char* righ
 
 void BaseScreen::Show() {
     DPRINTF("BaseScreen::Show() - Entering, screen_=%p\n", screen_);
+    TrackMemory();
     
     if (screen_) {
         lv_obj_t* current_screen = lv_scr_act();
@@ -225,8 +205,8 @@ void BaseScreen::Show() {
             lv_scr_load(screen_);
         }
         
-        // Force a full refresh
-        lv_refr_now(nullptr);
+        // The screen is drawn by the next lv_timer_handler() cycle; forcing a
+        // synchronous full refresh here stalled every screen switch
     } else {
         DPRINTLN("ERROR: Cannot show screen - screen_ is null");
     }
@@ -234,6 +214,13 @@ void BaseScreen::Show() {
     DPRINTLN("BaseScreen::Show() - Complete");
 }
 
+void BaseScreen::TrackMemory() {
+    // LVGL allocations from here on are reported under this screen's title
+    if (title_label_) {
+        LvglMemory::getInstance().beginScreen(lv_label_get_text(title_label_));
+    }
+}
+
 void BaseScreen::Hide() {
     // Base implementation just removes the screen
     // Derived classes might need to do cleanup before hiding
@@ -47,6 +47,9 @@ protected:
     // Create the basic screen layout
     void CreateScreenLayout();
     
+    // Start counting LVGL memory for this screen (called by Show())
+    void TrackMemory();
+    
     // Helper to create and position buttons
     void CreateNavigationButtons(const char* left_text, const char* right_text,
                                lv_color_t left_color, lv_color_t right_color,
@@ -73,6 +76,4 @@ private:
     static constexpr int BUTTON_WIDTH = 150;
     static constexpr int BUTTON_SPACING = 100;
     static constexpr int BOTTOM_MARGIN = 30;
-    static constexpr int CONTENT_PADDING = 10;
-    static constexpr int CONTENT_ROW_SPACING = 12;
 };
@@ -8,12 +8,13 @@
 #include "../../../common/DebugUtils.h"
 #include "../../../common/TimeManager.h"
 #include "../../../common/Types.h"
-#include <cinttypes> // For PRIu32
+#include <algorithm>
 #include <memory>
 #include "../../../InputModule/InputCommand.h"
 #include "../../../InputModule/GT911_TouchInput.h"
 #include "../utils/UIUtils.h"
-#include <cinttypes> // For PRIu32
+#include "../utils/UITheme.h"
+#include "../utils/LvglMemory.h"
 
 // ===== RaceModeUI Implementations =====
 
@@ -29,18 +30,7 @@ void LapsRaceUI::CreateUI(lv_obj_t* parent) {
     lv_obj_set_style_pad_column(container_, 0, 0);
     lv_obj_set_scrollbar_mode(container_, LV_SCROLLBAR_MODE_AUTO);
     
-    // Create the race data table container with no background or border
-    race_data_table_ = lv_obj_create(container_);
-    lv_obj_remove_style_all(race_data_table_);  // Remove all styles first
-    lv_obj_set_size(race_data_table_, lv_pct(100), lv_pct(95));
-    lv_obj_set_style_pad_all(race_data_table_, 0, 0);
-    lv_obj_set_style_border_width(race_data_table_, 0, 0);
-    lv_obj_set_style_bg_opa(race_data_table_, LV_OPA_0, 0);
-    lv_obj_set_style_radius(race_data_table_, 0, 0);  // No rounded corners
-    lv_obj_set_flex_flow(race_data_table_, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_flex_grow(race_data_table_, 1);  // Allow table to grow to fill space
-    
-    // Create table headers and initial rows
+    // Create the race data table and initial rows
     CreateTableHeaders();
     CreateLaneRows(numLanes_); // Create rows for configured number of lanes
     // Update row heights based on number of lanes
@@ -53,78 +43,38 @@ void LapsRaceUI::Update() {
 }
 
 void LapsRaceUI::Cleanup() {
-    // Reset the row containers array
-    for (auto& row : row_containers_) {
-        row = nullptr;
-    }
-    
-    // Delete the container which will delete all child objects
+    // Delete the container which will delete all child objects,
+    // including the table object
     if (container_) {
         lv_obj_del(container_);
         container_ = nullptr;
-        race_data_table_ = nullptr; // Will be deleted as part of container_
     }
 }
 
 void LapsRaceUI::CreateTableHeaders() {
-    // Create a header row container
-    lv_obj_t* header_row = lv_obj_create(race_data_table_);
-    lv_obj_remove_style_all(header_row);  // Remove default styles
-    lv_obj_set_size(header_row, lv_pct(100), LV_SIZE_CONTENT);  // Height will be set by UpdateRowHeights
-    lv_obj_set_style_bg_color(header_row, lv_color_hex(0x2C3E50), 0); // Dark blue header
-    lv_obj_set_style_bg_opa(header_row, LV_OPA_100, 0);
-    lv_obj_set_style_border_width(header_row, 0, 0);
-    lv_obj_set_style_pad_all(header_row, 2, 0);
-    lv_obj_set_style_pad_row(header_row, 0, 0);
-    lv_obj_set_style_pad_column(header_row, 2, 0);
-    lv_obj_set_flex_flow(header_row, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(header_row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    
     // Column definitions with flexible widths
-    struct ColumnDef {
-        const char* header;
-        lv_coord_t flex_grow;
-        lv_coord_t min_width;
-    };
-    
-    const ColumnDef columns[] = {
-        {"Pos", 1, 40},    // Position
-        {"Lane", 1, 50},   // Lane number
-        {"Laps", 1, 60},   // Laps count
+    const LeaderboardTable::Column columns[] = {
+        {"Pos", 1, 40},      // Position
+        {"Lane", 1, 50},     // Lane number
+        {"Laps", 1, 60},     // Laps count
         {"Last Lap", 2, 80}, // Last lap time
         {"Best Lap", 2, 80}, // Best lap time
-        {"Time", 1, 80}     // Total time
+        {"Time", 1, 80}      // Total time
     };
     
-    for (int i = 0; i < NUM_COLS; i++) {
-        const auto& col_def = columns[i];
-        
-        // Create column container
-        lv_obj_t* col = lv_obj_create(header_row);
-        lv_obj_remove_style_all(col);
-        lv_obj_set_style_pad_all(col, 2, 0);
-        lv_obj_set_style_bg_opa(col, LV_OPA_0, 0);
-        lv_obj_set_style_border_width(col, 0, 0);
-        lv_obj_set_flex_grow(col, col_def.flex_grow);
-        lv_obj_set_width(col, LV_SIZE_CONTENT);
-        lv_obj_set_height(col, lv_pct(100));
-        lv_obj_set_style_min_width(col, col_def.min_width, 0);
-        
-        // Center content in column
-        lv_obj_set_flex_flow(col, LV_FLEX_FLOW_ROW);
-        lv_obj_set_flex_align(col, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-        
-        // Create and style label
-        lv_obj_t* label = lv_label_create(col);
-        lv_label_set_text(label, col_def.header);
-        lv_obj_set_style_text_color(label, lv_color_white(), 0);
-        lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
-        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
-    }
+    LeaderboardTable::Styles styles;
+    styles.label = UITheme::LapsLabel();
+    styles.header = UITheme::LapsHeaderRow();
+    styles.row = UITheme::LapsRow();
+    styles.rowEven = UITheme::LapsRowEven();
+    styles.rowOdd = UITheme::LapsRowOdd();
+    
+    // One object for the whole table, filling the container
+    lv_obj_t* table = race_data_table_.Create(container_, columns, NUM_COLS, styles);
+    lv_obj_set_size(table, lv_pct(100), lv_pct(95));
+    lv_obj_set_flex_grow(table, 1);  // Allow table to grow to fill space
 }
 
-#include <algorithm>  // For std::max
-
 void LapsRaceUI::UpdateRowHeights(int numLanes) {
     if (numLanes <= 0) return;
     
@@ -145,94 +95,17 @@ void LapsRaceUI::UpdateRowHeights(int numLanes) {
     baseHeaderHeight = (baseHeaderHeight > minHeaderHeight) ? baseHeaderHeight : minHeaderHeight;
     baseRowHeight = (baseRowHeight > minRowHeight) ? baseRowHeight : minRowHeight;
     
-    // Update header height if race_data_table_ exists
-    if (race_data_table_ && lv_obj_get_child_cnt(race_data_table_) > 0) {
-        lv_obj_set_height(lv_obj_get_child(race_data_table_, 0), baseHeaderHeight);
-    }
-    
-    // Update row heights
-    for (size_t i = 0; i < row_containers_.size(); i++) {
-        if (row_containers_[i]) {
-            lv_obj_set_height(row_containers_[i], baseRowHeight);
-        }
-    }
+    race_data_table_.SetRowHeights(baseHeaderHeight, baseRowHeight);
 }
 
 void LapsRaceUI::CreateLaneRows(int numLanes) {
     DPRINTF("LapsRaceUI::CreateLaneRows - Creating %d lane rows\n", numLanes);
     
-    // Clear existing row containers
-    for (size_t i = 0; i < row_containers_.size(); i++) {
-        if (row_containers_[i]) {
-            lv_obj_del(row_containers_[i]);
-            row_containers_[i] = nullptr;
-        }
-    }
-    
     // Limit to configured number of lanes
     if (numLanes > numLanes_) numLanes = numLanes_;
     
-    // Column definitions matching the header
-    struct ColumnDef {
-        lv_coord_t flex_grow;
-        lv_coord_t min_width;
-    };
-    
-    const ColumnDef columns[] = {
-        {1, 40},   // Position
-        {1, 50},   // Lane number
-        {1, 60},   // Laps count
-        {2, 80},   // Last lap time
-        {2, 80},   // Best lap time
-        {1, 80}    // Total time
-    };
-    
-    // Create rows for each lane
-    for (int i = 0; i < numLanes; i++) {
-        // Create a container for the row
-        lv_obj_t* row = lv_obj_create(race_data_table_);
-        lv_obj_remove_style_all(row);
-        lv_obj_set_size(row, lv_pct(100), LV_SIZE_CONTENT);  // Height will be set by UpdateRowHeights
-        lv_obj_set_style_min_height(row, 30, 0);  // Absolute minimum row height
-        lv_obj_set_style_bg_color(row, lv_color_hex(i % 2 ? 0x2C3E50 : 0x34495E), 0);
-        lv_obj_set_style_bg_opa(row, LV_OPA_30, 0);
-        lv_obj_set_style_border_width(row, 0, 0);
-        lv_obj_set_style_pad_all(row, 2, 0);
-        lv_obj_set_style_pad_row(row, 0, 0);
-        lv_obj_set_style_pad_column(row, 2, 0);
-        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
-        lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-        
-        for (int j = 0; j < NUM_COLS; j++) {
-            const auto& col_def = columns[j];
-            
-            // Create cell container
-            lv_obj_t* cell = lv_obj_create(row);
-            lv_obj_remove_style_all(cell);
-            lv_obj_set_style_pad_all(cell, 2, 0);
-            lv_obj_set_style_bg_opa(cell, LV_OPA_0, 0);
-            lv_obj_set_style_border_width(cell, 0, 0);
-            lv_obj_set_flex_grow(cell, col_def.flex_grow);
-            lv_obj_set_width(cell, LV_SIZE_CONTENT);
-            lv_obj_set_height(cell, lv_pct(100));
-            lv_obj_set_style_min_width(cell, col_def.min_width, 0);
-            
-            // Center content in cell
-            lv_obj_set_flex_flow(cell, LV_FLEX_FLOW_ROW);
-            lv_obj_set_flex_align(cell, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-            
-            // Create and style label
-            lv_obj_t* label = lv_label_create(cell);
-            lv_label_set_text(label, "-");
-            lv_obj_set_style_text_color(label, lv_color_white(), 0);
-            lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
-            lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
-        }
-        
-        // Store the row container for later updates
-        row_containers_[i] = row;
-        DPRINTF("Created row container %d at %p\n", i, row);
-    }
+    // Rows are drawn by the table; this just resets their text to "-"
+    race_data_table_.SetRowCount(numLanes);
 }
 
 void LapsRaceUI::UpdateRaceData(const std::vector<RaceLaneData>& laneData) {
@@ -248,121 +121,54 @@ void LapsRaceUI::UpdateRaceData(const std::vector<RaceLaneData>& laneData) {
     }
     
     // Update each lane's data
-    for (size_t i = 0; i < laneData.size() && i < row_containers_.size(); i++) {
+    for (size_t i = 0; i < laneData.size() && i < race_data_table_.GetRowCount(); i++) {
         const auto& lane = laneData[i];
-        lv_obj_t* row = row_containers_[i];
+        uint8_t row = static_cast<uint8_t>(i);
         
-        if (!row) {
-            DPRINTF("  Warning: Row %d is null\n", i);
-            continue;
-        }
+        // Format values on the stack; times without a lap yet stay "-"
+        TimeString position;
+        TimeString laneStr;
+        TimeString lapsStr;
+        position.appendInt(lane.position);
+        laneStr.appendInt(lane.laneId);
+        lapsStr.appendInt(lane.currentLap).append('/').appendInt(lane.totalLaps);
         
-        // Buffer for formatted values
-        char position[16] = "-";
-        char laneStr[16] = "-";
-        char lapsStr[16] = "-";
-        char lastLapStr[16] = "-";
-        char bestLapStr[16] = "-";
-        char totalTimeStr[16] = "-";
-        
-        // Format values
-        snprintf(position, sizeof(position), "%d", lane.position);
-        snprintf(laneStr, sizeof(laneStr), "%d", lane.laneId);
-        snprintf(lapsStr, sizeof(lapsStr), "%d/%d", lane.currentLap, lane.totalLaps);
-        
-        if (lane.lastLapTime > 0) {
-            FormatTime(lastLapStr, sizeof(lastLapStr), lane.lastLapTime);
-        }
-        
-        if (lane.bestLapTime > 0) {
-            FormatTime(bestLapStr, sizeof(bestLapStr), lane.bestLapTime);
-        }
-        
-        if (lane.totalTime > 0) {
-            FormatTime(totalTimeStr, sizeof(totalTimeStr), lane.totalTime);
-        }
+        TimeString lastLapStr = lane.lastLapTime > 0 ? formatTimeMMSSmmm(lane.lastLapTime) : TimeString("-");
+        TimeString bestLapStr = lane.bestLapTime > 0 ? formatTimeMMSSmmm(lane.bestLapTime) : TimeString("-");
+        TimeString totalTimeStr = lane.totalTime > 0 ? formatTimeMMSSmmm(lane.totalTime) : TimeString("-");
         
         const char* values[] = {
-            position,
-            laneStr,
-            lapsStr,
-            lastLapStr,
-            bestLapStr,
-            totalTimeStr
+            position.c_str(),
+            laneStr.c_str(),
+            lapsStr.c_str(),
+            lastLapStr.c_str(),
+            bestLapStr.c_str(),
+            totalTimeStr.c_str()
         };
         
         DPRINTF("Updating row for lane %d with values: %s | %s | %s | %s | %s | %s\n",
                lane.laneId, values[0], values[1], values[2], values[3], values[4], values[5]);
         
-        // Update each cell in the row
-        for (int j = 0; j < NUM_COLS && j < lv_obj_get_child_cnt(row); j++) {
-            lv_obj_t* cell = lv_obj_get_child(row, j);
-            if (!cell) {
-                DPRINTF("Cell %d is null in row for lane %d\n", j, lane.laneId);
-                continue;
-            }
-            
-            // Get the label from the cell
-            lv_obj_t* label = lv_obj_get_child(cell, 0);
-            if (!label) {
-                DPRINTF("Label in cell %d is null for lane %d\n", j, lane.laneId);
-                continue;
-            }
-            
-            // Update the label text
-            lv_label_set_text(label, values[j]);
-            lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
-            
-            // Set text opacity based on lane state
-            lv_obj_set_style_text_opa(label, lane.enabled ? LV_OPA_100 : LV_OPA_50, 0);
-            
-            // Debug output
-            DPRINTF("  Updated cell %d: %s\n", j, values[j]);
+        // Update each cell in the row; only cells whose text changed are redrawn
+        for (int j = 0; j < NUM_COLS; j++) {
+            race_data_table_.SetCell(row, static_cast<uint8_t>(j), values[j]);
         }
     }
-}
-
-/**
- * @brief Format a time value in milliseconds to a MM:SS.mmm string
- * @param buffer Output buffer for the formatted string
- * @param bufferSize Size of the output buffer
- * @param timeMs Time in milliseconds
- */
-void LapsRaceUI::FormatTime(char* buffer, size_t bufferSize, uint32_t timeMs) {
-    if (buffer == nullptr || bufferSize == 0) {
-        return;
-    }
-    
-    // Handle zero time specially
-    if (timeMs == 0) {
-        strncpy(buffer, "00:00.000", bufferSize);
-        buffer[bufferSize - 1] = '\0'; // Ensure null termination
-        return;
-    }
-    
-    uint32_t minutes = (timeMs / 60000) % 60;
-    uint32_t seconds = (timeMs / 1000) % 60;
-    uint32_t milliseconds = timeMs % 1000;
     
-    // Ensure we have enough space for the formatted string ("00:00.000" + null terminator)
-    if (bufferSize < 10) {
-        strncpy(buffer, "--:--.---", bufferSize);
-        buffer[bufferSize - 1] = '\0'; // Ensure null termination
-        return;
+    // Rows left over when fewer lanes are reported (e.g. a lane was disabled) go back to "-"
+    for (size_t i = laneData.size(); i < race_data_table_.GetRowCount(); i++) {
+        for (int j = 0; j < NUM_COLS; j++) {
+            race_data_table_.SetCell(static_cast<uint8_t>(i), static_cast<uint8_t>(j), "-");
+        }
     }
-    
-    snprintf(buffer, bufferSize, "%02" PRIu32 ":%02" PRIu32 ".%03" PRIu32, 
-             minutes, seconds, milliseconds);
-    
-    // Ensure null termination in case of truncation
-    buffer[bufferSize - 1] = '\0';
 }
 
-LapsRaceUI::LapsRaceUI(uint8_t numLanes) : numLanes_(numLanes) {
-    // Initialize all row containers to nullptr
-    for (auto& row : row_containers_) {
-        row = nullptr;
-    }
+void LapsRaceUI::ResetRaceData() {
+    // Same row count, every cell back to "-"
+    race_data_table_.SetRowCount(race_data_table_.GetRowCount());
+}
+
+LapsRaceUI::LapsRaceUI(uint8_t numLanes) : numLanes_(numLanes), container_(nullptr) {
 }
 
 LapsRaceUI::~LapsRaceUI() {
@@ -383,15 +189,10 @@ void TimerRaceUI::CreateUI(lv_obj_t* parent) {
     // Create the race data table first
     race_data_table_ = lv_obj_create(container_);
     lv_obj_remove_style_all(race_data_table_);  // Remove all styles first
+    lv_obj_add_style(race_data_table_, UITheme::FlexColumn(), 0);
     lv_obj_set_size(race_data_table_, lv_pct(98), lv_pct(75)); // Slightly smaller width and height for better margins
     lv_obj_align(race_data_table_, LV_ALIGN_TOP_MID, 0, 120);  // Start 120px from top to make room for title
-    lv_obj_set_style_pad_all(race_data_table_, 0, 0);
-    lv_obj_set_style_border_width(race_data_table_, 0, 0);
-    lv_obj_set_style_bg_opa(race_data_table_, LV_OPA_0, 0);
-    lv_obj_set_style_radius(race_data_table_, 0, 0);  // No rounded corners
-    lv_obj_set_flex_flow(race_data_table_, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_row(race_data_table_, 2, 0); // Add small gap between rows
-    lv_obj_set_style_pad_column(race_data_table_, 0, 0); // No horizontal padding between columns
     
     // Create table headers and initial rows
     DPRINTF("TimerRaceUI::CreateUI - Creating table headers and %d lane rows\n", numLanes_);
@@ -427,39 +228,20 @@ void TimerRaceUI::CreateTableHeaders() {
     // Create header row
     lv_obj_t* header_row = lv_obj_create(race_data_table_);
     lv_obj_remove_style_all(header_row);
-    lv_obj_set_size(header_row, lv_pct(100), 70); // Same height as data rows
-    lv_obj_set_style_bg_color(header_row, lv_color_hex(0x0a0a0a), 0); // Darker header background
-    lv_obj_set_style_bg_opa(header_row, LV_OPA_COVER, 0);
-    lv_obj_set_style_border_width(header_row, 0, 0);
-    lv_obj_set_style_pad_all(header_row, 0, 0);
-    lv_obj_set_style_pad_hor(header_row, 0, 0);
-    lv_obj_set_style_pad_ver(header_row, 0, 0);
-    lv_obj_set_flex_flow(header_row, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(header_row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    
-    // Add header labels with updated widths
+    lv_obj_add_style(header_row, UITheme::TimerHeaderRow(), 0);
+    
+    // Column widths come from the shared column styles
     const char* headers[] = {"Pos", "Lane", "Lap", "Last Lap", "Best Lap", "Current"};
-    const lv_coord_t widths[] = {10, 10, 15, 25, 25, 15}; // Percentages
     
-    for (int i = 0; i < 6; i++) {
+    for (int i = 0; i < NUM_COLS; i++) {
         lv_obj_t* col = lv_obj_create(header_row);
         lv_obj_remove_style_all(col);
-        lv_obj_set_size(col, lv_pct(widths[i]), lv_pct(100));
-        lv_obj_set_style_bg_opa(col, LV_OPA_0, 0);
-        lv_obj_set_style_border_width(col, 0, 0);
-        lv_obj_set_style_pad_all(col, 0, 0);
-        lv_obj_set_style_pad_hor(col, 2, 0);
-        lv_obj_set_style_pad_ver(col, 0, 0);
-        lv_obj_set_flex_flow(col, LV_FLEX_FLOW_ROW);
-        lv_obj_set_flex_align(col, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+        lv_obj_add_style(col, UITheme::TimerCell(), 0);
+        lv_obj_add_style(col, UITheme::TimerColumn(i), 0);
         
         lv_obj_t* label = lv_label_create(col);
+        lv_obj_add_style(label, UITheme::TimerHeaderLabel(), 0);
         lv_label_set_text(label, headers[i]);
-        lv_obj_set_style_text_color(label, lv_color_hex(0x4fc3f7), 0); // Light blue header text
-        lv_obj_set_style_text_font(label, &lv_font_montserrat_24, 0);
-        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
-        lv_obj_set_style_text_letter_space(label, 1, 0);
-        lv_obj_center(label);
     }
 }
 
@@ -476,50 +258,67 @@ void TimerRaceUI::CreateLaneRows(int numLanes) {
         // Create row container
         lv_obj_t* row = lv_obj_create(race_data_table_);
         lv_obj_remove_style_all(row);
-        lv_obj_set_size(row, lv_pct(100), 70); // Increased row height to 70px
-        lv_obj_set_style_bg_color(row, lv_color_hex(i % 2 ? 0x111111 : 0x1a1a1a), 0);
-        lv_obj_set_style_bg_opa(row, LV_OPA_COVER, 0);
-        lv_obj_set_style_border_width(row, 0, 0);
-        lv_obj_set_style_pad_all(row, 0, 0);
-        lv_obj_set_style_pad_hor(row, 0, 0);
-        lv_obj_set_style_pad_ver(row, 0, 0);
-        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
-        lv_obj_set_flex_align(row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+        lv_obj_add_style(row, UITheme::TimerRow(), 0);
+        lv_obj_add_style(row, i % 2 ? UITheme::TimerRowOdd() : UITheme::TimerRowEven(), 0);
         
         // Store the row in our array for easy access later
         row_containers_[i] = row;
         
-        // Create cells for each column with updated widths
-        const lv_coord_t widths[] = {10, 10, 15, 25, 25, 15}; // Same as headers
-        
-        // Placeholders for each column: Pos, Lane, Lap, Last Lap, Best Lap, Current
-        const char* placeholders[] = {
-            "-",                  // Position
-            String(i+1).c_str(),  // Lane number
-            "0/0",               // Lap count/total
-            "--:--:---",         // Last lap time
-            "--:--:---",         // Best lap time
-            "--:--"              // Current time
-        };
-        
         for (int j = 0; j < NUM_COLS; j++) {
             lv_obj_t* cell = lv_obj_create(row);
             lv_obj_remove_style_all(cell);
-            lv_obj_set_size(cell, lv_pct(widths[j]), lv_pct(100));
-            lv_obj_set_style_bg_opa(cell, LV_OPA_0, 0);
-            lv_obj_set_style_border_width(cell, 0, 0);
-            lv_obj_set_style_pad_all(cell, 0, 0);
-            lv_obj_set_style_pad_hor(cell, 2, 0);
-            lv_obj_set_style_pad_ver(cell, 0, 0);
-            lv_obj_set_flex_flow(cell, LV_FLEX_FLOW_ROW);
-            lv_obj_set_flex_align(cell, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+            lv_obj_add_style(cell, UITheme::TimerCell(), 0);
+            lv_obj_add_style(cell, UITheme::TimerColumn(j), 0);
             
-            lv_obj_t* label = lv_label_create(cell);
-            lv_label_set_text(label, placeholders[j]);
-            lv_obj_set_style_text_color(label, lv_color_white(), 0);
-            lv_obj_set_style_text_font(label, &lv_font_montserrat_24, 0);
-            lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
-            lv_obj_center(label);
+            lv_obj_t* label = j >= COL_LAST_LAP ? time_labels_[i][j - COL_LAST_LAP].Create(cell)
+                                                : lv_label_create(cell);
+            lv_obj_add_style(label, UITheme::TimerLabel(), 0);
+        }
+        
+        SetRowPlaceholders(i);
+    }
+}
+
+void TimerRaceUI::SetRowPlaceholders(int rowIndex) {
+    lv_obj_t* row = row_containers_[rowIndex];
+    if (!row) return;
+    
+    // Placeholders for each column: Pos, Lane, Lap, Last Lap, Best Lap, Current
+    TimeString laneText;
+    laneText.appendInt(rowIndex + 1);
+    const char* placeholders[] = {
+        "-",                 // Position
+        laneText.c_str(),    // Lane number
+        "0/0",               // Lap count/total
+        "--:--:---",         // Last lap time
+        "--:--:---",         // Best lap time
+        "--:--"              // Current time
+    };
+    
+    for (int j = 0; j < NUM_COLS; j++) {
+        SetCellText(rowIndex, j, placeholders[j]);
+    }
+}
+
+void TimerRaceUI::SetCellText(int rowIndex, int column, const char* text) {
+    if (column >= COL_LAST_LAP) {
+        time_labels_[rowIndex][column - COL_LAST_LAP].SetText(text);
+        return;
+    }
+    
+    // Each cell is a child of the row, and each label is a child of the cell
+    lv_obj_t* cell = lv_obj_get_child(row_containers_[rowIndex], column);
+    lv_obj_t* label = cell ? lv_obj_get_child(cell, 0) : nullptr;
+    if (label) {
+        lv_label_set_text(label, text);
+    }
+}
+
+void TimerRaceUI::ResetRaceData() {
+    for (int i = 0; i < numLanes_ && i < static_cast<int>(row_containers_.size()); i++) {
+        if (row_containers_[i]) {
+            lv_obj_clear_flag(row_containers_[i], LV_OBJ_FLAG_HIDDEN);
+            SetRowPlaceholders(i);
         }
     }
 }
@@ -559,71 +358,30 @@ void TimerRaceUI::UpdateRaceData(const std::vector<RaceLaneData>& laneData) {
         // Make the row visible
         lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
         
-        // Format the data for display
-        String posText = String(lane.position);
-        String laneText = String(lane.laneId);
+        // Format the data for display, without printf or the heap
+        TimeString posText;
+        TimeString laneText;
+        TimeString lapText;
+        posText.appendInt(lane.position);
+        laneText.appendInt(lane.laneId);
+        lapText.appendInt(lane.currentLap).append('/').appendInt(lane.totalLaps);
         
-        // Format lap count as x/y
-        String lapText = String(lane.currentLap) + "/" + String(lane.totalLaps);
-        
-        // Format last lap time (MM:SS:mmm)
-        char lastLapBuffer[16];
-        if (lane.lastLapTime > 0) {
-            uint32_t lastLapMs = lane.lastLapTime;
-            uint32_t lastLapMin = (lastLapMs / 60000);
-            uint32_t lastLapSec = (lastLapMs / 1000) % 60;
-            uint32_t lastLapMillis = lastLapMs % 1000;
-            snprintf(lastLapBuffer, sizeof(lastLapBuffer), "%02" PRIu32 ":%02" PRIu32 ".%03" PRIu32, 
-                     lastLapMin, lastLapSec, lastLapMillis);
-        } else {
-            strncpy(lastLapBuffer, "--:--.---", sizeof(lastLapBuffer));
-        }
-        
-        // Format best lap time (MM:SS:mmm)
-        char bestLapBuffer[16];
-        if (lane.bestLapTime > 0) {
-            uint32_t bestLapMs = lane.bestLapTime;
-            uint32_t bestLapMin = (bestLapMs / 60000);
-            uint32_t bestLapSec = (bestLapMs / 1000) % 60;
-            uint32_t bestLapMillis = bestLapMs % 1000;
-            snprintf(bestLapBuffer, sizeof(bestLapBuffer), "%02" PRIu32 ":%02" PRIu32 ".%03" PRIu32, 
-                     bestLapMin, bestLapSec, bestLapMillis);
-        } else {
-            strncpy(bestLapBuffer, "--:--.---", sizeof(bestLapBuffer));
-        }
-        
-        // Format current time (MM:SS)
-        char currentTimeBuffer[16];
-        if (lane.totalTime > 0) {
-            uint32_t totalMs = lane.totalTime;
-            uint32_t totalMin = (totalMs / 60000);
-            uint32_t totalSec = (totalMs / 1000) % 60;
-            snprintf(currentTimeBuffer, sizeof(currentTimeBuffer), "%02" PRIu32 ":%02" PRIu32, 
-                     totalMin, totalSec);
-        } else {
-            strncpy(currentTimeBuffer, "00:00", sizeof(currentTimeBuffer));
-        }
+        TimeString lastLapText = lane.lastLapTime > 0 ? formatTimeMMSSmmm(lane.lastLapTime) : TimeString("--:--.---");
+        TimeString bestLapText = lane.bestLapTime > 0 ? formatTimeMMSSmmm(lane.bestLapTime) : TimeString("--:--.---");
+        TimeString currentTimeText = lane.totalTime > 0 ? formatTimeMMSS(lane.totalTime) : TimeString("00:00");
         
         // Update the cell labels with all required fields
         const char* values[] = {
             posText.c_str(),       // Position
             laneText.c_str(),      // Lane number
             lapText.c_str(),       // Lap count/total
-            lastLapBuffer,         // Last lap time
-            bestLapBuffer,         // Best lap time
-            currentTimeBuffer      // Current time
+            lastLapText.c_str(),   // Last lap time
+            bestLapText.c_str(),   // Best lap time
+            currentTimeText.c_str() // Current time
         };
         
-        // Get each cell and update its label
         for (int j = 0; j < NUM_COLS; j++) {
-            // Each cell is a child of the row, and each label is a child of the cell
-            lv_obj_t* cell = lv_obj_get_child(row, j);
-            if (!cell) continue;
-            
-            lv_obj_t* label = lv_obj_get_child(cell, 0);
-            if (!label) continue;
-            
-            lv_label_set_text(label, values[j]);
+            SetCellText(rowIndex, j, values[j]);
         }
     }
 }
@@ -739,7 +497,14 @@ void RaceScreen::SetNumLanes(uint8_t numLanes) {
         }
     }
     
-    // If we have a current mode UI, recreate its UI with the new number of lanes
+    // Cached UIs were built for the old lane count: drop the inactive ones
+    // (rebuilt on next use) and rebuild the current one
+    for (auto& pair : modeUIs_) {
+        if (pair.second && pair.first != currentMode_) {
+            pair.second->Cleanup();
+        }
+    }
+    
     auto it = modeUIs_.find(currentMode_);
     if (it != modeUIs_.end() && it->second) {
         DPRINTF("RaceScreen::SetNumLanes - Recreating UI for current mode %d with %d lanes\n", 
@@ -837,13 +602,11 @@ void RaceScreen::SetRaceMode(RaceMode mode) {
         return;
     }
     
-    // Clean up current mode UI if it exists
+    // Hide the current mode UI; it stays built so switching back is instant
     auto it = modeUIs_.find(currentMode_);
-    if (it != modeUIs_.end() && it->second) {
-        DPRINTLN("RaceScreen::SetRaceMode - Cleaning up current mode UI");
-        it->second->Cleanup();
-    } else {
-        DPRINTLN("RaceScreen::SetRaceMode - No current mode UI to clean up");
+    if (it != modeUIs_.end() && it->second && it->second->GetContainer()) {
+        DPRINTLN("RaceScreen::SetRaceMode - Hiding current mode UI");
+        lv_obj_add_flag(it->second->GetContainer(), LV_OBJ_FLAG_HIDDEN);
     }
     
     // Set new mode
@@ -864,16 +627,30 @@ void RaceScreen::SetRaceMode(RaceMode mode) {
         lv_label_set_text(title_label_, modeText);
     }
     
-    // Create new mode UI
-    it = modeUIs_.find(mode);
-    if (it != modeUIs_.end() && it->second) {
-        DPRINTF("RaceScreen::SetRaceMode - Creating UI for mode %s with %d lanes\n", modeText, numLanes_);
-        // Set the number of lanes before creating the UI
-        it->second->SetNumLanes(numLanes_);
-        it->second->CreateUI(screen_);
-    } else {
-        DPRINTF("RaceScreen::SetRaceMode - No UI found for mode %d\n", static_cast<int>(mode));
+    // Show the new mode UI, building it on first use
+    ShowModeUI(mode);
+}
+
+void RaceScreen::ShowModeUI(RaceMode mode) {
+    auto it = modeUIs_.find(mode);
+    if (it == modeUIs_.end() || !it->second) {
+        DPRINTF("RaceScreen::ShowModeUI - No UI found for mode %d\n", static_cast<int>(mode));
+        return;
+    }
+    
+    RaceModeUI* ui = it->second.get();
+    if (ui->GetContainer()) {
+        DPRINTF("RaceScreen::ShowModeUI - Reusing cached UI for mode %d\n", static_cast<int>(mode));
+        // Drop the previous race's values; the next updateRaceData() fills it in
+        ui->ResetRaceData();
+        lv_obj_clear_flag(ui->GetContainer(), LV_OBJ_FLAG_HIDDEN);
+        return;
     }
+    
+    DPRINTF("RaceScreen::ShowModeUI - Creating UI for mode %d with %d lanes\n", static_cast<int>(mode), numLanes_);
+    // Set the number of lanes before creating the UI
+    ui->SetNumLanes(numLanes_);
+    ui->CreateUI(screen_);
 }
 
 void RaceScreen::Show() {
@@ -883,32 +660,20 @@ void RaceScreen::Show() {
     }
     
     DPRINTF("RaceScreen::Show - Showing screen (current mode: %d)\n", static_cast<int>(currentMode_));
+    LvglMemory::getInstance().beginScreen("Race");
     
-    // Load the screen
-    lv_scr_load(screen_);
-    DPRINTLN("RaceScreen::Show - Screen loaded");
+    // Make sure the current mode UI exists (cached after the first show)
+    ShowModeUI(currentMode_);
     
-    // Make sure the current mode UI is created
-    auto it = modeUIs_.find(currentMode_);
-    if (it != modeUIs_.end() && it->second) {
-        DPRINTF("RaceScreen::Show - Ensuring UI is created for mode %d\n", static_cast<int>(currentMode_));
-        if (!lv_obj_get_parent(it->second->GetContainer())) {
-            DPRINTLN("RaceScreen::Show - Recreating UI for current mode");
-            it->second->CreateUI(screen_);
-        } else {
-            DPRINTLN("RaceScreen::Show - UI already exists, not recreating");
-        }
-    } else {
-        DPRINTF("RaceScreen::Show - No UI found for current mode %d\n", static_cast<int>(currentMode_));
+    // Switch to the screen; the next timer cycle renders it
+    if (lv_scr_act() != screen_) {
+        lv_scr_load(screen_);
     }
+    DPRINTLN("RaceScreen::Show - Screen loaded");
 }
 
 void RaceScreen::Hide() {
-    // Clean up the current mode UI when hiding
-    auto it = modeUIs_.find(currentMode_);
-    if (it != modeUIs_.end() && it->second) {
-        it->second->Cleanup();
-    }
+    // Mode UIs stay cached with the screen; nothing to tear down
 }
 
 void RaceScreen::Update() {
@@ -10,7 +10,10 @@
 #include "../../../common/TimeManager.h"         // For timestamp
 #include "../../../common/Types.h"               // For RaceMode
 #include "../../../common/DebugUtils.h"          // For DPRINTLN
+#include "../../../common/FixedString.h"         // For TimeString
 #include "../../../RaceModule/RaceModule.h"      // For RaceLaneData
+#include "../widgets/LeaderboardTable.h"
+#include "../widgets/TimeLabel.h"
 
 // Forward declarations
 class RaceModeUI;
@@ -38,7 +41,7 @@ public:
     void Show();
     
     /**
-     * @brief Hide the race screen
+     * @brief Hide the race screen (mode UIs stay cached)
      */
     void Hide();
     
@@ -81,6 +84,12 @@ private:
     // Common UI creation
     void CreateCommonUI();
     
+    /**
+     * @brief Unhide the cached UI for a mode, building it on first use
+     * @param mode The race mode to show
+     */
+    void ShowModeUI(RaceMode mode);
+    
     // Button event callbacks
     static void StopButtonCallback(lv_event_t* e);
     static void PauseButtonCallback(lv_event_t* e);
@@ -139,6 +148,14 @@ public:
      * @param laneData Vector of lane data to display
      */
     virtual void UpdateRaceData(const std::vector<RaceLaneData>& laneData) = 0;
+    
+    /**
+     * @brief Put every lane row back to its placeholder text
+     * 
+     * Called when a cached UI is shown again, so values from the previous
+     * race are not on screen until the next UpdateRaceData().
+     */
+    virtual void ResetRaceData() {}
 };
 
 // Implementations for specific race modes
@@ -168,11 +185,14 @@ private:
      * @param laneData Vector of lane data to display
      */
     void UpdateRaceData(const std::vector<RaceLaneData>& laneData) override;
+    void ResetRaceData() override;
     
 private:
     // LAPS mode specific UI elements
     lv_obj_t* container_;
-    lv_obj_t* race_data_table_;
+    
+    // Single-object table drawing the header and all lane rows
+    LeaderboardTable race_data_table_;
     
     // Table column headers
     static constexpr int COL_POSITION = 0;
@@ -183,19 +203,16 @@ private:
     static constexpr int COL_TOTAL_TIME = 5;
     static constexpr int NUM_COLS = 6;
     
-    // Array to store row objects for easy access
-    std::array<lv_obj_t*, 8> row_containers_;
-    
     // Helper methods
     void CreateTableHeaders();
     void CreateLaneRows(int numLanes);
     void UpdateRowHeights(int numLanes);
-    static void FormatTime(char* buffer, size_t bufferSize, uint32_t timeMs);
 };
 
 class TimerRaceUI : public RaceModeUI {
 public:
-    explicit TimerRaceUI(uint8_t numLanes = 4) : numLanes_(numLanes) {
+    explicit TimerRaceUI(uint8_t numLanes = 4)
+        : numLanes_(numLanes), container_(nullptr), race_data_table_(nullptr) {
         // Initialize all row containers to nullptr
         for (auto& row : row_containers_) {
             row = nullptr;
@@ -224,6 +241,7 @@ private:
      * @param laneData Vector of lane data to display
      */
     void UpdateRaceData(const std::vector<RaceLaneData>& laneData) override;
+    void ResetRaceData() override;
 
 private:
     // TIMER mode specific UI elements
@@ -238,18 +256,24 @@ private:
     static constexpr int COL_BEST_LAP = 4;
     static constexpr int COL_CURRENT_TIME = 5;
     static constexpr int NUM_COLS = 6;
+    static constexpr int NUM_TIME_COLS = NUM_COLS - COL_LAST_LAP;
     
     // Array to store row objects for easy access
     std::array<lv_obj_t*, 8> row_containers_;
     
+    // The time columns are drawn from the digit atlas
+    std::array<std::array<TimeLabel, NUM_TIME_COLS>, 8> time_labels_;
+    
     // Helper methods
     void CreateTableHeaders();
     void CreateLaneRows(int numLanes);
+    void SetRowPlaceholders(int rowIndex);
+    void SetCellText(int rowIndex, int column, const char* text);
 };
 
 class DragRaceUI : public RaceModeUI {
 public:
-    explicit DragRaceUI(uint8_t numLanes = 4) : numLanes_(numLanes) {}
+    explicit DragRaceUI(uint8_t numLanes = 4) : numLanes_(numLanes), container_(nullptr) {}
     ~DragRaceUI() override = default;
     
     void CreateUI(lv_obj_t* parent) override;
@@ -280,7 +304,7 @@ private:
 
 class RallyRaceUI : public RaceModeUI {
 public:
-    explicit RallyRaceUI(uint8_t numLanes = 4) : numLanes_(numLanes) {}
+    explicit RallyRaceUI(uint8_t numLanes = 4) : numLanes_(numLanes), container_(nullptr) {}
     ~RallyRaceUI() override = default;
     
     void CreateUI(lv_obj_t* parent) override;
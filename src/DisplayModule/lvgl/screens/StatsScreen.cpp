@@ -20,6 +20,7 @@ StatsScreen::~StatsScreen() {
 }
 
 void StatsScreen::Show() {
+    TrackMemory();
     if (!is_initialized_) {
         CreateUI();
         is_initialized_ = true;
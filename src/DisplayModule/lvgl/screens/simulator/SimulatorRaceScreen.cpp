@@ -2,6 +2,7 @@
 #include <cstdio>
 #include <cstring>
 #include "common/log_message.h"
+#include "common/FixedString.h"
 
 
 // Constructor
@@ -281,18 +282,14 @@ void SimulatorRaceScreen::updateRaceData() {
     }
 }
 
-// Format time as MM:SS:ms
+// Format time as MM:SS.mmm
 void SimulatorRaceScreen::formatTime(char* buffer, size_t bufferSize, uint32_t timeMs) {
-    if (timeMs == 0) {
-        snprintf(buffer, bufferSize, "--:--:--");
+    if (bufferSize == 0) {
         return;
     }
-    
-    uint32_t minutes = (timeMs / 60000) % 60;
-    uint32_t seconds = (timeMs / 1000) % 60;
-    uint32_t ms = timeMs % 1000;
-    
-    snprintf(buffer, bufferSize, "%02lu:%02lu:%03lu", minutes, seconds, ms);
+    TimeString text = timeMs == 0 ? TimeString("--:--.---") : formatTimeMMSSmmm(timeMs);
+    strncpy(buffer, text.c_str(), bufferSize - 1);
+    buffer[bufferSize - 1] = '\0';
 }
 
 // Stop button callback
@@ -0,0 +1,332 @@
+#include "LvglMemory.h"
+#include "lvgl_memory.h"
+#include <cstdlib>
+#include <cstring>
+#include "../../../common/DebugUtils.h"
+
+#ifdef ESP32
+#include <esp_heap_caps.h>
+#endif
+
+namespace {
+
+// Prefix of a heap block; two words keep the block as aligned as malloc's
+struct HeapHeader {
+    size_t size;
+    size_t reserved;
+};
+
+// The pools live in static RAM (internal RAM on the ESP32)
+alignas(8) uint8_t g_arena16[16 * LVGL_POOL_BLOCKS_16];
+alignas(8) uint8_t g_arena32[32 * LVGL_POOL_BLOCKS_32];
+alignas(8) uint8_t g_arena64[64 * LVGL_POOL_BLOCKS_64];
+alignas(8) uint8_t g_arena128[128 * LVGL_POOL_BLOCKS_128];
+alignas(8) uint8_t g_arena256[256 * LVGL_POOL_BLOCKS_256];
+
+uint16_t g_requested16[LVGL_POOL_BLOCKS_16];
+uint16_t g_requested32[LVGL_POOL_BLOCKS_32];
+uint16_t g_requested64[LVGL_POOL_BLOCKS_64];
+uint16_t g_requested128[LVGL_POOL_BLOCKS_128];
+uint16_t g_requested256[LVGL_POOL_BLOCKS_256];
+
+} // namespace
+
+// ===== LVGL hooks =====
+
+extern "C" void* lvgl_memory_alloc(size_t size) {
+    return LvglMemory::getInstance().allocate(size);
+}
+
+extern "C" void lvgl_memory_free(void* ptr) {
+    LvglMemory::getInstance().release(ptr);
+}
+
+extern "C" void* lvgl_memory_realloc(void* ptr, size_t size) {
+    return LvglMemory::getInstance().reallocate(ptr, size);
+}
+
+// ===== LvglMemory =====
+
+LvglMemory& LvglMemory::getInstance() {
+    static LvglMemory instance;
+    return instance;
+}
+
+LvglMemory::LvglMemory()
+    : _bytesInUse(0)
+    , _highWaterBytes(0)
+    , _largeBytesInUse(0)
+    , _largeHighWaterBytes(0)
+    , _poolBytesInUse(0)
+    , _slackBytes(0)
+    , _failedAllocations(0)
+    , _screenCount(0)
+    , _currentScreen(-1) {
+    static const struct {
+        uint8_t* arena;
+        uint16_t* requested;
+        uint16_t blockSize;
+        uint16_t blockCount;
+    } layout[LVGL_POOL_CLASSES] = {
+        {g_arena16, g_requested16, 16, LVGL_POOL_BLOCKS_16},
+        {g_arena32, g_requested32, 32, LVGL_POOL_BLOCKS_32},
+        {g_arena64, g_requested64, 64, LVGL_POOL_BLOCKS_64},
+        {g_arena128, g_requested128, 128, LVGL_POOL_BLOCKS_128},
+        {g_arena256, g_requested256, LVGL_POOL_MAX_BLOCK, LVGL_POOL_BLOCKS_256},
+    };
+
+    for (int i = 0; i < LVGL_POOL_CLASSES; i++) {
+        Pool& pool = _pools[i];
+        pool.begin = layout[i].arena;
+        pool.end = layout[i].arena + layout[i].blockSize * layout[i].blockCount;
+        pool.requested = layout[i].requested;
+        pool.stats = {layout[i].blockSize, layout[i].blockCount, 0, 0, 0};
+
+        // Thread the free list through the blocks, lowest address first
+        pool.freeList = nullptr;
+        for (int block = pool.stats.blockCount - 1; block >= 0; block--) {
+            void** next = (void**)(pool.begin + block * pool.stats.blockSize);
+            *next = pool.freeList;
+            pool.freeList = next;
+        }
+    }
+    memset(_screens, 0, sizeof(_screens));
+}
+
+LvglMemory::Pool* LvglMemory::findPool(const void* ptr) {
+    const uint8_t* address = (const uint8_t*)ptr;
+    for (Pool& pool : _pools) {
+        if (address >= pool.begin && address < pool.end) {
+            return &pool;
+        }
+    }
+    return nullptr;
+}
+
+void* LvglMemory::allocate(size_t size) {
+    bool overflow = false;
+    if (size <= LVGL_POOL_MAX_BLOCK) {
+        for (Pool& pool : _pools) {
+            if (size > pool.stats.blockSize) {
+                continue;
+            }
+            if (pool.freeList == nullptr) {
+                // Full: spill to the heap rather than take a block of the next class
+                pool.stats.overflows++;
+                overflow = true;
+                break;
+            }
+
+            void* block = pool.freeList;
+            pool.freeList = *(void**)block;
+            pool.requested[((uint8_t*)block - pool.begin) / pool.stats.blockSize] = (uint16_t)size;
+            pool.stats.inUse++;
+            if (pool.stats.inUse > pool.stats.highWater) {
+                pool.stats.highWater = pool.stats.inUse;
+            }
+            _poolBytesInUse += pool.stats.blockSize;
+            _slackBytes += pool.stats.blockSize - size;
+            _bytesInUse += size;
+            recordAllocation(false);
+            return block;
+        }
+    }
+
+    void* block = allocateLarge(size);
+    if (block == nullptr) {
+        _failedAllocations++;
+        return nullptr;
+    }
+    recordAllocation(overflow);
+    return block;
+}
+
+void* LvglMemory::allocateLarge(size_t size) {
+    size_t total = sizeof(HeapHeader) + size;
+#ifdef ESP32
+    // Draw buffers, images and long texts go to PSRAM; small spills stay internal
+    void* raw = nullptr;
+    if (size > LVGL_POOL_MAX_BLOCK) {
+        raw = heap_caps_malloc(total, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (raw == nullptr) {
+        raw = heap_caps_malloc(total, MALLOC_CAP_8BIT);
+    }
+#else
+    void* raw = malloc(total);
+#endif
+    if (raw == nullptr) {
+        return nullptr;
+    }
+
+    HeapHeader* header = (HeapHeader*)raw;
+    header->size = size;
+    _largeBytesInUse += size;
+    _bytesInUse += size;
+    return header + 1;
+}
+
+size_t LvglMemory::usableSize(const void* ptr) {
+    Pool* pool = findPool(ptr);
+    if (pool) {
+        return pool->requested[((const uint8_t*)ptr - pool->begin) / pool->stats.blockSize];
+    }
+    return ((const HeapHeader*)ptr - 1)->size;
+}
+
+void LvglMemory::release(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    Pool* pool = findPool(ptr);
+    if (pool) {
+        size_t requested = pool->requested[((uint8_t*)ptr - pool->begin) / pool->stats.blockSize];
+        *(void**)ptr = pool->freeList;
+        pool->freeList = ptr;
+        pool->stats.inUse--;
+        _poolBytesInUse -= pool->stats.blockSize;
+        _slackBytes -= pool->stats.blockSize - requested;
+        _bytesInUse -= requested;
+        return;
+    }
+
+    HeapHeader* header = (HeapHeader*)ptr - 1;
+    _largeBytesInUse -= header->size;
+    _bytesInUse -= header->size;
+    free(header);
+}
+
+void* LvglMemory::reallocate(void* ptr, size_t size) {
+    if (ptr == nullptr) {
+        return allocate(size);
+    }
+
+    // Label texts are resized in place while they fit the block
+    Pool* pool = findPool(ptr);
+    if (pool && size <= pool->stats.blockSize) {
+        uint16_t& requested = pool->requested[((uint8_t*)ptr - pool->begin) / pool->stats.blockSize];
+        _slackBytes = _slackBytes + requested - size;
+        _bytesInUse = _bytesInUse - requested + size;
+        requested = (uint16_t)size;
+        recordUsage();
+        return ptr;
+    }
+
+    size_t oldSize = usableSize(ptr);
+    void* block = allocate(size);
+    if (block == nullptr) {
+        return nullptr;
+    }
+    memcpy(block, ptr, oldSize < size ? oldSize : size);
+    release(ptr);
+    return block;
+}
+
+void LvglMemory::recordAllocation(bool overflow) {
+    if (_currentScreen >= 0) {
+        LvglScreenMemoryStats& screen = _screens[_currentScreen];
+        screen.allocations++;
+        if (overflow) {
+            screen.overflows++;
+        }
+    }
+    recordUsage();
+}
+
+void LvglMemory::recordUsage() {
+    if (_bytesInUse > _highWaterBytes) {
+        _highWaterBytes = _bytesInUse;
+    }
+    if (_largeBytesInUse > _largeHighWaterBytes) {
+        _largeHighWaterBytes = _largeBytesInUse;
+    }
+    if (_currentScreen >= 0) {
+        LvglScreenMemoryStats& screen = _screens[_currentScreen];
+        if (_bytesInUse > screen.peakBytes) {
+            screen.peakBytes = _bytesInUse;
+            screen.peakSlackPercent = getSlackPercent();
+        }
+        if (_largeBytesInUse > screen.peakLargeBytes) {
+            screen.peakLargeBytes = _largeBytesInUse;
+        }
+    }
+}
+
+uint8_t LvglMemory::getSlackPercent() const {
+    if (_poolBytesInUse == 0) {
+        return 0;
+    }
+    return (uint8_t)(_slackBytes * 100 / _poolBytesInUse);
+}
+
+void LvglMemory::beginScreen(const char* name) {
+    if (name == nullptr) {
+        name = "";
+    }
+    if (_currentScreen >= 0 &&
+        strncmp(_screens[_currentScreen].name, name, LVGL_MEMORY_SCREEN_NAME - 1) == 0) {
+        return;
+    }
+    if (_currentScreen >= 0) {
+        printScreen(_screens[_currentScreen]);
+    }
+
+    _currentScreen = -1;
+    for (int i = 0; i < _screenCount; i++) {
+        if (strncmp(_screens[i].name, name, LVGL_MEMORY_SCREEN_NAME - 1) == 0) {
+            _currentScreen = i;
+            break;
+        }
+    }
+    if (_currentScreen < 0 && _screenCount < LVGL_MEMORY_MAX_SCREENS) {
+        _currentScreen = _screenCount++;
+        LvglScreenMemoryStats& screen = _screens[_currentScreen];
+        memset(&screen, 0, sizeof(screen));
+        strncpy(screen.name, name, LVGL_MEMORY_SCREEN_NAME - 1);
+    }
+    if (_currentScreen < 0) {
+        return;
+    }
+
+    // What is still allocated counts toward the new screen as well
+    _screens[_currentScreen].activations++;
+    recordUsage();
+}
+
+void LvglMemory::resetScreenStats() {
+    memset(_screens, 0, sizeof(_screens));
+    _screenCount = 0;
+    _currentScreen = -1;
+}
+
+const LvglScreenMemoryStats* LvglMemory::findScreenStats(const char* name) const {
+    for (int i = 0; i < _screenCount; i++) {
+        if (strncmp(_screens[i].name, name, LVGL_MEMORY_SCREEN_NAME - 1) == 0) {
+            return &_screens[i];
+        }
+    }
+    return nullptr;
+}
+
+void LvglMemory::printScreen(const LvglScreenMemoryStats& screen) const {
+    (void)screen; // Unused when DEBUG_LEVEL is 0
+    DPRINTF("LVGL memory [%s]: peak %u B (heap %u B), %u allocs, %u overflows, slack %u%%\n",
+            screen.name, (unsigned)screen.peakBytes, (unsigned)screen.peakLargeBytes,
+            (unsigned)screen.allocations, (unsigned)screen.overflows, (unsigned)screen.peakSlackPercent);
+}
+
+void LvglMemory::printReport() const {
+    DPRINTF("LVGL memory: %u B in use (high water %u B), heap %u B (high water %u B), slack %u%%, %u failed\n",
+            (unsigned)_bytesInUse, (unsigned)_highWaterBytes, (unsigned)_largeBytesInUse,
+            (unsigned)_largeHighWaterBytes, (unsigned)getSlackPercent(), (unsigned)_failedAllocations);
+    for (int i = 0; i < LVGL_POOL_CLASSES; i++) {
+        DPRINTF("  %3u B blocks: %u/%u in use, high water %u, %u overflows\n",
+                (unsigned)_pools[i].stats.blockSize, (unsigned)_pools[i].stats.inUse,
+                (unsigned)_pools[i].stats.blockCount, (unsigned)_pools[i].stats.highWater,
+                (unsigned)_pools[i].stats.overflows);
+    }
+    for (int i = 0; i < _screenCount; i++) {
+        printScreen(_screens[i]);
+    }
+}
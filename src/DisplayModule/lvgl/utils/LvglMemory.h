@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Blocks per size class. Small LVGL allocations (objects, styles, label
+// text, event lists) are served from these pools in internal RAM; the
+// totals are the memory to budget for the UI's small objects.
+#ifndef LVGL_POOL_BLOCKS_16
+#define LVGL_POOL_BLOCKS_16 256
+#endif
+#ifndef LVGL_POOL_BLOCKS_32
+#define LVGL_POOL_BLOCKS_32 384
+#endif
+#ifndef LVGL_POOL_BLOCKS_64
+#define LVGL_POOL_BLOCKS_64 192
+#endif
+#ifndef LVGL_POOL_BLOCKS_128
+#define LVGL_POOL_BLOCKS_128 64
+#endif
+#ifndef LVGL_POOL_BLOCKS_256
+#define LVGL_POOL_BLOCKS_256 16
+#endif
+
+#define LVGL_POOL_CLASSES 5
+#define LVGL_POOL_MAX_BLOCK 256
+
+// Screens tracked separately; later ones are counted only in the totals
+#define LVGL_MEMORY_MAX_SCREENS 12
+#define LVGL_MEMORY_SCREEN_NAME 24
+
+/**
+ * @brief Usage of one size-class pool
+ */
+struct LvglPoolStats {
+    uint16_t blockSize;     // Bytes per block
+    uint16_t blockCount;    // Blocks in the pool
+    uint16_t inUse;         // Blocks allocated now
+    uint16_t highWater;     // Most blocks allocated at once
+    uint32_t overflows;     // Requests of this size served from the heap because the pool was full
+};
+
+/**
+ * @brief LVGL memory use while one screen was shown
+ */
+struct LvglScreenMemoryStats {
+    char name[LVGL_MEMORY_SCREEN_NAME];
+    uint32_t activations;       // Times the screen was shown
+    uint32_t allocations;       // LVGL allocations while shown
+    uint32_t overflows;         // Small allocations that fell back to the heap
+    size_t peakBytes;           // Most bytes in use while shown
+    size_t peakLargeBytes;      // Most heap (large block) bytes in use while shown
+    uint8_t peakSlackPercent;   // Pool fragmentation when peakBytes was reached
+};
+
+/**
+ * @brief Allocator behind LVGL's lv_mem_alloc/free/realloc (LV_MEM_CUSTOM)
+ *
+ * Requests up to LVGL_POOL_MAX_BLOCK bytes come from fixed size-class pools
+ * with an intrusive free list, so allocating and freeing is constant time
+ * and rebuilding a screen's objects cannot fragment the memory the way a
+ * general-purpose heap does. Larger buffers (and small requests whose pool
+ * is full) go to the system heap, in PSRAM on the ESP32 when it has any.
+ *
+ * Usage is recorded in total, per size class and per screen: screens call
+ * beginScreen() when they are shown, and until the next screen everything
+ * LVGL allocates counts toward that one. The peak bytes per screen is the
+ * memory that screen needs; the slack (requested size rounded up to the
+ * size class) is the pools' only fragmentation.
+ *
+ * LVGL runs on a single thread, so the allocator takes no locks.
+ */
+class LvglMemory {
+public:
+    /**
+     * @brief Get the singleton instance
+     */
+    static LvglMemory& getInstance();
+
+    /**
+     * @brief Allocate a block for LVGL
+     *
+     * @param size Bytes requested
+     * @return The block, or nullptr if both the pool and the heap are exhausted
+     */
+    void* allocate(size_t size);
+
+    /**
+     * @brief Free a block from allocate() or reallocate(); nullptr is ignored
+     */
+    void release(void* ptr);
+
+    /**
+     * @brief Resize a block, keeping its contents
+     *
+     * A pool block is returned unchanged while the new size still fits its
+     * size class.
+     *
+     * @param ptr Block to resize (nullptr allocates a new one)
+     * @param size New size in bytes
+     * @return The block, or nullptr if it cannot grow (ptr stays valid)
+     */
+    void* reallocate(void* ptr, size_t size);
+
+    /**
+     * @brief Attribute following allocations to a screen
+     *
+     * Called when a screen is shown. Showing the screen that is already
+     * current does nothing.
+     *
+     * @param name Screen name (copied; truncated to LVGL_MEMORY_SCREEN_NAME - 1)
+     */
+    void beginScreen(const char* name);
+
+    /**
+     * @brief Forget the per-screen records and start counting from now
+     */
+    void resetScreenStats();
+
+    // Totals
+    size_t getBytesInUse() const { return _bytesInUse; }
+    size_t getHighWaterBytes() const { return _highWaterBytes; }
+    size_t getLargeBytesInUse() const { return _largeBytesInUse; }
+    size_t getLargeHighWaterBytes() const { return _largeHighWaterBytes; }
+    uint32_t getFailedAllocations() const { return _failedAllocations; }
+
+    /**
+     * @brief Pool bytes lost to rounding requests up to their size class
+     */
+    size_t getSlackBytes() const { return _slackBytes; }
+
+    /**
+     * @brief Slack as a percentage of the pool bytes in use
+     */
+    uint8_t getSlackPercent() const;
+
+    // Size classes, smallest first
+    int getPoolCount() const { return LVGL_POOL_CLASSES; }
+    const LvglPoolStats& getPoolStats(int index) const { return _pools[index].stats; }
+
+    // Screens, in the order they were first shown
+    int getScreenCount() const { return _screenCount; }
+    const LvglScreenMemoryStats& getScreenStats(int index) const { return _screens[index]; }
+
+    /**
+     * @brief Find a screen's record by name
+     *
+     * @return The record, or nullptr if the screen has not been shown
+     */
+    const LvglScreenMemoryStats* findScreenStats(const char* name) const;
+
+    /**
+     * @brief Print the totals, pools and screens to the debug output
+     */
+    void printReport() const;
+
+private:
+    struct Pool {
+        uint8_t* begin;
+        uint8_t* end;
+        void* freeList;
+        uint16_t* requested;    // Bytes requested per block, for the slack
+        LvglPoolStats stats;
+    };
+
+    LvglMemory();
+    LvglMemory(const LvglMemory&) = delete;
+    LvglMemory& operator=(const LvglMemory&) = delete;
+
+    Pool* findPool(const void* ptr);
+    void* allocateLarge(size_t size);
+    size_t usableSize(const void* ptr);
+    void recordAllocation(bool overflow);
+    void recordUsage();
+    void printScreen(const LvglScreenMemoryStats& screen) const;
+
+    Pool _pools[LVGL_POOL_CLASSES];
+    size_t _bytesInUse;
+    size_t _highWaterBytes;
+    size_t _largeBytesInUse;
+    size_t _largeHighWaterBytes;
+    size_t _poolBytesInUse;
+    size_t _slackBytes;
+    uint32_t _failedAllocations;
+
+    LvglScreenMemoryStats _screens[LVGL_MEMORY_MAX_SCREENS];
+    int _screenCount;
+    int _currentScreen;     // Index into _screens, -1 if none
+};
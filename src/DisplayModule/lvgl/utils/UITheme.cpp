@@ -0,0 +1,201 @@
+#include "UITheme.h"
+#include "ColorUtils.h"
+
+namespace {
+
+// Column widths of the TIMER table in percent: Pos, Lane, Lap, Last Lap, Best Lap, Current
+const lv_coord_t TIMER_COLUMN_WIDTH[UITheme::RACE_TABLE_COLUMNS] = {10, 10, 15, 25, 25, 15};
+
+void setFlexRow(lv_style_t* style, lv_flex_align_t mainPlace) {
+    lv_style_set_layout(style, LV_LAYOUT_FLEX);
+    lv_style_set_flex_flow(style, LV_FLEX_FLOW_ROW);
+    lv_style_set_flex_main_place(style, mainPlace);
+    lv_style_set_flex_cross_place(style, LV_FLEX_ALIGN_CENTER);
+    lv_style_set_flex_track_place(style, LV_FLEX_ALIGN_CENTER);
+}
+
+struct Styles {
+    lv_style_t flexColumn;
+    lv_style_t screen;
+    lv_style_t screenTitle;
+    lv_style_t contentContainer;
+    lv_style_t debugBorder;
+    lv_style_t debugGridLine;
+    lv_style_t debugGridLabel;
+    lv_style_t lapsHeaderRow;
+    lv_style_t lapsRow;
+    lv_style_t lapsRowEven;
+    lv_style_t lapsRowOdd;
+    lv_style_t lapsLabel;
+    lv_style_t timerHeaderRow;
+    lv_style_t timerRow;
+    lv_style_t timerRowEven;
+    lv_style_t timerRowOdd;
+    lv_style_t timerCell;
+    lv_style_t timerColumn[UITheme::RACE_TABLE_COLUMNS];
+    lv_style_t timerHeaderLabel;
+    lv_style_t timerLabel;
+    lv_style_t laneDisabled;
+    lv_style_t button;
+
+    Styles() {
+        lv_style_init(&flexColumn);
+        lv_style_set_bg_opa(&flexColumn, LV_OPA_0);
+        lv_style_set_border_width(&flexColumn, 0);
+        lv_style_set_radius(&flexColumn, 0);
+        lv_style_set_pad_all(&flexColumn, 0);
+        lv_style_set_layout(&flexColumn, LV_LAYOUT_FLEX);
+        lv_style_set_flex_flow(&flexColumn, LV_FLEX_FLOW_COLUMN);
+
+        // Screen layout
+        lv_style_init(&screen);
+        lv_style_set_bg_color(&screen, ColorUtils::Black());
+
+        lv_style_init(&screenTitle);
+        lv_style_set_text_font(&screenTitle, &lv_font_montserrat_32);
+        lv_style_set_text_color(&screenTitle, ColorUtils::White());
+
+        lv_style_init(&contentContainer);
+        lv_style_set_width(&contentContainer, lv_pct(100));
+        lv_style_set_height(&contentContainer, lv_pct(100));
+        lv_style_set_bg_opa(&contentContainer, LV_OPA_TRANSP);
+        lv_style_set_pad_all(&contentContainer, 10);
+        lv_style_set_pad_row(&contentContainer, 12);
+        lv_style_set_layout(&contentContainer, LV_LAYOUT_FLEX);
+        lv_style_set_flex_flow(&contentContainer, LV_FLEX_FLOW_COLUMN);
+        lv_style_set_flex_main_place(&contentContainer, LV_FLEX_ALIGN_START);
+        lv_style_set_flex_cross_place(&contentContainer, LV_FLEX_ALIGN_START);
+        lv_style_set_flex_track_place(&contentContainer, LV_FLEX_ALIGN_START);
+
+        lv_style_init(&debugBorder);
+        lv_style_set_border_width(&debugBorder, 2);
+        lv_style_set_border_color(&debugBorder, ColorUtils::White());
+        lv_style_set_bg_opa(&debugBorder, LV_OPA_0);
+
+        lv_style_init(&debugGridLine);
+        lv_style_set_line_color(&debugGridLine, ColorUtils::Red());
+        lv_style_set_line_width(&debugGridLine, 1);
+        lv_style_set_line_rounded(&debugGridLine, false);
+
+        lv_style_init(&debugGridLabel);
+        lv_style_set_text_color(&debugGridLabel, ColorUtils::Red());
+        lv_style_set_text_font(&debugGridLabel, &lv_font_montserrat_12);
+
+        // LAPS table: only backgrounds and text are used by LeaderboardTable
+        lv_style_init(&lapsHeaderRow);
+        lv_style_set_bg_color(&lapsHeaderRow, lv_color_hex(0x2C3E50)); // Dark blue header
+        lv_style_set_bg_opa(&lapsHeaderRow, LV_OPA_100);
+
+        lv_style_init(&lapsRow);
+        lv_style_set_bg_opa(&lapsRow, LV_OPA_30);
+
+        lv_style_init(&lapsRowEven);
+        lv_style_set_bg_color(&lapsRowEven, lv_color_hex(0x34495E));
+
+        lv_style_init(&lapsRowOdd);
+        lv_style_set_bg_color(&lapsRowOdd, lv_color_hex(0x2C3E50));
+
+        lv_style_init(&lapsLabel);
+        lv_style_set_text_color(&lapsLabel, ColorUtils::White());
+        lv_style_set_text_font(&lapsLabel, &lv_font_montserrat_12);
+        lv_style_set_text_align(&lapsLabel, LV_TEXT_ALIGN_CENTER);
+
+        // TIMER table
+        lv_style_init(&timerHeaderRow);
+        lv_style_set_width(&timerHeaderRow, lv_pct(100));
+        lv_style_set_height(&timerHeaderRow, 70); // Same height as data rows
+        lv_style_set_bg_color(&timerHeaderRow, lv_color_hex(0x0a0a0a)); // Darker header background
+        lv_style_set_bg_opa(&timerHeaderRow, LV_OPA_COVER);
+        setFlexRow(&timerHeaderRow, LV_FLEX_ALIGN_CENTER);
+
+        lv_style_init(&timerRow);
+        lv_style_set_width(&timerRow, lv_pct(100));
+        lv_style_set_height(&timerRow, 70);
+        lv_style_set_bg_opa(&timerRow, LV_OPA_COVER);
+        setFlexRow(&timerRow, LV_FLEX_ALIGN_CENTER);
+
+        lv_style_init(&timerRowEven);
+        lv_style_set_bg_color(&timerRowEven, lv_color_hex(0x1a1a1a));
+
+        lv_style_init(&timerRowOdd);
+        lv_style_set_bg_color(&timerRowOdd, lv_color_hex(0x111111));
+
+        lv_style_init(&timerCell);
+        lv_style_set_height(&timerCell, lv_pct(100));
+        lv_style_set_bg_opa(&timerCell, LV_OPA_0);
+        lv_style_set_pad_hor(&timerCell, 2);
+        setFlexRow(&timerCell, LV_FLEX_ALIGN_CENTER);
+
+        for (int i = 0; i < UITheme::RACE_TABLE_COLUMNS; i++) {
+            lv_style_init(&timerColumn[i]);
+            lv_style_set_width(&timerColumn[i], lv_pct(TIMER_COLUMN_WIDTH[i]));
+        }
+
+        lv_style_init(&timerHeaderLabel);
+        lv_style_set_text_color(&timerHeaderLabel, lv_color_hex(0x4fc3f7)); // Light blue header text
+        lv_style_set_text_font(&timerHeaderLabel, &lv_font_montserrat_24);
+        lv_style_set_text_align(&timerHeaderLabel, LV_TEXT_ALIGN_CENTER);
+        lv_style_set_text_letter_space(&timerHeaderLabel, 1);
+
+        lv_style_init(&timerLabel);
+        lv_style_set_text_color(&timerLabel, ColorUtils::White());
+        lv_style_set_text_font(&timerLabel, &lv_font_montserrat_24);
+        lv_style_set_text_align(&timerLabel, LV_TEXT_ALIGN_CENTER);
+
+        // Lane state
+        lv_style_init(&laneDisabled);
+        lv_style_set_text_opa(&laneDisabled, LV_OPA_50);
+
+        // Buttons
+        lv_style_init(&button);
+        lv_style_set_border_width(&button, 2);
+        lv_style_set_border_color(&button, ColorUtils::White()); // White border
+        lv_style_set_radius(&button, 10); // Rounded corners
+        lv_style_set_shadow_width(&button, 5);
+        lv_style_set_shadow_opa(&button, LV_OPA_50);
+    }
+};
+
+// Constructed on first use, i.e. after lv_init()
+Styles& styles() {
+    static Styles instance;
+    return instance;
+}
+
+int clampColumn(int column) {
+    if (column < 0) return 0;
+    if (column >= UITheme::RACE_TABLE_COLUMNS) return UITheme::RACE_TABLE_COLUMNS - 1;
+    return column;
+}
+
+} // namespace
+
+namespace UITheme {
+    lv_style_t* FlexColumn() { return &styles().flexColumn; }
+
+    lv_style_t* Screen() { return &styles().screen; }
+    lv_style_t* ScreenTitle() { return &styles().screenTitle; }
+    lv_style_t* ContentContainer() { return &styles().contentContainer; }
+    lv_style_t* DebugBorder() { return &styles().debugBorder; }
+    lv_style_t* DebugGridLine() { return &styles().debugGridLine; }
+    lv_style_t* DebugGridLabel() { return &styles().debugGridLabel; }
+
+    lv_style_t* LapsHeaderRow() { return &styles().lapsHeaderRow; }
+    lv_style_t* LapsRow() { return &styles().lapsRow; }
+    lv_style_t* LapsRowEven() { return &styles().lapsRowEven; }
+    lv_style_t* LapsRowOdd() { return &styles().lapsRowOdd; }
+    lv_style_t* LapsLabel() { return &styles().lapsLabel; }
+
+    lv_style_t* TimerHeaderRow() { return &styles().timerHeaderRow; }
+    lv_style_t* TimerRow() { return &styles().timerRow; }
+    lv_style_t* TimerRowEven() { return &styles().timerRowEven; }
+    lv_style_t* TimerRowOdd() { return &styles().timerRowOdd; }
+    lv_style_t* TimerCell() { return &styles().timerCell; }
+    lv_style_t* TimerColumn(int column) { return &styles().timerColumn[clampColumn(column)]; }
+    lv_style_t* TimerHeaderLabel() { return &styles().timerHeaderLabel; }
+    lv_style_t* TimerLabel() { return &styles().timerLabel; }
+
+    lv_style_t* LaneDisabled() { return &styles().laneDisabled; }
+
+    lv_style_t* Button() { return &styles().button; }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <lvgl.h>
+
+// Shared styles for the race screens and common widgets
+namespace UITheme {
+    // Styles are statically allocated and initialised on first use, then
+    // attached with lv_obj_add_style(). Objects only hold a pointer to the
+    // shared style, so building a screen does not allocate a local style
+    // list per object in the LVGL heap.
+
+    // Generic layout
+    lv_style_t* FlexColumn();        // Transparent, unpadded column container
+
+    // Screen layout (BaseScreen)
+    lv_style_t* Screen();            // Black screen background
+    lv_style_t* ScreenTitle();       // Large white title text
+    lv_style_t* ContentContainer();  // Padded column for screen content
+    lv_style_t* DebugBorder();       // White frame around layout regions
+    lv_style_t* DebugGridLine();     // Red grid lines
+    lv_style_t* DebugGridLabel();    // Red grid coordinate labels
+
+    // LAPS mode table (drawn by LeaderboardTable, which reads the row backgrounds)
+    lv_style_t* LapsHeaderRow();
+    lv_style_t* LapsRow();
+    lv_style_t* LapsRowEven();       // Background of even lane rows
+    lv_style_t* LapsRowOdd();        // Background of odd lane rows
+    lv_style_t* LapsLabel();
+
+    // TIMER mode table
+    lv_style_t* TimerHeaderRow();
+    lv_style_t* TimerRow();
+    lv_style_t* TimerRowEven();
+    lv_style_t* TimerRowOdd();
+    lv_style_t* TimerCell();
+    lv_style_t* TimerColumn(int column); // Width (percent) per column
+    lv_style_t* TimerHeaderLabel();
+    lv_style_t* TimerLabel();
+
+    // Lane state: text opacity of disabled lanes
+    lv_style_t* LaneDisabled();
+
+    // Buttons (createStandardButton); colours stay per button
+    lv_style_t* Button();
+
+    // Number of columns in the race tables
+    constexpr int RACE_TABLE_COLUMNS = 6;
+}
@@ -1,4 +1,5 @@
 #include "UIUtils.h"
+#include "UITheme.h"
 
 // Helper function to create a standardized button - can be reused across the program
 lv_obj_t* createStandardButton(lv_obj_t* parent, const char* label_text, 
@@ -11,14 +12,10 @@ lv_obj_t* createStandardButton(lv_obj_t* parent, const char* label_text,
     lv_obj_set_size(btn, width, height);
     lv_obj_set_pos(btn, x_pos, y_pos);
     
-    // Set button styles with custom colors
+    // Shared border/radius/shadow style; only the colors are set per button
+    lv_obj_add_style(btn, UITheme::Button(), LV_PART_MAIN | LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(btn, bg_color, LV_PART_MAIN | LV_STATE_DEFAULT); // Custom background
     lv_obj_set_style_bg_color(btn, pressed_color, LV_PART_MAIN | LV_STATE_PRESSED); // Darker when pressed
-    lv_obj_set_style_border_width(btn, 2, LV_PART_MAIN | LV_STATE_DEFAULT);
-    lv_obj_set_style_border_color(btn, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT); // White border
-    lv_obj_set_style_radius(btn, 10, LV_PART_MAIN | LV_STATE_DEFAULT); // Rounded corners
-    lv_obj_set_style_shadow_width(btn, 5, LV_PART_MAIN | LV_STATE_DEFAULT); // Add shadow
-    lv_obj_set_style_shadow_opa(btn, LV_OPA_50, LV_PART_MAIN | LV_STATE_DEFAULT);
     
     // Create and configure label
     lv_obj_t* label = lv_label_create(btn);
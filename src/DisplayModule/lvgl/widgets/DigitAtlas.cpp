@@ -0,0 +1,252 @@
+#include "DigitAtlas.h"
+#include <src/draw/sw/lv_draw_sw.h>
+#include <string.h>
+
+// Cached atlases, one per font
+static DigitAtlas* atlas_cache_[DIGIT_ATLAS_MAX_FONTS];
+static uint32_t atlas_cache_use_[DIGIT_ATLAS_MAX_FONTS];
+static uint32_t atlas_cache_clock_ = 0;
+
+// Cell index of a character, or -1 if the atlas has no cell for it
+static int CharIndex(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c == ':') return 10;
+    if (c == '.') return 11;
+    if (c == '-') return 12;
+    return -1;
+}
+
+DigitAtlas* DigitAtlas::Get(const lv_font_t* font) {
+    if (!font) return nullptr;
+
+    int slot = 0;
+    for (int i = 0; i < DIGIT_ATLAS_MAX_FONTS; i++) {
+        if (atlas_cache_[i] && atlas_cache_[i]->font_ == font) {
+            atlas_cache_use_[i] = ++atlas_cache_clock_;
+            return atlas_cache_[i];
+        }
+        // Remember an empty slot, or else the least recently used one
+        if (atlas_cache_[slot] && (!atlas_cache_[i] || atlas_cache_use_[i] < atlas_cache_use_[slot])) {
+            slot = i;
+        }
+    }
+
+    DigitAtlas* atlas = new DigitAtlas(font);
+    if (!atlas->Render()) {
+        delete atlas;
+        return nullptr;
+    }
+
+    delete atlas_cache_[slot];
+    atlas_cache_[slot] = atlas;
+    atlas_cache_use_[slot] = ++atlas_cache_clock_;
+    return atlas;
+}
+
+void DigitAtlas::ClearCache() {
+    for (int i = 0; i < DIGIT_ATLAS_MAX_FONTS; i++) {
+        delete atlas_cache_[i];
+        atlas_cache_[i] = nullptr;
+    }
+}
+
+bool DigitAtlas::Supports(const char* text) {
+    if (!text) return false;
+    for (; *text; text++) {
+        if (CharIndex(*text) < 0) return false;
+    }
+    return true;
+}
+
+DigitAtlas::DigitAtlas(const lv_font_t* font)
+    : font_(font),
+      line_height_(0),
+      pixel_count_(0),
+      coverage_(nullptr),
+      last_used_(0) {
+    memset(cell_width_, 0, sizeof(cell_width_));
+    memset(cell_offset_, 0, sizeof(cell_offset_));
+    memset(variants_, 0, sizeof(variants_));
+}
+
+DigitAtlas::~DigitAtlas() {
+    for (Variant& variant : variants_) {
+        lv_mem_free(variant.pixels);
+    }
+    lv_mem_free(coverage_);
+}
+
+bool DigitAtlas::Render() {
+    static const char chars[] = DIGIT_ATLAS_CHARS;
+    lv_font_glyph_dsc_t glyphs[DIGIT_ATLAS_CHAR_COUNT];
+
+    // Digits get the width of the widest one
+    lv_coord_t digit_width = 0;
+    for (int i = 0; i < DIGIT_ATLAS_CHAR_COUNT; i++) {
+        if (!lv_font_get_glyph_dsc(font_, &glyphs[i], chars[i], 0) || glyphs[i].is_placeholder) {
+            return false;
+        }
+        if (i < 10 && glyphs[i].adv_w > digit_width) {
+            digit_width = glyphs[i].adv_w;
+        }
+    }
+
+    line_height_ = lv_font_get_line_height(font_);
+    for (int i = 0; i < DIGIT_ATLAS_CHAR_COUNT; i++) {
+        cell_width_[i] = i < 10 ? digit_width : glyphs[i].adv_w;
+        cell_offset_[i] = pixel_count_;
+        pixel_count_ += cell_width_[i] * line_height_;
+    }
+
+    coverage_ = static_cast<lv_opa_t*>(lv_mem_alloc(pixel_count_));
+    if (!coverage_) return false;
+    memset(coverage_, 0, pixel_count_);
+
+    for (int i = 0; i < DIGIT_ATLAS_CHAR_COUNT; i++) {
+        const lv_font_glyph_dsc_t& glyph = glyphs[i];
+        const lv_font_t* glyph_font = glyph.resolved_font ? glyph.resolved_font : font_;
+        const uint8_t* bitmap = lv_font_get_glyph_bitmap(glyph_font, chars[i]);
+        if (!bitmap || glyph.bpp == 0) continue;
+
+        // Same placement as LVGL's letter drawing, centred in the cell
+        lv_coord_t x0 = (cell_width_[i] - glyph.adv_w) / 2 + glyph.ofs_x;
+        lv_coord_t y0 = line_height_ - glyph_font->base_line - glyph.box_h - glyph.ofs_y;
+        uint32_t max_value = (1u << glyph.bpp) - 1;
+        lv_opa_t* cell = coverage_ + cell_offset_[i];
+
+        // The bitmap is one bit stream, most significant bits first, rows not padded
+        uint32_t bit = 0;
+        for (lv_coord_t y = 0; y < glyph.box_h; y++) {
+            for (lv_coord_t x = 0; x < glyph.box_w; x++, bit += glyph.bpp) {
+                uint32_t bits = bitmap[bit >> 3] << 8;
+                if ((bit & 7) + glyph.bpp > 8) {
+                    bits |= bitmap[(bit >> 3) + 1];
+                }
+                uint32_t value = (bits >> (16 - glyph.bpp - (bit & 7))) & max_value;
+
+                lv_coord_t px = x0 + x;
+                lv_coord_t py = y0 + y;
+                if (value == 0 || px < 0 || px >= cell_width_[i] || py < 0 || py >= line_height_) continue;
+                cell[py * cell_width_[i] + px] = static_cast<lv_opa_t>(value * 255 / max_value);
+            }
+        }
+    }
+    return true;
+}
+
+const lv_color_t* DigitAtlas::GetVariant(lv_color_t color, lv_opa_t opa, lv_color_t background) {
+    Variant* slot = &variants_[0];
+    for (Variant& variant : variants_) {
+        if (variant.pixels && variant.color.full == color.full && variant.background.full == background.full &&
+            variant.opa == opa) {
+            variant.last_used = ++last_used_;
+            return variant.pixels;
+        }
+        if (slot->pixels && (!variant.pixels || variant.last_used < slot->last_used)) {
+            slot = &variant;
+        }
+    }
+
+    // Composite every cell once; drawing is then a copy
+    if (!slot->pixels) {
+        slot->pixels = static_cast<lv_color_t*>(lv_mem_alloc(pixel_count_ * sizeof(lv_color_t)));
+        if (!slot->pixels) return nullptr;
+    }
+    for (uint32_t i = 0; i < pixel_count_; i++) {
+        lv_opa_t mix = opa >= LV_OPA_MAX ? coverage_[i] : static_cast<lv_opa_t>((coverage_[i] * opa) >> 8);
+        slot->pixels[i] = lv_color_mix(color, background, mix);
+    }
+    slot->color = color;
+    slot->background = background;
+    slot->opa = opa;
+    slot->last_used = ++last_used_;
+    return slot->pixels;
+}
+
+lv_coord_t DigitAtlas::GetTextWidth(const char* text) const {
+    lv_coord_t width = 0;
+    for (; *text; text++) {
+        int index = CharIndex(*text);
+        if (index >= 0) {
+            width += cell_width_[index];
+        }
+    }
+    return width;
+}
+
+bool DigitAtlas::Draw(lv_draw_ctx_t* draw_ctx, const lv_point_t* pos, const char* text,
+                      lv_color_t color, lv_opa_t opa, const lv_color_t* background) {
+    if (!Supports(text)) return false;
+    if (opa <= LV_OPA_MIN) return true;
+
+    lv_area_t text_area;
+    text_area.x1 = pos->x;
+    text_area.y1 = pos->y;
+    text_area.x2 = pos->x + GetTextWidth(text) - 1;
+    text_area.y2 = pos->y + line_height_ - 1;
+    if (!_lv_area_is_on(&text_area, draw_ctx->clip_area)) return true;
+
+    // Rounded corners and other masks need the full label path
+    if (lv_draw_mask_is_any(&text_area)) return false;
+
+    const lv_color_t* pixels = nullptr;
+    if (background) {
+        pixels = GetVariant(color, opa, *background);
+        if (!pixels) return false;
+    }
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    memset(&blend_dsc, 0, sizeof(blend_dsc));
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    lv_area_t cell_area = text_area;
+    for (; *text; text++) {
+        int index = CharIndex(*text);
+        cell_area.x2 = cell_area.x1 + cell_width_[index] - 1;
+
+        if (_lv_area_is_on(&cell_area, draw_ctx->clip_area)) {
+            blend_dsc.blend_area = &cell_area;
+            if (pixels) {
+                // Opaque cell: copied row by row
+                blend_dsc.src_buf = pixels + cell_offset_[index];
+                blend_dsc.opa = LV_OPA_COVER;
+                blend_dsc.mask_buf = nullptr;
+                blend_dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+            } else {
+                blend_dsc.color = color;
+                blend_dsc.opa = opa;
+                blend_dsc.mask_buf = coverage_ + cell_offset_[index];
+                blend_dsc.mask_area = &cell_area;
+                blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+            }
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        }
+        cell_area.x1 = cell_area.x2 + 1;
+    }
+    return true;
+}
+
+bool DigitAtlas::Draw(lv_draw_ctx_t* draw_ctx, const lv_draw_label_dsc_t* dsc, const lv_area_t* area,
+                      const char* text, const lv_color_t* background) {
+    if (!Supports(text)) return false;
+
+    lv_coord_t width = GetTextWidth(text);
+    lv_point_t pos;
+    pos.y = area->y1 + (lv_area_get_height(area) - line_height_) / 2;
+    if (dsc->align == LV_TEXT_ALIGN_CENTER) {
+        pos.x = area->x1 + (lv_area_get_width(area) - width) / 2;
+    } else if (dsc->align == LV_TEXT_ALIGN_RIGHT) {
+        pos.x = area->x2 + 1 - width;
+    } else {
+        pos.x = area->x1;
+    }
+
+    // Like lv_draw_label(), nothing is drawn outside the area
+    lv_area_t clip;
+    if (!_lv_area_intersect(&clip, area, draw_ctx->clip_area)) return true;
+    const lv_area_t* old_clip = draw_ctx->clip_area;
+    draw_ctx->clip_area = &clip;
+    bool drawn = Draw(draw_ctx, &pos, text, dsc->color, dsc->opa, background);
+    draw_ctx->clip_area = old_clip;
+    return drawn;
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <lvgl.h>
+#include <cstdint>
+
+// Characters pre-rendered by the atlas: everything a lap time, a lap count or
+// a countdown number is made of
+#define DIGIT_ATLAS_CHARS "0123456789:.-"
+#define DIGIT_ATLAS_CHAR_COUNT 13
+
+// Fonts kept in the cache at once (the race screens use 12, 24 and 48 px)
+#define DIGIT_ATLAS_MAX_FONTS 4
+
+// Text/background colour pairs pre-composited per font
+#define DIGIT_ATLAS_MAX_VARIANTS 4
+
+/**
+ * @brief Pre-rendered digits of one font, blitted without LVGL's text path
+ *
+ * On first use the glyphs in DIGIT_ATLAS_CHARS are rasterized once into an
+ * 8-bit coverage cell each, a full line high. The digits share the width of
+ * the widest one (tabular figures), so times do not shift sideways as they
+ * count.
+ *
+ * Drawing a string is one blend per character instead of a font lookup,
+ * bitmap decode and letter mask each:
+ * - On an opaque background the cells are composited with the text colour
+ *   once per colour pair and then copied into the draw buffer row by row.
+ * - On a translucent background the coverage is blended as a mask.
+ *
+ * The pixels are allocated from LVGL memory; atlases are only used from
+ * the LVGL thread.
+ */
+class DigitAtlas {
+public:
+    /**
+     * @brief Get the atlas of a font, rendering it on first use
+     *
+     * The least recently used font is dropped when DIGIT_ATLAS_MAX_FONTS are
+     * cached.
+     *
+     * @param font Font to render
+     * @return The atlas, or nullptr if the font has no glyph for a character or memory ran out
+     */
+    static DigitAtlas* Get(const lv_font_t* font);
+
+    /**
+     * @brief Free every cached atlas
+     */
+    static void ClearCache();
+
+    /**
+     * @brief Whether every character of the text is in the atlas
+     */
+    static bool Supports(const char* text);
+
+    const lv_font_t* GetFont() const { return font_; }
+    lv_coord_t GetLineHeight() const { return line_height_; }
+
+    /**
+     * @brief Width of a supported text in pixels
+     */
+    lv_coord_t GetTextWidth(const char* text) const;
+
+    /**
+     * @brief Draw a supported text with its top-left corner at pos
+     *
+     * @param draw_ctx Draw context of the current LV_EVENT_DRAW_MAIN
+     * @param pos Top-left corner (absolute coordinates)
+     * @param text Text made of DIGIT_ATLAS_CHARS only
+     * @param color Text colour
+     * @param opa Text opacity
+     * @param background Colour under the text if it is opaque, else nullptr
+     * @return false if nothing was drawn and the caller should use lv_draw_label()
+     *         (unsupported text, active draw masks or out of memory)
+     */
+    bool Draw(lv_draw_ctx_t* draw_ctx, const lv_point_t* pos, const char* text,
+              lv_color_t color, lv_opa_t opa, const lv_color_t* background);
+
+    /**
+     * @brief Draw a supported text inside an area, placed like lv_draw_label() would
+     *
+     * Aligned horizontally by dsc->align and centred vertically, in the
+     * colour and opacity of dsc.
+     *
+     * @return false if the caller should use lv_draw_label() (see above)
+     */
+    bool Draw(lv_draw_ctx_t* draw_ctx, const lv_draw_label_dsc_t* dsc, const lv_area_t* area, const char* text,
+              const lv_color_t* background);
+
+private:
+    // Pixels of all cells composited for one text/background pair
+    struct Variant {
+        lv_color_t color;
+        lv_color_t background;
+        lv_opa_t opa;
+        lv_color_t* pixels;
+        uint32_t last_used;
+    };
+
+    explicit DigitAtlas(const lv_font_t* font);
+    ~DigitAtlas();
+    DigitAtlas(const DigitAtlas&) = delete;
+    DigitAtlas& operator=(const DigitAtlas&) = delete;
+
+    bool Render();
+    const lv_color_t* GetVariant(lv_color_t color, lv_opa_t opa, lv_color_t background);
+
+    const lv_font_t* font_;
+    lv_coord_t line_height_;
+    lv_coord_t cell_width_[DIGIT_ATLAS_CHAR_COUNT];
+    uint32_t cell_offset_[DIGIT_ATLAS_CHAR_COUNT];  // Into coverage_ and the variant pixels
+    uint32_t pixel_count_;
+    lv_opa_t* coverage_;
+    Variant variants_[DIGIT_ATLAS_MAX_VARIANTS];
+    uint32_t last_used_;
+};
@@ -0,0 +1,227 @@
+#include "LeaderboardTable.h"
+#include "DigitAtlas.h"
+#include <string.h>
+
+// Geometry matching the flex rows this widget replaces
+static constexpr lv_coord_t ROW_PAD = 2;     // Padding inside a row
+static constexpr lv_coord_t COLUMN_GAP = 2;  // Gap between cells
+static constexpr lv_coord_t CELL_PAD = 2;    // Padding inside a cell
+
+// Copy background color/opacity from a style, leaving properties it doesn't set untouched
+static void ApplyBackground(lv_draw_rect_dsc_t* dsc, const lv_style_t* style) {
+    if (!style) return;
+
+    lv_style_value_t value;
+    if (lv_style_get_prop(style, LV_STYLE_BG_COLOR, &value) == LV_STYLE_RES_FOUND) {
+        dsc->bg_color = value.color;
+    }
+    if (lv_style_get_prop(style, LV_STYLE_BG_OPA, &value) == LV_STYLE_RES_FOUND) {
+        dsc->bg_opa = static_cast<lv_opa_t>(value.num);
+    }
+}
+
+LeaderboardTable::LeaderboardTable()
+    : obj_(nullptr),
+      styles_(),
+      num_columns_(0),
+      num_rows_(0),
+      header_height_(30),
+      row_height_(30),
+      layout_width_(-1) {
+    memset(columns_, 0, sizeof(columns_));
+    memset(cells_, 0, sizeof(cells_));
+    memset(column_x_, 0, sizeof(column_x_));
+}
+
+LeaderboardTable::~LeaderboardTable() {
+    // The object belongs to its parent; just stop it calling back into us
+    if (obj_) {
+        lv_obj_set_user_data(obj_, nullptr);
+    }
+}
+
+lv_obj_t* LeaderboardTable::Create(lv_obj_t* parent, const Column* columns, uint8_t numColumns,
+                                   const Styles& styles) {
+    if (numColumns > LEADERBOARD_MAX_COLUMNS) numColumns = LEADERBOARD_MAX_COLUMNS;
+
+    styles_ = styles;
+    num_columns_ = numColumns;
+    for (uint8_t i = 0; i < numColumns; i++) {
+        columns_[i] = columns[i];
+    }
+    layout_width_ = -1;
+
+    obj_ = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj_);
+    if (styles_.label) {
+        lv_obj_add_style(obj_, const_cast<lv_style_t*>(styles_.label), 0);
+    }
+    lv_obj_clear_flag(obj_, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_user_data(obj_, this);
+    lv_obj_add_event_cb(obj_, EventCallback, LV_EVENT_ALL, nullptr);
+
+    return obj_;
+}
+
+void LeaderboardTable::SetRowCount(uint8_t numRows) {
+    if (numRows > LEADERBOARD_MAX_ROWS) numRows = LEADERBOARD_MAX_ROWS;
+
+    num_rows_ = numRows;
+    for (uint8_t row = 0; row < LEADERBOARD_MAX_ROWS; row++) {
+        for (uint8_t column = 0; column < LEADERBOARD_MAX_COLUMNS; column++) {
+            strcpy(cells_[row][column], "-");
+        }
+    }
+
+    if (obj_) {
+        lv_obj_invalidate(obj_);
+    }
+}
+
+void LeaderboardTable::SetRowHeights(lv_coord_t headerHeight, lv_coord_t rowHeight) {
+    if (headerHeight == header_height_ && rowHeight == row_height_) return;
+
+    header_height_ = headerHeight;
+    row_height_ = rowHeight;
+
+    if (obj_) {
+        lv_obj_invalidate(obj_);
+    }
+}
+
+void LeaderboardTable::SetCell(uint8_t row, uint8_t column, const char* text) {
+    if (row >= num_rows_ || column >= num_columns_ || !text) return;
+
+    char* cell = cells_[row][column];
+    if (strncmp(cell, text, LEADERBOARD_CELL_TEXT - 1) == 0) return;
+
+    strncpy(cell, text, LEADERBOARD_CELL_TEXT - 1);
+    cell[LEADERBOARD_CELL_TEXT - 1] = '\0';
+
+    lv_area_t area;
+    if (GetCellArea(row, column, &area)) {
+        lv_obj_invalidate_area(obj_, &area);
+    }
+}
+
+void LeaderboardTable::UpdateColumnLayout() {
+    lv_coord_t width = lv_obj_get_width(obj_);
+    if (width == layout_width_) return;
+    layout_width_ = width;
+
+    if (num_columns_ == 0) return;
+
+    // Every column gets its minimum width, the rest is shared by grow factor
+    lv_coord_t available = width - 2 * ROW_PAD - (num_columns_ - 1) * COLUMN_GAP;
+    lv_coord_t minTotal = 0;
+    uint32_t growTotal = 0;
+    for (uint8_t i = 0; i < num_columns_; i++) {
+        minTotal += columns_[i].minWidth;
+        growTotal += columns_[i].grow;
+    }
+    lv_coord_t extra = available > minTotal ? available - minTotal : 0;
+
+    lv_coord_t x = ROW_PAD;
+    for (uint8_t i = 0; i < num_columns_; i++) {
+        column_x_[i] = x;
+        lv_coord_t columnWidth = columns_[i].minWidth;
+        if (growTotal > 0) {
+            columnWidth += static_cast<lv_coord_t>(extra * columns_[i].grow / growTotal);
+        }
+        x += columnWidth + COLUMN_GAP;
+    }
+
+    // Let the last column absorb rounding so the table ends at the row padding
+    column_x_[num_columns_] = width - ROW_PAD + COLUMN_GAP;
+}
+
+bool LeaderboardTable::GetRowArea(int row, lv_area_t* area) const {
+    if (!obj_) return false;
+
+    lv_obj_get_coords(obj_, area);
+    if (row < 0) {
+        area->y2 = area->y1 + header_height_ - 1;
+    } else {
+        area->y1 += header_height_ + row * row_height_;
+        area->y2 = area->y1 + row_height_ - 1;
+    }
+    return true;
+}
+
+bool LeaderboardTable::GetCellArea(int row, uint8_t column, lv_area_t* area) {
+    if (!GetRowArea(row, area)) return false;
+
+    UpdateColumnLayout();
+    lv_coord_t left = area->x1;
+    area->x1 = left + column_x_[column];
+    area->x2 = left + column_x_[column + 1] - COLUMN_GAP - 1;
+    return true;
+}
+
+void LeaderboardTable::Draw(lv_draw_ctx_t* draw_ctx) {
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_obj_init_draw_label_dsc(obj_, LV_PART_MAIN, &label_dsc);
+
+    lv_coord_t line_height = lv_font_get_line_height(label_dsc.font);
+
+    // Times, counts and placeholders are blitted from the font's pre-rendered digits
+    DigitAtlas* atlas = DigitAtlas::Get(label_dsc.font);
+
+    // Row -1 is the header
+    for (int row = -1; row < num_rows_; row++) {
+        lv_area_t row_area;
+        GetRowArea(row, &row_area);
+        if (!_lv_area_is_on(&row_area, draw_ctx->clip_area)) continue;
+
+        lv_draw_rect_dsc_t rect_dsc;
+        lv_draw_rect_dsc_init(&rect_dsc);
+        rect_dsc.bg_opa = LV_OPA_TRANSP;
+        if (row < 0) {
+            ApplyBackground(&rect_dsc, styles_.header);
+        } else {
+            ApplyBackground(&rect_dsc, styles_.row);
+            ApplyBackground(&rect_dsc, row % 2 ? styles_.rowOdd : styles_.rowEven);
+        }
+        if (rect_dsc.bg_opa > LV_OPA_MIN) {
+            lv_draw_rect(draw_ctx, &rect_dsc, &row_area);
+        }
+
+        for (uint8_t column = 0; column < num_columns_; column++) {
+            lv_area_t text_area;
+            GetCellArea(row, column, &text_area);
+            if (!_lv_area_is_on(&text_area, draw_ctx->clip_area)) continue;
+
+            // Center the single text line vertically inside the cell padding
+            text_area.x1 += CELL_PAD;
+            text_area.x2 -= CELL_PAD;
+            text_area.y1 += (lv_area_get_height(&text_area) - line_height) / 2;
+            text_area.y2 = text_area.y1 + line_height - 1;
+
+            const char* text = row < 0 ? columns_[column].header : cells_[row][column];
+            const lv_color_t* background = rect_dsc.bg_opa >= LV_OPA_MAX ? &rect_dsc.bg_color : nullptr;
+            if (atlas && atlas->Draw(draw_ctx, &label_dsc, &text_area, text, background)) continue;
+            lv_draw_label(draw_ctx, &label_dsc, &text_area, text, nullptr);
+        }
+    }
+}
+
+void LeaderboardTable::EventCallback(lv_event_t* e) {
+    lv_obj_t* obj = lv_event_get_target(e);
+    LeaderboardTable* table = static_cast<LeaderboardTable*>(lv_obj_get_user_data(obj));
+    if (!table) return;
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_DRAW_MAIN:
+            table->Draw(lv_event_get_draw_ctx(e));
+            break;
+        case LV_EVENT_SIZE_CHANGED:
+            table->layout_width_ = -1;
+            break;
+        case LV_EVENT_DELETE:
+            table->obj_ = nullptr;
+            break;
+        default:
+            break;
+    }
+}
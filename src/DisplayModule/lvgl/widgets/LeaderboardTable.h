@@ -0,0 +1,104 @@
+#pragma once
+
+#include <lvgl.h>
+#include <cstdint>
+
+// Capacity of the table (rows exclude the header)
+#define LEADERBOARD_MAX_ROWS 8
+#define LEADERBOARD_MAX_COLUMNS 6
+#define LEADERBOARD_CELL_TEXT 16
+
+/**
+ * @brief Lightweight race table drawn by a single LVGL object
+ *
+ * All rows and columns are painted from a plain text buffer in one
+ * LV_EVENT_DRAW_MAIN handler, so a table costs one lv_obj_t regardless of
+ * the number of lanes and takes no part in flex layout or hit-testing of
+ * individual cells. SetCell() only invalidates the rectangle of a cell
+ * whose text actually changed.
+ *
+ * Text font, colour and alignment come from the styles attached to the
+ * object (see Create()); row backgrounds come from the styles passed in
+ * LeaderboardTable::Styles.
+ */
+class LeaderboardTable {
+public:
+    /**
+     * @brief Column definition, sized like a flex item
+     */
+    struct Column {
+        const char* header;     // Header text
+        uint8_t grow;           // Share of the width left after minimum widths
+        lv_coord_t minWidth;    // Minimum column width in pixels
+    };
+
+    /**
+     * @brief Styles used for painting; only background color/opacity and
+     * text opacity are read from them
+     */
+    struct Styles {
+        const lv_style_t* label;     // Attached to the object: text font, color, align
+        const lv_style_t* header;    // Header background
+        const lv_style_t* row;       // Background shared by all data rows
+        const lv_style_t* rowEven;   // Background of even rows
+        const lv_style_t* rowOdd;    // Background of odd rows
+    };
+
+    LeaderboardTable();
+    ~LeaderboardTable();
+
+    /**
+     * @brief Create the table object
+     * @param parent Parent LVGL object
+     * @param columns Column definitions (copied, up to LEADERBOARD_MAX_COLUMNS)
+     * @param numColumns Number of columns
+     * @param styles Styles used for painting (must outlive the table)
+     * @return lv_obj_t* The table object; size and position it like any other object
+     */
+    lv_obj_t* Create(lv_obj_t* parent, const Column* columns, uint8_t numColumns, const Styles& styles);
+
+    /**
+     * @brief Set the number of visible rows and reset their cells to "-"
+     * @param numRows Number of rows (up to LEADERBOARD_MAX_ROWS)
+     */
+    void SetRowCount(uint8_t numRows);
+
+    /**
+     * @brief Set header and row heights
+     * @param headerHeight Header row height in pixels
+     * @param rowHeight Data row height in pixels
+     */
+    void SetRowHeights(lv_coord_t headerHeight, lv_coord_t rowHeight);
+
+    /**
+     * @brief Set the text of a cell, invalidating it only if the text changed
+     * @param row Row index (0-based, excluding the header)
+     * @param column Column index
+     * @param text Cell text (truncated to LEADERBOARD_CELL_TEXT - 1 characters)
+     */
+    void SetCell(uint8_t row, uint8_t column, const char* text);
+
+    lv_obj_t* GetObj() const { return obj_; }
+    uint8_t GetRowCount() const { return num_rows_; }
+
+private:
+    lv_obj_t* obj_;
+    Styles styles_;
+    Column columns_[LEADERBOARD_MAX_COLUMNS];
+    uint8_t num_columns_;
+    uint8_t num_rows_;
+    lv_coord_t header_height_;
+    lv_coord_t row_height_;
+    char cells_[LEADERBOARD_MAX_ROWS][LEADERBOARD_MAX_COLUMNS][LEADERBOARD_CELL_TEXT];
+
+    // Column x offsets (relative to the object), recomputed when the width changes
+    lv_coord_t column_x_[LEADERBOARD_MAX_COLUMNS + 1];
+    lv_coord_t layout_width_;
+
+    void UpdateColumnLayout();
+    bool GetCellArea(int row, uint8_t column, lv_area_t* area);
+    bool GetRowArea(int row, lv_area_t* area) const;
+    void Draw(lv_draw_ctx_t* draw_ctx);
+
+    static void EventCallback(lv_event_t* e);
+};
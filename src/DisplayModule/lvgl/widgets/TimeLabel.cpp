@@ -0,0 +1,120 @@
+#include "TimeLabel.h"
+#include "DigitAtlas.h"
+#include "../../../common/FixedString.h"
+#include <string.h>
+
+TimeLabel::TimeLabel()
+    : obj_(nullptr),
+      text_width_(0) {
+    text_[0] = '\0';
+}
+
+TimeLabel::~TimeLabel() {
+    // The object belongs to its parent; just stop it calling back into us
+    if (obj_) {
+        lv_obj_set_user_data(obj_, nullptr);
+    }
+}
+
+lv_obj_t* TimeLabel::Create(lv_obj_t* parent) {
+    obj_ = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj_);
+    lv_obj_clear_flag(obj_, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(obj_, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_user_data(obj_, this);
+    lv_obj_add_event_cb(obj_, EventCallback, LV_EVENT_ALL, nullptr);
+    text_width_ = 0;
+
+    return obj_;
+}
+
+void TimeLabel::SetText(const char* text) {
+    if (!text || strncmp(text_, text, TIME_LABEL_TEXT - 1) == 0) return;
+
+    strncpy(text_, text, TIME_LABEL_TEXT - 1);
+    text_[TIME_LABEL_TEXT - 1] = '\0';
+    if (!obj_) return;
+
+    lv_obj_invalidate(obj_);
+    lv_coord_t width = MeasureText();
+    if (width != text_width_) {
+        text_width_ = width;
+        lv_obj_refresh_self_size(obj_);
+    }
+}
+
+void TimeLabel::SetTime(uint32_t timeMs) {
+    SetText(formatTimeMMSSmmm(timeMs).c_str());
+}
+
+lv_coord_t TimeLabel::MeasureText() const {
+    const lv_font_t* font = lv_obj_get_style_text_font(obj_, LV_PART_MAIN);
+    DigitAtlas* atlas = DigitAtlas::Supports(text_) ? DigitAtlas::Get(font) : nullptr;
+    if (atlas) {
+        return atlas->GetTextWidth(text_);
+    }
+    return lv_txt_get_width(text_, strlen(text_), font, lv_obj_get_style_text_letter_space(obj_, LV_PART_MAIN),
+                            LV_TEXT_FLAG_NONE);
+}
+
+bool TimeLabel::FindBackground(lv_color_t* color) const {
+    // The first object with a background decides; a translucent one means unknown
+    for (const lv_obj_t* obj = obj_; obj; obj = lv_obj_get_parent(obj)) {
+        lv_opa_t opa = lv_obj_get_style_bg_opa(obj, LV_PART_MAIN);
+        if (opa >= LV_OPA_MAX) {
+            if (lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE ||
+                lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN)) {
+                return false;
+            }
+            *color = lv_obj_get_style_bg_color_filtered(obj, LV_PART_MAIN);
+            return true;
+        }
+        if (opa > LV_OPA_MIN) return false;
+    }
+    return false;
+}
+
+void TimeLabel::Draw(lv_draw_ctx_t* draw_ctx) {
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_obj_init_draw_label_dsc(obj_, LV_PART_MAIN, &label_dsc);
+
+    lv_area_t coords;
+    lv_obj_get_content_coords(obj_, &coords);
+
+    DigitAtlas* atlas = DigitAtlas::Supports(text_) ? DigitAtlas::Get(label_dsc.font) : nullptr;
+    if (atlas) {
+        lv_color_t background;
+        bool opaque = FindBackground(&background);
+        if (atlas->Draw(draw_ctx, &label_dsc, &coords, text_, opaque ? &background : nullptr)) {
+            return;
+        }
+    }
+
+    lv_draw_label(draw_ctx, &label_dsc, &coords, text_, nullptr);
+}
+
+void TimeLabel::EventCallback(lv_event_t* e) {
+    lv_obj_t* obj = lv_event_get_target(e);
+    TimeLabel* label = static_cast<TimeLabel*>(lv_obj_get_user_data(obj));
+    if (!label) return;
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_DRAW_MAIN:
+            label->Draw(lv_event_get_draw_ctx(e));
+            break;
+        case LV_EVENT_GET_SELF_SIZE: {
+            lv_point_t* size = static_cast<lv_point_t*>(lv_event_get_param(e));
+            const lv_font_t* font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+            label->text_width_ = label->MeasureText();
+            size->x = LV_MAX(size->x, label->text_width_);
+            size->y = LV_MAX(size->y, lv_font_get_line_height(font));
+            break;
+        }
+        case LV_EVENT_DELETE:
+            label->obj_ = nullptr;
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <lvgl.h>
+#include <cstdint>
+
+// Longest text shown, e.g. "--:--.---" or "999:59.999"
+#define TIME_LABEL_TEXT 16
+
+/**
+ * @brief Single-line label for times and numbers, drawn from a DigitAtlas
+ *
+ * Sized and styled like an lv_label (text font, colour, opacity and
+ * alignment come from the object's styles), but text made of digits, ':',
+ * '.' and '-' is blitted from the font's pre-rendered DigitAtlas instead
+ * of going through LVGL's text layout. When the label sits on an opaque
+ * background (its own or the nearest parent's), each character is a plain
+ * copy. Any other text, e.g. "GO!", falls back to lv_draw_label().
+ *
+ * SetText() only invalidates the label when the text changed, and only
+ * resizes it when the width changed.
+ */
+class TimeLabel {
+public:
+    TimeLabel();
+    ~TimeLabel();
+
+    /**
+     * @brief Create the label object
+     * @param parent Parent LVGL object
+     * @return lv_obj_t* The label object, sized to its content
+     */
+    lv_obj_t* Create(lv_obj_t* parent);
+
+    /**
+     * @brief Set the text
+     * @param text New text (truncated to TIME_LABEL_TEXT - 1 characters)
+     */
+    void SetText(const char* text);
+
+    /**
+     * @brief Show a time as "MM:SS.mmm"
+     * @param timeMs Time in milliseconds
+     */
+    void SetTime(uint32_t timeMs);
+
+    const char* GetText() const { return text_; }
+    lv_obj_t* GetObj() const { return obj_; }
+
+private:
+    lv_obj_t* obj_;
+    char text_[TIME_LABEL_TEXT];
+    lv_coord_t text_width_;
+
+    lv_coord_t MeasureText() const;
+    bool FindBackground(lv_color_t* color) const;
+    void Draw(lv_draw_ctx_t* draw_ctx);
+
+    static void EventCallback(lv_event_t* e);
+};
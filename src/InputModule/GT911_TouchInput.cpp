@@ -10,6 +10,7 @@
 
 // Initialize static members
 std::queue<InputEvent> GT911_TouchInput::_inputEventQueue;
+std::mutex GT911_TouchInput::_inputEventMutex;
 int16_t GT911_TouchInput::_lastTouchX = 0;
 int16_t GT911_TouchInput::_lastTouchY = 0;
 lv_indev_state_t GT911_TouchInput::_lastTouchState = LV_INDEV_STATE_RELEASED;
@@ -102,11 +103,18 @@ bool GT911_TouchInput::poll(InputEvent& event) {
     }
     
     // Check for queued events
-    if (!_inputEventQueue.empty()) {
-        // Copy the event from the queue to the output parameter
-        event = _inputEventQueue.front();
-        _inputEventQueue.pop();
-        
+    bool hasEvent = false;
+    {
+        std::lock_guard<std::mutex> lock(_inputEventMutex);
+        if (!_inputEventQueue.empty()) {
+            // Copy the event from the queue to the output parameter
+            event = _inputEventQueue.front();
+            _inputEventQueue.pop();
+            hasEvent = true;
+        }
+    }
+
+    if (hasEvent) {
         // Debug output for touch events
         DisplayManager::getInstance().debug("Touch event processed: " + String(static_cast<int>(event.command)), "GT911_TouchInput");
                      
@@ -136,6 +144,7 @@ void GT911_TouchInput::lvgl_touch_read_cb(lv_indev_drv_t *indev_drv, lv_indev_da
 
 // Called by LVGL widget event handlers (in DisplayDriver typically) to queue a system event
 void GT911_TouchInput::queueSystemInputEvent(const InputEvent& sysEvent) {
+    std::lock_guard<std::mutex> lock(_inputEventMutex);
     _inputEventQueue.push(sysEvent);
     // DEBUG_DEBUG("GT911_TouchInput: Queued event - Command: %d, SourceID: %d, Value: %d", 
     //          static_cast<int>(sysEvent.command), sysEvent.sourceId, sysEvent.value);
@@ -5,6 +5,7 @@
 #include "common/Types.h"        // For InputEvent, InputSourceId
 #include "common/TimeManager.h"  // For TimeManager
 #include <lvgl.h>
+#include <mutex>
 #ifndef SIMULATOR
 #include <TAMC_GT911.h>        // Touch driver library
 #else
@@ -91,6 +92,8 @@ private:
 
     // Queue for InputEvents generated by LVGL widget callbacks
     static std::queue<InputEvent> _inputEventQueue;
+    // Widget callbacks run on the display core (or a render thread), poll() on the race core
+    static std::mutex _inputEventMutex;
 
     // Last touch coordinates (raw, for LVGL)
     static int16_t _lastTouchX;
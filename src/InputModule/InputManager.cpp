@@ -66,6 +66,10 @@ bool InputManager::poll(InputEvent& event) {
                 event.target = getDefaultTargetForCommand(event.command);
             }
             
+            if (_recorder) {
+                _recorder->record(event);
+            }
+            
             return true;
         }
     }
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include "InputModule.h"
+#include "InputTrace.h"
 #include "common/TimeManager.h"
 #include "common/Types.h"
 
@@ -53,6 +54,13 @@ public:
      */
     void update();
     
+    /**
+     * @brief Record every polled event into a trace
+     * 
+     * @param trace Trace to append to, or nullptr to stop recording
+     */
+    void setRecorder(InputTrace* trace) { _recorder = trace; }
+    
 private:
     // Private constructor for singleton pattern
     InputManager();
@@ -66,4 +74,5 @@ private:
     
     std::vector<InputModule*> modules;
     bool _initialized = false;
+    InputTrace* _recorder = nullptr;
 };
@@ -0,0 +1,79 @@
+#include "InputTrace.h"
+#include <cstdio>
+#include <cstring>
+
+void InputTrace::record(const InputEvent& event) {
+    InputTraceRecord rec;
+    rec.timestamp = event.timestamp;
+    rec.sourceId = event.sourceId;
+    rec.value = event.value;
+    rec.command = (uint8_t)event.command;
+    rec.target = (uint8_t)event.target;
+    rec.reserved = 0;
+    _records.push_back(rec);
+}
+
+InputEvent InputTrace::eventAt(size_t index) const {
+    const InputTraceRecord& rec = _records[index];
+    InputEvent event;
+    event.command = (InputCommand)rec.command;
+    event.sourceId = rec.sourceId;
+    event.value = rec.value;
+    event.timestamp = rec.timestamp;
+    event.target = (InputTarget)rec.target;
+    return event;
+}
+
+ErrorInfo InputTrace::saveToFile(const char* path) const {
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to open trace file", "InputTrace");
+    }
+
+    InputTraceHeader header;
+    memcpy(header.magic, INPUT_TRACE_MAGIC, sizeof(header.magic));
+    header.version = INPUT_TRACE_VERSION;
+    header.recordSize = sizeof(InputTraceRecord);
+    header.count = (uint32_t)_records.size();
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && !_records.empty()) {
+        ok = fwrite(_records.data(), sizeof(InputTraceRecord), _records.size(), file) == _records.size();
+    }
+    fclose(file);
+
+    if (!ok) {
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to write trace file", "InputTrace");
+    }
+    return ErrorInfo(); // Success
+}
+
+ErrorInfo InputTrace::loadFromFile(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to open trace file", "InputTrace");
+    }
+
+    InputTraceHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, INPUT_TRACE_MAGIC, sizeof(header.magic)) != 0) {
+        fclose(file);
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Not an input trace file", "InputTrace");
+    }
+
+    if (header.version != INPUT_TRACE_VERSION || header.recordSize != sizeof(InputTraceRecord)) {
+        fclose(file);
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Unsupported input trace version", "InputTrace");
+    }
+
+    _records.resize(header.count);
+    bool ok = header.count == 0 ||
+              fread(_records.data(), sizeof(InputTraceRecord), header.count, file) == header.count;
+    fclose(file);
+
+    if (!ok) {
+        _records.clear();
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Truncated input trace file", "InputTrace");
+    }
+    return ErrorInfo(); // Success
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include "InputCommand.h"
+#include "common/Types.h"
+
+/**
+ * InputTrace - Captured stream of InputEvents with their timestamps.
+ *
+ * Capture format (little-endian, as written by saveToFile):
+ * - InputTraceHeader: magic "ITRC", format version, record size, record count
+ * - record count x InputTraceRecord (16 bytes each)
+ *
+ * Timestamps are the TimeManager values assigned by InputManager when the
+ * event was polled, so a trace replays with the exact timing of the session
+ * it was recorded in.
+ */
+
+#define INPUT_TRACE_MAGIC "ITRC"
+#define INPUT_TRACE_VERSION 1
+
+struct InputTraceHeader {
+    char magic[4];          // INPUT_TRACE_MAGIC
+    uint16_t version;       // INPUT_TRACE_VERSION
+    uint16_t recordSize;    // sizeof(InputTraceRecord)
+    uint32_t count;         // Number of records that follow
+};
+
+struct InputTraceRecord {
+    uint32_t timestamp;     // Event timestamp in ms
+    int32_t sourceId;       // InputEvent::sourceId
+    int32_t value;          // InputEvent::value
+    uint8_t command;        // InputCommand
+    uint8_t target;         // InputTarget
+    uint16_t reserved;      // Padding, keeps the record at 16 bytes
+};
+
+static_assert(sizeof(InputTraceHeader) == 12, "InputTraceHeader must stay 12 bytes");
+static_assert(sizeof(InputTraceRecord) == 16, "InputTraceRecord must stay 16 bytes");
+
+class InputTrace {
+public:
+    /**
+     * @brief Append an event to the trace
+     * @param event Event as delivered by InputManager (timestamp already set)
+     */
+    void record(const InputEvent& event);
+
+    /**
+     * @brief Convert a stored record back into an InputEvent
+     * @param index Record index
+     * @return InputEvent The recorded event
+     */
+    InputEvent eventAt(size_t index) const;
+
+    /**
+     * @brief Write the trace to a file in the capture format
+     * @param path File path
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo saveToFile(const char* path) const;
+
+    /**
+     * @brief Replace the trace with the contents of a capture file
+     * @param path File path
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo loadFromFile(const char* path);
+
+    void clear() { _records.clear(); }
+    void reserve(size_t count) { _records.reserve(count); }
+    size_t size() const { return _records.size(); }
+    bool empty() const { return _records.empty(); }
+    const InputTraceRecord& at(size_t index) const { return _records[index]; }
+
+private:
+    std::vector<InputTraceRecord> _records;
+};
@@ -209,6 +209,7 @@ static void printHelpMessage() {
     display.info("  x       Stop race", "KeyboardInput");
     display.info("  r       Reset race", "KeyboardInput");
     display.info("  1-8     Add lap for lane 1-8", "KeyboardInput");
+    display.info("  -       Remove last lap (prompt for lane number)", "KeyboardInput");
     display.info("  b       Toggle best lap display", "KeyboardInput");
     display.info("", "KeyboardInput");
 }
@@ -352,6 +353,14 @@ bool KeyboardInput::poll(InputEvent& event) {
                     DisplayManager::getInstance().info("Disable which lane? (Enter lane number 1-8):", "KeyboardInput");
                     kbdState = KeyboardState::WaitLaneNumber;
                     return false;
+                case '-':
+                    // RemoveLap command (manual lap correction)
+                    DisplayManager::getInstance().debug("RemoveLap command received", "KeyboardInput");
+                    DisplayManager::getInstance().info("", "KeyboardInput");
+                    DisplayManager::getInstance().info("Remove last lap from which lane? (Enter lane number 1-8):", "KeyboardInput");
+                    pendingCommand = '-';
+                    kbdState = KeyboardState::WaitLaneNumber;
+                    return false;
                 case 'a':
                     // AddRacer command
                     event.command = InputCommand::AddRacer;
@@ -750,6 +759,8 @@ bool KeyboardInput::poll(InputEvent& event) {
                         event.command = InputCommand::EnableLane;
                     } else if (pendingCommand == 'd') {
                         event.command = InputCommand::DisableLane;
+                    } else if (pendingCommand == '-') {
+                        event.command = InputCommand::RemoveLap;
                     } else {
                         event.command = InputCommand::SetNumLanes;
                     }
@@ -763,6 +774,8 @@ bool KeyboardInput::poll(InputEvent& event) {
                         action = "Enabled lane: ";
                     } else if (pendingCommand == 'd') {
                         action = "Disabled lane: ";
+                    } else if (pendingCommand == '-') {
+                        action = "Removed last lap from lane: ";
                     } else {
                         action = "Set number of lanes to: ";
                     }
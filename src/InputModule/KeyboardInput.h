@@ -26,7 +26,7 @@
  * - x or X: Reset Race
  * - l: Set number of lanes (prompts for value)
  * - 1-8: Simulate sensor trigger for lane 1-8
- * - d or -: Remove lap (manual correction)
+ * - -: Remove last lap (prompts for lane number)
  * - b: Toggle best lap tracking
  * - f: Toggle first trigger ignore / reaction time mode
  * - c: Enter configuration menu
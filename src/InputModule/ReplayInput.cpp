@@ -0,0 +1,74 @@
+#include "ReplayInput.h"
+#include "common/TimeManager.h"
+#ifdef SIMULATOR
+#include "common/ArduinoCompat.h"
+#else
+#include <Arduino.h>
+#endif
+
+ReplayInput::ReplayInput(const InputTrace& trace)
+    : _trace(trace) {
+}
+
+void ReplayInput::start(ReplaySpeed speed, uint32_t multiplier) {
+    _speed = speed;
+    _multiplier = multiplier > 0 ? multiplier : 1;
+    _index = 0;
+    _traceStartMs = _trace.empty() ? 0 : _trace.at(0).timestamp;
+    _wallStartMs = millis();
+    _wallEndMs = _wallStartMs;
+    _running = true;
+
+    TimeManager::GetInstance().SetReplayTime(_traceStartMs);
+}
+
+void ReplayInput::stop() {
+    if (_running && !isFinished()) {
+        _wallEndMs = millis();
+    }
+    _running = false;
+    TimeManager::GetInstance().ClearReplayTime();
+}
+
+bool ReplayInput::poll(InputEvent& event) {
+    if (!_running) {
+        return false;
+    }
+
+    // The last event has been handled on the trace clock, hand time back
+    if (isFinished()) {
+        stop();
+        return false;
+    }
+
+    const InputTraceRecord& rec = _trace.at(_index);
+    uint32_t dueOffset = rec.timestamp - _traceStartMs;
+
+    if (_speed != ReplaySpeed::Maximum) {
+        uint64_t elapsed = millis() - _wallStartMs;
+        if (_speed == ReplaySpeed::Accelerated) {
+            elapsed *= _multiplier;
+        }
+
+        if (elapsed < dueOffset) {
+            // Advance the race clock between events so timers keep running
+            TimeManager::GetInstance().SetReplayTime(_traceStartMs + (uint32_t)elapsed);
+            return false;
+        }
+    }
+
+    TimeManager::GetInstance().SetReplayTime(rec.timestamp);
+    event = _trace.eventAt(_index++);
+
+    if (isFinished()) {
+        _wallEndMs = millis();
+    }
+    return true;
+}
+
+uint32_t ReplayInput::getWallTimeMs() const {
+    if (_running && !isFinished()) {
+        return millis() - _wallStartMs;
+    }
+    return _wallEndMs - _wallStartMs;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "InputModule.h"
+#include "InputTrace.h"
+
+/**
+ * @brief Playback speed for ReplayInput
+ */
+enum class ReplaySpeed {
+    RealTime,       // Events are delivered with their recorded spacing
+    Accelerated,    // Recorded spacing divided by the speed multiplier
+    Maximum         // One event per poll, no waiting
+};
+
+/**
+ * ReplayInput - Plays a recorded InputTrace back through the input pipeline.
+ *
+ * Add it to InputManager like any other InputModule; events then reach
+ * SystemController::processInputEvent exactly as they did when recorded.
+ * While replaying, TimeManager is driven from the trace timestamps so lap
+ * times are reproduced exactly regardless of playback speed. Once the last
+ * event has been delivered, the next poll stops playback and hands
+ * TimeManager back to the system clock.
+ */
+class ReplayInput : public InputModule {
+public:
+    /**
+     * @param trace Trace to play back (must outlive the replay)
+     */
+    explicit ReplayInput(const InputTrace& trace);
+
+    /**
+     * @brief Start playback from the first recorded event
+     * @param speed Playback speed
+     * @param multiplier Speed multiplier for ReplaySpeed::Accelerated
+     */
+    void start(ReplaySpeed speed = ReplaySpeed::RealTime, uint32_t multiplier = 1);
+
+    /**
+     * @brief Stop playback and hand TimeManager back to the system clock
+     */
+    void stop();
+
+    /**
+     * @brief Deliver the next recorded event once it is due
+     *
+     * Stops playback when polled after the last event.
+     *
+     * @param event Reference to store the replayed event
+     * @return true if an event was delivered, false otherwise
+     */
+    bool poll(InputEvent& event) override;
+
+    bool isRunning() const { return _running; }
+    bool isFinished() const { return _index >= _trace.size(); }
+    size_t getEventsReplayed() const { return _index; }
+
+    /**
+     * @brief Wall-clock time spent replaying, for throughput measurement
+     * @return uint32_t Milliseconds from start() to the last event (or now)
+     */
+    uint32_t getWallTimeMs() const;
+
+private:
+    const InputTrace& _trace;
+    ReplaySpeed _speed = ReplaySpeed::RealTime;
+    uint32_t _multiplier = 1;
+    size_t _index = 0;
+    uint32_t _traceStartMs = 0;
+    uint32_t _wallStartMs = 0;
+    uint32_t _wallEndMs = 0;
+    bool _running = false;
+};
@@ -0,0 +1,93 @@
+#ifdef SIMULATOR
+
+#include "TerminalInput.h"
+#include <cstdlib>
+
+bool TerminalInput::pushLine(const String& line) {
+    if (line.empty()) {
+        return false;
+    }
+
+    char key = line[0];
+    int value = line.length() > 1 ? atoi(line.c_str() + 1) : 0;
+
+    // Single digit: lap trigger for that lane
+    if (line.length() == 1 && key >= '1' && key <= '8') {
+        queue(InputCommand::AddLap, key - '0');
+        return true;
+    }
+
+    switch (key) {
+        case '-':
+            queue(InputCommand::RemoveLap, value);
+            return true;
+        case 's':
+            queue(InputCommand::StartCountdown, 0);
+            return true;
+        case 'g':
+            queue(InputCommand::StartRace, 0);
+            return true;
+        case 'p':
+            queue(InputCommand::PauseRace, 0);
+            return true;
+        case 'r':
+            queue(InputCommand::ResumeRace, 0);
+            return true;
+        case 't':
+            queue(InputCommand::StopRace, 0);
+            return true;
+        case 'x':
+            queue(InputCommand::ResetRace, 0);
+            return true;
+        case 'n':
+            queue(InputCommand::SetNumLaps, value);
+            return true;
+        case 'l':
+            queue(InputCommand::SetNumLanes, value);
+            return true;
+        case 'm':
+            queue(InputCommand::ChangeMode, value);
+            return true;
+        case 'e':
+            queue(InputCommand::EnableLane, value);
+            return true;
+        case 'd':
+            queue(InputCommand::DisableLane, value);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool TerminalInput::poll(InputEvent& event) {
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    if (_pending.empty()) {
+        return false;
+    }
+
+    event = _pending.front();
+    _pending.pop_front();
+    return true;
+}
+
+void TerminalInput::printHelp() {
+    Serial.println("Race commands:");
+    Serial.println("  1-8      lap for lane        -N   remove last lap of lane N");
+    Serial.println("  s        start countdown     g    green light (start timer)");
+    Serial.println("  p / r    pause / resume      t / x  stop / reset");
+    Serial.println("  n N      laps                l N  lanes");
+    Serial.println("  m N      mode (1-5)          e N / d N  enable / disable lane");
+}
+
+void TerminalInput::queue(InputCommand command, int value) {
+    InputEvent event;
+    event.command = command;
+    event.sourceId = 0;
+    event.value = value;
+    event.timestamp = 0; // Stamped by InputManager
+    event.target = getDefaultTargetForCommand(command);
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    _pending.push_back(event);
+}
+
+#endif // SIMULATOR
@@ -0,0 +1,54 @@
+#pragma once
+#include <deque>
+#include <mutex>
+#include "InputModule/InputModule.h"
+#include "common/ArduinoCompat.h"
+
+/**
+ * TerminalInput - Turns simulator terminal lines into InputEvents.
+ *
+ * The simulator main loop reads whole lines from the terminal and hands them
+ * to pushLine(); recognised commands are queued and delivered through
+ * InputManager like any other input, so they can be recorded and replayed.
+ * pushLine() and poll() may run on different threads (see
+ * SimRaceController::startCores()).
+ *
+ * Commands (one per line):
+ * - 1-8      Lap trigger for lane 1-8
+ * - -N       Remove the last lap of lane N
+ * - s        Start countdown (prepares the race from the current settings)
+ * - g        Green light: start the race timer
+ * - p / r    Pause / resume
+ * - t / x    Stop / reset
+ * - n N      Set number of laps
+ * - l N      Set number of lanes
+ * - m N      Set race mode (1=LAPS, 2=TIMER, 3=DRAG, 4=RALLY, 5=PRACTISE)
+ * - e N / d N  Enable / disable lane N
+ */
+class TerminalInput : public InputModule {
+public:
+    /**
+     * @brief Parse a terminal line and queue the matching event
+     * @param line Trimmed terminal line
+     * @return true if the line was a race command
+     */
+    bool pushLine(const String& line);
+
+    /**
+     * @brief Deliver the oldest queued command
+     * @param event Reference to store the event
+     * @return true if an event was delivered, false otherwise
+     */
+    bool poll(InputEvent& event) override;
+
+    /**
+     * @brief Print the supported commands to the terminal
+     */
+    static void printHelp();
+
+private:
+    void queue(InputCommand command, int value);
+
+    std::deque<InputEvent> _pending;
+    std::mutex _pendingMutex;
+};
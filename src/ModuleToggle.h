@@ -24,6 +24,7 @@
 #define ENABLE_OUTPUT_SERIAL  // Serial console output
 #define ENABLE_OUTPUT_LCD      // LCD display output
 // #define ENABLE_OUTPUT_WEB     // Web interface output
+// #define ENABLE_OUTPUT_TELEMETRY  // Binary race telemetry on Serial (common/TelemetryProtocol.h)
 
 
 
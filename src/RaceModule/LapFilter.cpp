@@ -0,0 +1,92 @@
+#include "LapFilter.h"
+
+LapFilter::LapFilter() {
+    for (auto& lane : _lanes) {
+        lane.minLapTimeMs = DEFAULT_DEBOUNCE_TIME;
+        lane.glitchWindowMs = DEFAULT_GLITCH_TIME;
+    }
+    reset();
+}
+
+LapFilterResult LapFilter::filter(int laneId, uint32_t timestampMs) {
+    // No debug print - this runs for every sensor trigger
+    if (!isValidLaneId(laneId)) {
+        return LapFilterResult::RejectedGlitch;
+    }
+
+    LaneFilterState& lane = _lanes[laneId - 1];
+
+    // Glitch filter: compare against the previous raw trigger, accepted or not,
+    // so a burst of bounces keeps being rejected until the contact settles
+    bool isGlitch = lane.hasTrigger && (timestampMs - lane.lastTriggerTime) < lane.glitchWindowMs;
+    lane.lastTriggerTime = timestampMs;
+    lane.hasTrigger = true;
+
+    if (isGlitch) {
+        lane.stats.rejectedGlitch++;
+        return LapFilterResult::RejectedGlitch;
+    }
+
+    // Minimum lap time: compare against the last accepted lap only
+    if (lane.hasAccepted && (timestampMs - lane.lastAcceptedTime) < lane.minLapTimeMs) {
+        lane.stats.rejectedMinLap++;
+        return LapFilterResult::RejectedMinLap;
+    }
+
+    lane.lastAcceptedTime = timestampMs;
+    lane.hasAccepted = true;
+    lane.stats.accepted++;
+    return LapFilterResult::Accepted;
+}
+
+void LapFilter::reset() {
+    for (auto& lane : _lanes) {
+        lane.lastTriggerTime = 0;
+        lane.lastAcceptedTime = 0;
+        lane.hasTrigger = false;
+        lane.hasAccepted = false;
+        lane.stats = {0, 0, 0};
+    }
+}
+
+void LapFilter::restoreLastAccepted(int laneId, bool hasAccepted, uint32_t lastAcceptedTimeMs) {
+    if (!isValidLaneId(laneId)) {
+        return;
+    }
+
+    LaneFilterState& lane = _lanes[laneId - 1];
+    lane.lastAcceptedTime = hasAccepted ? lastAcceptedTimeMs : 0;
+    lane.hasAccepted = hasAccepted;
+}
+
+ErrorInfo LapFilter::setMinLapTime(int laneId, uint32_t minLapTimeMs) {
+    if (!isValidLaneId(laneId)) {
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid lane ID", "LapFilter");
+    }
+
+    _lanes[laneId - 1].minLapTimeMs = minLapTimeMs;
+    return ErrorInfo(); // Success
+}
+
+ErrorInfo LapFilter::setGlitchWindow(int laneId, uint32_t glitchWindowMs) {
+    if (!isValidLaneId(laneId)) {
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid lane ID", "LapFilter");
+    }
+
+    _lanes[laneId - 1].glitchWindowMs = glitchWindowMs;
+    return ErrorInfo(); // Success
+}
+
+uint32_t LapFilter::getMinLapTime(int laneId) const {
+    if (!isValidLaneId(laneId)) {
+        return 0;
+    }
+    return _lanes[laneId - 1].minLapTimeMs;
+}
+
+LapFilterStats LapFilter::getStats(int laneId) const {
+    if (!isValidLaneId(laneId)) {
+        return LapFilterStats{0, 0, 0};
+    }
+    return _lanes[laneId - 1].stats;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#ifdef SIMULATOR
+#include "common/ArduinoCompat.h"
+#else
+#include <Arduino.h>
+#endif
+#include "common/Types.h"
+
+/**
+ * @brief Result of passing a sensor trigger through the lap filter
+ */
+enum class LapFilterResult {
+    Accepted,       // Trigger counts as a lap
+    RejectedGlitch, // Trigger too close to the previous raw trigger (contact bounce/noise)
+    RejectedMinLap  // Trigger arrived before the lane's minimum lap time elapsed
+};
+
+/**
+ * @brief Per-lane trigger counters kept by the lap filter
+ */
+struct LapFilterStats {
+    uint32_t accepted;          // Triggers passed on to lap registration
+    uint32_t rejectedGlitch;    // Triggers dropped by the glitch window
+    uint32_t rejectedMinLap;    // Triggers dropped by the minimum lap time
+};
+
+/**
+ * @brief Sensor pre-processing stage that runs ahead of RaceModule::registerLap
+ *
+ * Each lane keeps its own minimum lap time, glitch window and counters in a
+ * fixed-size array, so every trigger is classified in constant time with no
+ * allocation. The filter never delays a trigger: it either accepts it
+ * immediately or drops it and bumps the matching counter.
+ *
+ * - Glitch filtering: a trigger within the glitch window of the previous raw
+ *   trigger on the same lane is treated as contact bounce.
+ * - Minimum lap time: a trigger within the minimum lap time of the last
+ *   accepted lap is treated as a car bouncing on the gate.
+ *
+ * The first trigger after a reset is only subject to glitch filtering, since
+ * cars may be staged right behind the line.
+ */
+class LapFilter {
+public:
+    LapFilter();
+
+    /**
+     * @brief Classify a trigger for a lane and update the lane state
+     *
+     * @param laneId Lane identifier (1-based)
+     * @param timestampMs Trigger time in milliseconds (TimeManager timebase)
+     * @return LapFilterResult Whether the trigger should count as a lap
+     */
+    LapFilterResult filter(int laneId, uint32_t timestampMs);
+
+    /**
+     * @brief Forget trigger history and counters for all lanes
+     *
+     * Settings (minimum lap time, glitch window) are kept.
+     */
+    void reset();
+
+    /**
+     * @brief Roll a lane's last accepted lap back after the lap was removed
+     *
+     * Without this, a genuine crossing right after a removed false lap would
+     * still be measured against the removed lap and dropped as too short.
+     *
+     * @param laneId Lane identifier (1-based)
+     * @param hasAccepted Whether the lane still has an accepted lap
+     * @param lastAcceptedTimeMs Time of the lap that is now the lane's last one
+     */
+    void restoreLastAccepted(int laneId, bool hasAccepted, uint32_t lastAcceptedTimeMs);
+
+    /**
+     * @brief Set the minimum lap time for a lane
+     *
+     * @param laneId Lane identifier (1-based)
+     * @param minLapTimeMs Minimum time between accepted laps in milliseconds
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo setMinLapTime(int laneId, uint32_t minLapTimeMs);
+
+    /**
+     * @brief Set the glitch window for a lane
+     *
+     * @param laneId Lane identifier (1-based)
+     * @param glitchWindowMs Minimum time between raw triggers in milliseconds
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo setGlitchWindow(int laneId, uint32_t glitchWindowMs);
+
+    /**
+     * @brief Get the minimum lap time for a lane
+     *
+     * @param laneId Lane identifier (1-based)
+     * @return uint32_t Minimum lap time in milliseconds, 0 for an invalid lane
+     */
+    uint32_t getMinLapTime(int laneId) const;
+
+    /**
+     * @brief Get the trigger counters for a lane
+     *
+     * @param laneId Lane identifier (1-based)
+     * @return LapFilterStats Counters for the lane (all zero for an invalid lane)
+     */
+    LapFilterStats getStats(int laneId) const;
+
+private:
+    struct LaneFilterState {
+        uint32_t minLapTimeMs;      // Minimum time between accepted laps
+        uint32_t glitchWindowMs;    // Minimum time between raw triggers
+        uint32_t lastTriggerTime;   // Time of the last raw trigger (for glitch filtering)
+        uint32_t lastAcceptedTime;  // Time of the last accepted lap
+        bool hasTrigger;            // Whether lastTriggerTime is valid
+        bool hasAccepted;           // Whether lastAcceptedTime is valid
+        LapFilterStats stats;       // Trigger counters
+    };
+
+    static bool isValidLaneId(int laneId) { return laneId >= 1 && laneId <= MAX_LANES; }
+
+    LaneFilterState _lanes[MAX_LANES];
+};
@@ -0,0 +1,85 @@
+#include "RaceJournal.h"
+#include <string.h>
+
+RaceJournal::RaceJournal()
+    : _nextSequence(1)
+    , _flushedSequence(0)
+    , _droppedEvents(0)
+    , _hasSnapshot(false)
+    , _snapshotPending(false)
+    , _eventSink(nullptr)
+    , _snapshotSink(nullptr) {
+    memset(_events, 0, sizeof(_events));
+    memset(&_snapshot, 0, sizeof(_snapshot));
+}
+
+uint32_t RaceJournal::append(RaceEventType type, uint8_t lane, uint32_t timestamp, uint32_t value) {
+    // No debug print - this is on the lap path
+    uint32_t sequence = _nextSequence++;
+    RaceEvent& event = _events[sequence % RACE_JOURNAL_CAPACITY];
+    event.sequence = sequence;
+    event.timestamp = timestamp;
+    event.value = value;
+    event.type = type;
+    event.lane = lane;
+    event.reserved = 0;
+    return sequence;
+}
+
+void RaceJournal::storeSnapshot(const RaceSnapshot& snapshot) {
+    _snapshot = snapshot;
+    _snapshot.sequence = getLastSequence();
+    _hasSnapshot = true;
+    _snapshotPending = true;
+}
+
+bool RaceJournal::getEvent(uint32_t sequence, RaceEvent& event) const {
+    if (sequence == 0 || sequence >= _nextSequence) {
+        return false;
+    }
+
+    const RaceEvent& slot = _events[sequence % RACE_JOURNAL_CAPACITY];
+    if (slot.sequence != sequence) {
+        return false; // Overwritten
+    }
+
+    event = slot;
+    return true;
+}
+
+void RaceJournal::flush() {
+    uint32_t lastSequence = getLastSequence();
+
+    // Skip events that were overwritten before we got to them
+    if (lastSequence - _flushedSequence > RACE_JOURNAL_CAPACITY) {
+        uint32_t oldestRetained = lastSequence - RACE_JOURNAL_CAPACITY + 1;
+        _droppedEvents += oldestRetained - 1 - _flushedSequence;
+        _flushedSequence = oldestRetained - 1;
+    }
+
+    if (_snapshotPending) {
+        if (_snapshotSink) {
+            _snapshotSink(_snapshot);
+        }
+        _snapshotPending = false;
+    }
+
+    if (_eventSink) {
+        while (_flushedSequence < lastSequence) {
+            _flushedSequence++;
+            _eventSink(_events[_flushedSequence % RACE_JOURNAL_CAPACITY]);
+        }
+    } else {
+        _flushedSequence = lastSequence;
+    }
+}
+
+void RaceJournal::clear() {
+    memset(_events, 0, sizeof(_events));
+    memset(&_snapshot, 0, sizeof(_snapshot));
+    _nextSequence = 1;
+    _flushedSequence = 0;
+    _droppedEvents = 0;
+    _hasSnapshot = false;
+    _snapshotPending = false;
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#ifdef SIMULATOR
+#include "common/ArduinoCompat.h"
+#else
+#include <Arduino.h>
+#endif
+#include <functional>
+#include "common/Types.h"
+
+// Number of events kept in the in-memory journal ring
+#define RACE_JOURNAL_CAPACITY 256
+
+// Take a snapshot after this many events so replay stays bounded
+#define RACE_JOURNAL_SNAPSHOT_INTERVAL 64
+
+/**
+ * @brief Types of events recorded in the race journal
+ */
+enum class RaceEventType : uint8_t {
+    None = 0,
+    StateChanged,   // value = new RaceState
+    RacePrepared,   // Race configured (always followed by a snapshot)
+    RaceReset,      // Race reset (always followed by a snapshot)
+    RaceStarted,    // timestamp = race start time
+    RaceStopped,    // Race stopped
+    RacePaused,     // timestamp = pause time
+    RaceResumed,    // timestamp = resume time
+    LapRegistered,  // lane, timestamp = lap timestamp, value = lap time
+    LapRemoved,     // lane, value = lap number removed
+    LaneEnabled,    // lane
+    LaneDisabled    // lane
+};
+
+/**
+ * @brief Fixed-size binary journal record
+ *
+ * Timestamps are in the TimeManager timebase of the session that recorded
+ * them; RaceModule::replayJournal() moves them onto the current clock.
+ */
+struct RaceEvent {
+    uint32_t sequence;      // Monotonic sequence number (starts at 1)
+    uint32_t timestamp;     // Event time in milliseconds
+    uint32_t value;         // Event specific payload
+    RaceEventType type;     // Event type
+    uint8_t lane;           // Lane identifier (1-based, 0 if not lane specific)
+    uint16_t reserved;      // Padding, keeps the record at 16 bytes
+};
+
+static_assert(sizeof(RaceEvent) == 16, "RaceEvent must stay 16 bytes");
+
+/**
+ * @brief Per-lane portion of a race snapshot
+ */
+struct RaceSnapshotLane {
+    uint32_t bestLapTime;       // Best lap time in milliseconds
+    uint32_t lastLapTime;       // Last lap time in milliseconds
+    uint32_t totalTime;         // Total race time in milliseconds
+    uint32_t lastLapTimestamp;  // Timestamp of the last lap
+    uint16_t currentLap;        // Current lap count
+    uint8_t position;           // Current race position
+    uint8_t flags;              // RACE_SNAPSHOT_LANE_* flags
+};
+
+#define RACE_SNAPSHOT_LANE_ENABLED  0x01
+#define RACE_SNAPSHOT_LANE_FINISHED 0x02
+
+/**
+ * @brief Complete race state at a given journal sequence number
+ *
+ * Replaying the journal starts from the latest snapshot and applies every
+ * event with a greater sequence number.
+ */
+struct RaceSnapshot {
+    uint32_t sequence;              // Last event included in this snapshot (0 = none)
+    uint32_t capturedAt;            // TimeManager time the snapshot was taken
+    uint32_t raceStartTime;         // Race start time
+    uint32_t racePauseTime;         // Time the race was last paused
+    uint32_t raceTotalPausedTime;   // Accumulated pause time
+    uint16_t numLaps;               // Number of laps (LAPS mode)
+    uint16_t raceTimeSeconds;       // Race time in seconds (TIMER mode)
+    uint8_t raceMode;               // RaceMode
+    uint8_t raceState;              // RaceState
+    uint8_t numLanes;               // Number of lanes in the race
+    uint8_t flags;                  // RACE_SNAPSHOT_* flags
+    RaceSnapshotLane lanes[MAX_LANES];
+};
+
+#define RACE_SNAPSHOT_ACTIVE 0x01
+#define RACE_SNAPSHOT_PAUSED 0x02
+
+// Sinks used to hand journal data to persistent storage
+using RaceEventSink = std::function<void(const RaceEvent&)>;
+using RaceSnapshotSink = std::function<void(const RaceSnapshot&)>;
+
+/**
+ * @brief Append-only journal of race events with periodic snapshots
+ *
+ * Events are written into a fixed ring in RAM, so append() is a constant
+ * time copy that never allocates or touches storage. Pending events and
+ * snapshots are handed to the sinks from flush(), which the owner calls
+ * outside the lap path (RaceModule::update()).
+ */
+class RaceJournal {
+public:
+    RaceJournal();
+
+    /**
+     * @brief Append an event to the journal
+     *
+     * @param type Event type
+     * @param lane Lane identifier (1-based, 0 if not lane specific)
+     * @param timestamp Event time in milliseconds
+     * @param value Event specific payload
+     * @return uint32_t Sequence number assigned to the event
+     */
+    uint32_t append(RaceEventType type, uint8_t lane, uint32_t timestamp, uint32_t value = 0);
+
+    /**
+     * @brief Store a snapshot covering every event appended so far
+     *
+     * @param snapshot Race state; its sequence field is overwritten
+     */
+    void storeSnapshot(const RaceSnapshot& snapshot);
+
+    /**
+     * @brief Look up a retained event by sequence number
+     *
+     * @param sequence Sequence number
+     * @param event Receives the event if found
+     * @return bool true if the event is still held in the ring
+     */
+    bool getEvent(uint32_t sequence, RaceEvent& event) const;
+
+    /**
+     * @brief Hand the latest snapshot and pending events to the sinks
+     *
+     * The snapshot goes first, so a sink that starts over on every snapshot
+     * keeps the events recorded after it.
+     */
+    void flush();
+
+    /**
+     * @brief Drop all events and the snapshot
+     */
+    void clear();
+
+    bool hasSnapshot() const { return _hasSnapshot; }
+    const RaceSnapshot& getSnapshot() const { return _snapshot; }
+    uint32_t getLastSequence() const { return _nextSequence - 1; }
+    uint32_t getEventsSinceSnapshot() const { return getLastSequence() - _snapshot.sequence; }
+
+    /**
+     * @brief Number of events overwritten before they could be flushed
+     */
+    uint32_t getDroppedEvents() const { return _droppedEvents; }
+
+    void setEventSink(RaceEventSink sink) { _eventSink = sink; }
+    void setSnapshotSink(RaceSnapshotSink sink) { _snapshotSink = sink; }
+
+private:
+    RaceEvent _events[RACE_JOURNAL_CAPACITY];
+    uint32_t _nextSequence;
+    uint32_t _flushedSequence;
+    uint32_t _droppedEvents;
+    RaceSnapshot _snapshot;
+    bool _hasSnapshot;
+    bool _snapshotPending;
+    RaceEventSink _eventSink;
+    RaceSnapshotSink _snapshotSink;
+};
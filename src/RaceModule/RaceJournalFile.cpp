@@ -0,0 +1,112 @@
+#include "RaceJournalFile.h"
+#include <cstring>
+
+RaceJournalFile::RaceJournalFile(const String& path)
+    : _path(path)
+    , _file(nullptr)
+    , _snapshotSequence(0) {
+}
+
+RaceJournalFile::~RaceJournalFile() {
+    close();
+}
+
+void RaceJournalFile::attach(RaceJournal& journal) {
+    journal.setSnapshotSink([this](const RaceSnapshot& snapshot) { writeSnapshot(snapshot); });
+    journal.setEventSink([this](const RaceEvent& event) { appendEvent(event); });
+}
+
+ErrorInfo RaceJournalFile::writeSnapshot(const RaceSnapshot& snapshot) {
+    close();
+
+    String tempPath = _path + ".tmp";
+    FILE* file = fopen(tempPath.c_str(), "wb");
+    if (file == nullptr) {
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to open journal file", "RaceJournalFile");
+    }
+
+    RaceJournalFileHeader header;
+    memcpy(header.magic, RACE_JOURNAL_FILE_MAGIC, sizeof(header.magic));
+    header.version = RACE_JOURNAL_FILE_VERSION;
+    header.snapshotSize = sizeof(RaceSnapshot);
+    header.recordSize = sizeof(RaceEvent);
+    header.reserved = 0;
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(&snapshot, sizeof(snapshot), 1, file) == 1;
+    ok = (fclose(file) == 0) && ok;
+    if (!ok) {
+        remove(tempPath.c_str());
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to write journal file", "RaceJournalFile");
+    }
+
+    // rename() does not replace an existing file on every platform
+    if (rename(tempPath.c_str(), _path.c_str()) != 0) {
+        remove(_path.c_str());
+        if (rename(tempPath.c_str(), _path.c_str()) != 0) {
+            return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to replace journal file", "RaceJournalFile");
+        }
+    }
+
+    _file = fopen(_path.c_str(), "ab");
+    if (_file == nullptr) {
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to open journal file", "RaceJournalFile");
+    }
+    _snapshotSequence = snapshot.sequence;
+    return ErrorInfo(); // Success
+}
+
+ErrorInfo RaceJournalFile::appendEvent(const RaceEvent& event) {
+    if (_file == nullptr || event.sequence <= _snapshotSequence) {
+        return ErrorInfo(); // Nothing to add to
+    }
+
+    if (fwrite(&event, sizeof(event), 1, _file) != 1 || fflush(_file) != 0) {
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to append journal event", "RaceJournalFile");
+    }
+    return ErrorInfo(); // Success
+}
+
+ErrorInfo RaceJournalFile::load(const String& path, RaceSnapshot& snapshot, std::vector<RaceEvent>& events) {
+    // A power cut between replacing steps can leave only the new file under its temporary name
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        file = fopen((path + ".tmp").c_str(), "rb");
+    }
+    if (file == nullptr) {
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Failed to open journal file", "RaceJournalFile");
+    }
+
+    RaceJournalFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, RACE_JOURNAL_FILE_MAGIC, sizeof(header.magic)) != 0) {
+        fclose(file);
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Not a race journal file", "RaceJournalFile");
+    }
+
+    if (header.version != RACE_JOURNAL_FILE_VERSION ||
+        header.snapshotSize != sizeof(RaceSnapshot) || header.recordSize != sizeof(RaceEvent)) {
+        fclose(file);
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Unsupported race journal version", "RaceJournalFile");
+    }
+
+    if (fread(&snapshot, sizeof(snapshot), 1, file) != 1) {
+        fclose(file);
+        return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Truncated race journal file", "RaceJournalFile");
+    }
+
+    events.clear();
+    RaceEvent event;
+    while (fread(&event, sizeof(event), 1, file) == 1) {
+        events.push_back(event);
+    }
+    fclose(file);
+    return ErrorInfo(); // Success
+}
+
+void RaceJournalFile::close() {
+    if (_file != nullptr) {
+        fclose(_file);
+        _file = nullptr;
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#ifdef SIMULATOR
+#include "common/ArduinoCompat.h"
+#else
+#include <Arduino.h>
+#endif
+#include <cstdio>
+#include <vector>
+#include "common/Types.h"
+#include "RaceJournal.h"
+
+/**
+ * RaceJournalFile - File storage for the race journal.
+ *
+ * File format (little-endian, native struct layout):
+ * - RaceJournalFileHeader: magic "RJNL", format version, snapshot and record sizes
+ * - one RaceSnapshot
+ * - RaceEvent records (16 bytes each) recorded after the snapshot
+ *
+ * Every snapshot starts a new file, written next to the old one and then
+ * renamed over it, so a power cut leaves either the old or the new file.
+ * Events are appended and flushed one by one; a torn record at the end is
+ * ignored on load.
+ */
+
+#define RACE_JOURNAL_FILE_MAGIC "RJNL"
+#define RACE_JOURNAL_FILE_VERSION 1
+
+struct RaceJournalFileHeader {
+    char magic[4];          // RACE_JOURNAL_FILE_MAGIC
+    uint16_t version;       // RACE_JOURNAL_FILE_VERSION
+    uint16_t snapshotSize;  // sizeof(RaceSnapshot)
+    uint16_t recordSize;    // sizeof(RaceEvent)
+    uint16_t reserved;      // Padding, keeps the header at 12 bytes
+};
+
+static_assert(sizeof(RaceJournalFileHeader) == 12, "RaceJournalFileHeader must stay 12 bytes");
+
+class RaceJournalFile {
+public:
+    /**
+     * @brief Create storage for a journal file
+     * @param path File path; nothing is written until the first snapshot
+     */
+    explicit RaceJournalFile(const String& path);
+    ~RaceJournalFile();
+
+    RaceJournalFile(const RaceJournalFile&) = delete;
+    RaceJournalFile& operator=(const RaceJournalFile&) = delete;
+
+    /**
+     * @brief Install this file as the journal's event and snapshot sinks
+     * @param journal Journal to persist
+     */
+    void attach(RaceJournal& journal);
+
+    /**
+     * @brief Start a new file holding only this snapshot
+     * @param snapshot Snapshot to store
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo writeSnapshot(const RaceSnapshot& snapshot);
+
+    /**
+     * @brief Append an event recorded after the stored snapshot
+     *
+     * Events from before the snapshot, or before any snapshot was written,
+     * are skipped since replay would ignore them.
+     *
+     * @param event Journal event
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo appendEvent(const RaceEvent& event);
+
+    /**
+     * @brief Read a journal file written by RaceJournalFile
+     * @param path File path
+     * @param snapshot Receives the stored snapshot
+     * @param events Receives the events stored after the snapshot
+     * @return ErrorInfo Error information (success or failure)
+     */
+    static ErrorInfo load(const String& path, RaceSnapshot& snapshot, std::vector<RaceEvent>& events);
+
+    const String& getPath() const { return _path; }
+
+private:
+    void close();
+
+    String _path;
+    FILE* _file;
+    uint32_t _snapshotSequence;
+};
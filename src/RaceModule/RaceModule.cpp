@@ -1,6 +1,7 @@
 #include "RaceModule.h"
 #include "DisplayModule/DisplayManager.h"
 #include <algorithm>
+#include <string.h>
 
 // Throttle debug prints to once every 5 seconds
 static unsigned long lastDebugPrint = 0;
@@ -42,8 +43,6 @@ RaceModule::RaceModule()
     , _numLanes(0)
     , _numLaps(0)
     , _raceTimeSeconds(0)
-    , _lastUpdateTime(0)
-    , _updateIntervalMs(100)
     , _countdownTimeMs(0)
     , _countdownStartTime(0)
     , _raceState(RaceState::Idle)
@@ -51,7 +50,10 @@ RaceModule::RaceModule()
     , _onSecondTickCallback(nullptr)
     , _onLapRegisteredCallback(nullptr) {
     DEBUG_PRINT_METHOD();
-    // Constructor implementation
+    clearLapHistory();
+    for (int i = 0; i < MAX_LANES; i++) {
+        _racerNames[i] = "Racer " + String(i + 1);
+    }
 }
 
 bool RaceModule::initialize() {
@@ -96,12 +98,11 @@ void RaceModule::update() {
     
     uint32_t currentTime = TimeManager::GetInstance().GetCurrentTimeMs();
     
-    // Only update at specified intervals to reduce processing load
-    if (currentTime - _lastUpdateTime < _updateIntervalMs) {
-        return;
+    // Keep journal replay bounded and hand pending events to storage
+    if (_journal.getEventsSinceSnapshot() >= RACE_JOURNAL_SNAPSHOT_INTERVAL) {
+        takeSnapshot();
     }
-    
-    _lastUpdateTime = currentTime;
+    _journal.flush();
     
     // Handle different race states
     switch (_raceState) {
@@ -118,14 +119,8 @@ void RaceModule::update() {
                 // Calculate race time
                 uint32_t raceTimeMs = currentTime - _raceStartTime - _raceTotalPausedTime;
                 
-                // Update the display with current race data
-                std::vector<RaceLaneData> laneData;
-                for (const auto& lane : _lanes) {
-                    if (lane.enabled) {
-                        laneData.push_back(lane);
-                    }
-                }
-                DisplayManager::getInstance().updateRaceData(laneData);
+                // Running clocks changed; the display picks this up with its next frame
+                DisplayManager::getInstance().markRaceDataDirty();
                 
                 // Check for second tick for clock updates
                 static uint32_t lastSecond = 0;
@@ -198,7 +193,7 @@ ErrorInfo RaceModule::prepareRace(RaceMode mode, int numLanes, int numLaps, int
     for (int i = 1; i <= numLanes; i++) {
         RaceLaneData lane;
         lane.laneId = i;
-        lane.racerName = "Racer " + String(i);
+        lane.racerName = _racerNames[i - 1];
         lane.currentLap = 0;
         lane.totalLaps = numLaps;
         lane.finished = false;
@@ -211,6 +206,13 @@ ErrorInfo RaceModule::prepareRace(RaceMode mode, int numLanes, int numLaps, int
         _lanes.push_back(lane);
     }
     
+    // Start the new race with clean trigger history and counters
+    _lapFilter.reset();
+    clearLapHistory();
+    
+    _journal.append(RaceEventType::RacePrepared, 0, TimeManager::GetInstance().GetCurrentTimeMs(), (uint32_t)mode);
+    takeSnapshot();
+    
     return ErrorInfo(); // Success
 }
 
@@ -245,6 +247,7 @@ ErrorInfo RaceModule::startRace() {
     _racePaused = false;
     _raceStartTime = TimeManager::GetInstance().GetCurrentTimeMs();
     _raceTotalPausedTime = 0;
+    _journal.append(RaceEventType::RaceStarted, 0, _raceStartTime);
     
     // Transition to active state
     setRaceState(RaceState::Active);
@@ -269,6 +272,7 @@ ErrorInfo RaceModule::pauseRace() {
     // Pause the race
     _racePaused = true;
     _racePauseTime = TimeManager::GetInstance().GetCurrentTimeMs();
+    _journal.append(RaceEventType::RacePaused, 0, _racePauseTime);
     
     // Transition to paused state
     setRaceState(RaceState::Paused);
@@ -287,8 +291,10 @@ ErrorInfo RaceModule::resumeRace() {
     }
     
     // Resume the race
+    uint32_t currentTime = TimeManager::GetInstance().GetCurrentTimeMs();
     _racePaused = false;
-    _raceTotalPausedTime += TimeManager::GetInstance().GetCurrentTimeMs() - _racePauseTime;
+    _raceTotalPausedTime += currentTime - _racePauseTime;
+    _journal.append(RaceEventType::RaceResumed, 0, currentTime);
     
     // Transition back to active state
     setRaceState(RaceState::Active);
@@ -309,6 +315,7 @@ ErrorInfo RaceModule::stopRace() {
     // Stop the race
     _raceActive = false;
     _racePaused = false;
+    _journal.append(RaceEventType::RaceStopped, 0, TimeManager::GetInstance().GetCurrentTimeMs());
     
     // Transition to idle state
     setRaceState(RaceState::Idle);
@@ -322,26 +329,14 @@ ErrorInfo RaceModule::resetRace() {
         return ErrorInfo(ErrorCode::NOT_INITIALIZED, "RaceModule not initialized", "RaceModule");
     }
     
-    // Reset race parameters
-    _raceActive = false;
-    _racePaused = false;
-    _raceStartTime = 0;
-    _racePauseTime = 0;
-    _raceTotalPausedTime = 0;
-    
-    // Reset lane data
-    for (auto& lane : _lanes) {
-        lane.currentLap = 0;
-        lane.finished = false;
-        lane.bestLapTime = 0;
-        lane.lastLapTime = 0;
-        lane.totalTime = 0;
-        lane.lastLapTimestamp = 0;
-        lane.position = 0;
-    }
+    // Reset race parameters and lane data
+    clearRaceProgress();
+    _lapFilter.reset();
+    _journal.append(RaceEventType::RaceReset, 0, TimeManager::GetInstance().GetCurrentTimeMs());
     
     // Transition to idle state
     setRaceState(RaceState::Idle);
+    takeSnapshot();
     
     return ErrorInfo(); // Success
 }
@@ -380,39 +375,28 @@ ErrorInfo RaceModule::registerLap(int lane) {
     
     // Get current time
     uint32_t currentTime = TimeManager::GetInstance().GetCurrentTimeMs();
-    uint32_t raceTimeMs = currentTime - _raceStartTime - _raceTotalPausedTime;
     
-    // Calculate lap time
-    uint32_t lapTime;
-    if (it->currentLap == 0) {
-        lapTime = raceTimeMs;
-    } else {
-        lapTime = currentTime - it->lastLapTimestamp;
+    // Drop sensor bounce and triggers faster than the lane's minimum lap time
+    switch (_lapFilter.filter(lane, currentTime)) {
+        case LapFilterResult::RejectedGlitch:
+            return ErrorInfo(ErrorCode::FILTERED, "Trigger rejected as glitch", "RaceModule");
+        case LapFilterResult::RejectedMinLap:
+            return ErrorInfo(ErrorCode::FILTERED, "Trigger rejected below minimum lap time", "RaceModule");
+        case LapFilterResult::Accepted:
+        default:
+            break;
     }
     
-    // Update lap data
-    it->currentLap++;
-    it->lastLapTime = lapTime;
-    it->lastLapTimestamp = currentTime;
-    it->totalTime = raceTimeMs;
+    uint32_t lapTime = applyLap(*it, currentTime);
+    _journal.append(RaceEventType::LapRegistered, (uint8_t)lane, currentTime, lapTime);
     
-    // Update best lap time
-    if (it->bestLapTime == 0 || lapTime < it->bestLapTime) {
-        it->bestLapTime = lapTime;
+    // Check if all lanes have finished
+    if (it->finished && isRaceFinished()) {
+        setRaceState(RaceState::Finished);
     }
     
-    // Check if lane has finished the race
-    if (_raceMode == RaceMode::LAPS && it->currentLap >= it->totalLaps) {
-        it->finished = true;
-        
-        // Update positions
-        updatePositions();
-        
-        // Check if all lanes have finished
-        if (isRaceFinished()) {
-            setRaceState(RaceState::Finished);
-        }
-    }
+    // Laps are shown without waiting for the next display frame
+    DisplayManager::getInstance().markRaceDataDirty(true);
     
     // Notify observers
     if (_onLapRegisteredCallback) {
@@ -422,6 +406,40 @@ ErrorInfo RaceModule::registerLap(int lane) {
     return ErrorInfo(); // Success
 }
 
+ErrorInfo RaceModule::removeLap(int lane) {
+    DEBUG_PRINT_METHOD();
+    if (!_initialized) {
+        return ErrorInfo(ErrorCode::NOT_INITIALIZED, "RaceModule not initialized", "RaceModule");
+    }
+    
+    if (_raceState != RaceState::Active && _raceState != RaceState::Paused && _raceState != RaceState::Finished) {
+        return ErrorInfo(ErrorCode::INVALID_STATE, "No race to correct", "RaceModule");
+    }
+    
+    if (!isValidLaneId(lane)) {
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid lane number", "RaceModule");
+    }
+    
+    RaceLaneData& laneData = getLaneDataRef(lane);
+    int removedLap = laneData.currentLap;
+    if (!applyLapRemoval(laneData)) {
+        return ErrorInfo(ErrorCode::INVALID_STATE, "No lap history to remove", "RaceModule");
+    }
+    
+    // The previous lap is again the one the minimum lap time is measured from
+    _lapFilter.restoreLastAccepted(lane, laneData.currentLap > 0, laneData.lastLapTimestamp);
+    _journal.append(RaceEventType::LapRemoved, (uint8_t)lane, TimeManager::GetInstance().GetCurrentTimeMs(), (uint32_t)removedLap);
+    
+    // A lane that is no longer finished reopens a finished race
+    if (_raceState == RaceState::Finished && !isRaceFinished()) {
+        setRaceState(_racePaused ? RaceState::Paused : RaceState::Active);
+    }
+    
+    DisplayManager::getInstance().markRaceDataDirty(true);
+    
+    return ErrorInfo(); // Success
+}
+
 RaceState RaceModule::getRaceState() const {
     DEBUG_PRINT_METHOD();
     return _raceState;
@@ -447,6 +465,18 @@ const std::vector<RaceLaneData>& RaceModule::getAllLaneData() const {
     return _lanes;
 }
 
+std::vector<RaceLaneData> RaceModule::createLaneSnapshot() const {
+    // No debug print - called for every display refresh
+    std::vector<RaceLaneData> laneData;
+    laneData.reserve(_lanes.size());
+    for (const auto& lane : _lanes) {
+        if (lane.enabled) {
+            laneData.push_back(lane);
+        }
+    }
+    return laneData;
+}
+
 RaceLaneData& RaceModule::getLaneDataRef(int laneId) {
     DEBUG_PRINT_METHOD();
     // Find the lane data with the specified ID
@@ -533,6 +563,7 @@ void RaceModule::setRaceState(RaceState newState) {
     DEBUG_PRINT_METHOD();
     if (_raceState != newState) {
         _raceState = newState;
+        _journal.append(RaceEventType::StateChanged, 0, TimeManager::GetInstance().GetCurrentTimeMs(), (uint32_t)newState);
         
         // Notify observers of state change
         if (_onRaceStateChangedCallback) {
@@ -541,6 +572,104 @@ void RaceModule::setRaceState(RaceState newState) {
     }
 }
 
+// Helper method to apply a lap to a lane (registerLap and journal replay)
+uint32_t RaceModule::applyLap(RaceLaneData& laneData, uint32_t currentTime) {
+    // No debug print - this is on the lap path
+    uint32_t raceTimeMs = currentTime - _raceStartTime - _raceTotalPausedTime;
+    
+    // Calculate lap time
+    uint32_t lapTime;
+    if (laneData.currentLap == 0) {
+        lapTime = raceTimeMs;
+    } else {
+        lapTime = currentTime - laneData.lastLapTimestamp;
+    }
+    
+    // Keep the pre-lap state so the lap can be removed later
+    int laneIndex = laneData.laneId - 1;
+    if (laneIndex >= 0 && laneIndex < MAX_LANES) {
+        LapHistoryEntry& entry = _lapHistory[laneIndex][laneData.currentLap % RACE_LAP_HISTORY_DEPTH];
+        entry.lastLapTime = laneData.lastLapTime;
+        entry.bestLapTime = laneData.bestLapTime;
+        entry.totalTime = laneData.totalTime;
+        entry.lastLapTimestamp = laneData.lastLapTimestamp;
+        entry.finished = laneData.finished;
+        if (_lapHistoryCount[laneIndex] < RACE_LAP_HISTORY_DEPTH) {
+            _lapHistoryCount[laneIndex]++;
+        }
+    }
+    
+    // Update lap data
+    laneData.currentLap++;
+    laneData.lastLapTime = lapTime;
+    laneData.lastLapTimestamp = currentTime;
+    laneData.totalTime = raceTimeMs;
+    
+    // Update best lap time
+    if (laneData.bestLapTime == 0 || lapTime < laneData.bestLapTime) {
+        laneData.bestLapTime = lapTime;
+    }
+    
+    // Check if lane has finished the race
+    if (_raceMode == RaceMode::LAPS && laneData.currentLap >= laneData.totalLaps) {
+        laneData.finished = true;
+        
+        // Update positions
+        updatePositions();
+    }
+    
+    return lapTime;
+}
+
+// Helper method to undo a lane's most recent lap (removeLap and journal replay)
+bool RaceModule::applyLapRemoval(RaceLaneData& laneData) {
+    int laneIndex = laneData.laneId - 1;
+    if (laneIndex < 0 || laneIndex >= MAX_LANES || laneData.currentLap <= 0 || _lapHistoryCount[laneIndex] == 0) {
+        return false;
+    }
+    
+    laneData.currentLap--;
+    const LapHistoryEntry& entry = _lapHistory[laneIndex][laneData.currentLap % RACE_LAP_HISTORY_DEPTH];
+    _lapHistoryCount[laneIndex]--;
+    
+    laneData.lastLapTime = entry.lastLapTime;
+    laneData.bestLapTime = entry.bestLapTime;
+    laneData.totalTime = entry.totalTime;
+    laneData.lastLapTimestamp = entry.lastLapTimestamp;
+    laneData.finished = entry.finished;
+    
+    // Other lanes may have moved on since this lap, so rank from current state
+    updatePositions();
+    
+    return true;
+}
+
+// Helper method to forget lap history for all lanes
+void RaceModule::clearLapHistory() {
+    memset(_lapHistory, 0, sizeof(_lapHistory));
+    memset(_lapHistoryCount, 0, sizeof(_lapHistoryCount));
+}
+
+// Helper method to clear race timing and lane progress
+void RaceModule::clearRaceProgress() {
+    _raceActive = false;
+    _racePaused = false;
+    _raceStartTime = 0;
+    _racePauseTime = 0;
+    _raceTotalPausedTime = 0;
+    
+    for (auto& lane : _lanes) {
+        lane.currentLap = 0;
+        lane.finished = false;
+        lane.bestLapTime = 0;
+        lane.lastLapTime = 0;
+        lane.totalTime = 0;
+        lane.lastLapTimestamp = 0;
+        lane.position = 0;
+    }
+    clearLapHistory();
+}
+
 // Helper method to update race positions
 void RaceModule::updatePositions() {
     DEBUG_PRINT_METHOD();
@@ -620,6 +749,7 @@ ErrorInfo RaceModule::enableLane(int laneId) {
             
             // Enable the lane
             lane.enabled = true;
+            _journal.append(RaceEventType::LaneEnabled, (uint8_t)laneId, TimeManager::GetInstance().GetCurrentTimeMs());
             DisplayManager::getInstance().debug("Lane " + String(laneId) + " enabled", "RaceModule");
             return ErrorInfo(); // Success
         }
@@ -651,6 +781,7 @@ ErrorInfo RaceModule::disableLane(int laneId) {
             
             // Disable the lane
             lane.enabled = false;
+            _journal.append(RaceEventType::LaneDisabled, (uint8_t)laneId, TimeManager::GetInstance().GetCurrentTimeMs());
             DisplayManager::getInstance().debug("Lane " + String(laneId) + " disabled", "RaceModule");
             return ErrorInfo(); // Success
         }
@@ -659,3 +790,233 @@ ErrorInfo RaceModule::disableLane(int laneId) {
     // Lane not found (shouldn't happen if isValidLaneId passed)
     return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Lane not found", "RaceModule");
 }
+
+ErrorInfo RaceModule::setRacerName(int laneId, const String& name) {
+    DEBUG_PRINT_METHOD();
+    if (laneId < 1 || laneId > MAX_LANES) {
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid lane ID", "RaceModule");
+    }
+    
+    _racerNames[laneId - 1] = name;
+    if (isValidLaneId(laneId)) {
+        getLaneDataRef(laneId).racerName = name;
+    }
+    return ErrorInfo(); // Success
+}
+
+ErrorInfo RaceModule::setLaneMinLapTime(int laneId, uint32_t minLapTimeMs) {
+    DEBUG_PRINT_METHOD();
+    return _lapFilter.setMinLapTime(laneId, minLapTimeMs);
+}
+
+ErrorInfo RaceModule::setLaneGlitchWindow(int laneId, uint32_t glitchWindowMs) {
+    DEBUG_PRINT_METHOD();
+    return _lapFilter.setGlitchWindow(laneId, glitchWindowMs);
+}
+
+ErrorInfo RaceModule::replayJournal(const RaceSnapshot& snapshot, const RaceEvent* events, size_t count) {
+    DEBUG_PRINT_METHOD();
+    if (!_initialized) {
+        return ErrorInfo(ErrorCode::NOT_INITIALIZED, "RaceModule not initialized", "RaceModule");
+    }
+    
+    if (snapshot.numLanes == 0 || snapshot.numLanes > MAX_LANES) {
+        return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid journal snapshot", "RaceModule");
+    }
+    
+    restoreSnapshot(snapshot);
+    uint32_t lastRecordedTime = snapshot.capturedAt;
+    for (size_t i = 0; i < count; i++) {
+        if (events[i].sequence <= snapshot.sequence) {
+            continue;
+        }
+        if (!applyEvent(events[i])) {
+            return ErrorInfo(ErrorCode::INVALID_STATE, "Journal event could not be replayed", "RaceModule");
+        }
+        lastRecordedTime = events[i].timestamp;
+    }
+    
+    // The journal was recorded on the clock of an earlier session (e.g. before
+    // a brownout), so race time carries on from the last recorded moment
+    rebaseTimestamps(TimeManager::GetInstance().GetCurrentTimeMs() - lastRecordedTime);
+    
+    // Restart the journal from the restored state
+    _journal.clear();
+    _lapFilter.reset();
+    takeSnapshot();
+    
+    return ErrorInfo(); // Success
+}
+
+ErrorInfo RaceModule::rebuildFromJournal() {
+    DEBUG_PRINT_METHOD();
+    if (!_initialized) {
+        return ErrorInfo(ErrorCode::NOT_INITIALIZED, "RaceModule not initialized", "RaceModule");
+    }
+    
+    if (!_journal.hasSnapshot()) {
+        return ErrorInfo(ErrorCode::INVALID_STATE, "No journal snapshot", "RaceModule");
+    }
+    
+    // Make sure every event since the snapshot is still held before touching state
+    uint32_t lastSequence = _journal.getLastSequence();
+    RaceEvent event;
+    for (uint32_t seq = _journal.getSnapshot().sequence + 1; seq <= lastSequence; seq++) {
+        if (!_journal.getEvent(seq, event)) {
+            return ErrorInfo(ErrorCode::RESOURCE_ERROR, "Journal events missing", "RaceModule");
+        }
+    }
+    
+    restoreSnapshot(_journal.getSnapshot());
+    for (uint32_t seq = _journal.getSnapshot().sequence + 1; seq <= lastSequence; seq++) {
+        _journal.getEvent(seq, event);
+        if (!applyEvent(event)) {
+            return ErrorInfo(ErrorCode::INVALID_STATE, "Journal event could not be replayed", "RaceModule");
+        }
+    }
+    
+    return ErrorInfo(); // Success
+}
+
+void RaceModule::rebaseTimestamps(uint32_t offsetMs) {
+    // Unsigned wrap-around keeps the differences right even if the new clock is behind
+    _raceStartTime += offsetMs;
+    _racePauseTime += offsetMs;
+    for (auto& lane : _lanes) {
+        lane.lastLapTimestamp += offsetMs;
+    }
+}
+
+void RaceModule::takeSnapshot() {
+    RaceSnapshot snapshot;
+    captureSnapshot(snapshot);
+    _journal.storeSnapshot(snapshot);
+    
+    // Lap history is not part of the snapshot, so a lap from before it could
+    // not be removed again on replay; keep live undo within the snapshot too
+    clearLapHistory();
+}
+
+void RaceModule::captureSnapshot(RaceSnapshot& snapshot) const {
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.capturedAt = TimeManager::GetInstance().GetCurrentTimeMs();
+    snapshot.raceStartTime = _raceStartTime;
+    snapshot.racePauseTime = _racePauseTime;
+    snapshot.raceTotalPausedTime = _raceTotalPausedTime;
+    snapshot.numLaps = (uint16_t)_numLaps;
+    snapshot.raceTimeSeconds = (uint16_t)_raceTimeSeconds;
+    snapshot.raceMode = (uint8_t)_raceMode;
+    snapshot.raceState = (uint8_t)_raceState;
+    snapshot.numLanes = (uint8_t)_lanes.size();
+    snapshot.flags = (_raceActive ? RACE_SNAPSHOT_ACTIVE : 0) | (_racePaused ? RACE_SNAPSHOT_PAUSED : 0);
+    
+    for (size_t i = 0; i < _lanes.size() && i < MAX_LANES; i++) {
+        const RaceLaneData& lane = _lanes[i];
+        RaceSnapshotLane& out = snapshot.lanes[i];
+        out.bestLapTime = lane.bestLapTime;
+        out.lastLapTime = lane.lastLapTime;
+        out.totalTime = lane.totalTime;
+        out.lastLapTimestamp = lane.lastLapTimestamp;
+        out.currentLap = (uint16_t)lane.currentLap;
+        out.position = (uint8_t)lane.position;
+        out.flags = (lane.enabled ? RACE_SNAPSHOT_LANE_ENABLED : 0) | (lane.finished ? RACE_SNAPSHOT_LANE_FINISHED : 0);
+    }
+}
+
+void RaceModule::restoreSnapshot(const RaceSnapshot& snapshot) {
+    _raceStartTime = snapshot.raceStartTime;
+    _racePauseTime = snapshot.racePauseTime;
+    _raceTotalPausedTime = snapshot.raceTotalPausedTime;
+    _numLaps = snapshot.numLaps;
+    _raceTimeSeconds = snapshot.raceTimeSeconds;
+    _raceMode = (RaceMode)snapshot.raceMode;
+    _raceState = (RaceState)snapshot.raceState;
+    _numLanes = snapshot.numLanes;
+    _raceActive = (snapshot.flags & RACE_SNAPSHOT_ACTIVE) != 0;
+    _racePaused = (snapshot.flags & RACE_SNAPSHOT_PAUSED) != 0;
+    
+    // Lap history is not part of the snapshot; only laps replayed after it can be removed
+    clearLapHistory();
+    _lanes.clear();
+    for (int i = 0; i < _numLanes; i++) {
+        const RaceSnapshotLane& in = snapshot.lanes[i];
+        RaceLaneData lane;
+        lane.laneId = i + 1;
+        lane.racerName = _racerNames[i];
+        lane.currentLap = in.currentLap;
+        lane.totalLaps = _numLaps;
+        lane.finished = (in.flags & RACE_SNAPSHOT_LANE_FINISHED) != 0;
+        lane.enabled = (in.flags & RACE_SNAPSHOT_LANE_ENABLED) != 0;
+        lane.bestLapTime = in.bestLapTime;
+        lane.lastLapTime = in.lastLapTime;
+        lane.totalTime = in.totalTime;
+        lane.lastLapTimestamp = in.lastLapTimestamp;
+        lane.position = in.position;
+        _lanes.push_back(lane);
+    }
+}
+
+bool RaceModule::applyEvent(const RaceEvent& event) {
+    // Mirrors the public methods without journaling or firing callbacks
+    switch (event.type) {
+        case RaceEventType::StateChanged:
+            _raceState = (RaceState)event.value;
+            break;
+            
+        case RaceEventType::RaceReset:
+            clearRaceProgress();
+            break;
+            
+        case RaceEventType::RaceStarted:
+            _raceActive = true;
+            _racePaused = false;
+            _raceStartTime = event.timestamp;
+            _raceTotalPausedTime = 0;
+            break;
+            
+        case RaceEventType::RaceStopped:
+            _raceActive = false;
+            _racePaused = false;
+            break;
+            
+        case RaceEventType::RacePaused:
+            _racePaused = true;
+            _racePauseTime = event.timestamp;
+            break;
+            
+        case RaceEventType::RaceResumed:
+            _racePaused = false;
+            _raceTotalPausedTime += event.timestamp - _racePauseTime;
+            break;
+            
+        case RaceEventType::LapRegistered:
+            if (!isValidLaneId(event.lane)) {
+                return false;
+            }
+            applyLap(getLaneDataRef(event.lane), event.timestamp);
+            break;
+            
+        case RaceEventType::LaneEnabled:
+        case RaceEventType::LaneDisabled:
+            if (!isValidLaneId(event.lane)) {
+                return false;
+            }
+            getLaneDataRef(event.lane).enabled = (event.type == RaceEventType::LaneEnabled);
+            break;
+            
+        case RaceEventType::LapRemoved:
+            // The live removal succeeded, so the lap must be in the replayed history
+            if (!isValidLaneId(event.lane) || !applyLapRemoval(getLaneDataRef(event.lane))) {
+                return false;
+            }
+            break;
+            
+        case RaceEventType::RacePrepared:
+            // Race parameters are carried by the snapshot taken right after this event
+        case RaceEventType::None:
+        default:
+            break;
+    }
+    
+    return true;
+}
@@ -9,6 +9,8 @@
 #include <functional>
 #include "common/TimeManager.h"
 #include "common/Types.h"
+#include "LapFilter.h"
+#include "RaceJournal.h"
 
 /**
  * @brief Race state enumeration
@@ -22,6 +24,9 @@ enum class RaceState {
     Finished    // Race is finished
 };
 
+// Number of most recent laps per lane that can be removed with removeLap()
+#define RACE_LAP_HISTORY_DEPTH 32
+
 /**
  * @brief Data structure for tracking each lane's race progress
  */
@@ -39,6 +44,17 @@ struct RaceLaneData {
     int position;               // Current race position
 };
 
+/**
+ * @brief Lane state captured before a lap was applied, used to undo it
+ */
+struct LapHistoryEntry {
+    uint32_t lastLapTime;       // Last lap time before the lap
+    uint32_t bestLapTime;       // Best lap time before the lap
+    uint32_t totalTime;         // Total race time before the lap
+    uint32_t lastLapTimestamp;  // Timestamp of the previous lap (the lap filter's previous accepted time)
+    bool finished;              // Finished flag before the lap
+};
+
 // Callback function types for observer pattern
 using RaceStateChangedCallback = std::function<void(RaceState)>;
 using SecondTickCallback = std::function<void(uint32_t)>;
@@ -74,7 +90,7 @@ public:
     /**
      * @brief Update the module state
      * 
-     * This should be called regularly in the main loop.
+     * Run by the controller's TaskScheduler every RACE_UPDATE_INTERVAL_MS.
      * Handles race timing and state updates.
      */
     void update();
@@ -146,6 +162,20 @@ public:
      */
     ErrorInfo registerLap(int lane);
     
+    /**
+     * @brief Remove the most recent lap for a lane
+     * 
+     * Restores the lane's lap count, last/best lap, total time and finished
+     * flag to what they were before that lap, in constant time, then ranks
+     * all lanes again. Up to RACE_LAP_HISTORY_DEPTH laps per lane can be
+     * removed, but only laps registered since the latest journal snapshot.
+     * The lane's minimum lap time is measured from the previous lap again.
+     * 
+     * @param lane Lane number (1-8)
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo removeLap(int lane);
+    
     /**
      * @brief Get the current race state
      * 
@@ -231,6 +261,15 @@ public:
      */
     const std::vector<RaceLaneData>& getAllLaneData() const;
     
+    /**
+     * @brief Copy the data of all enabled lanes
+     * 
+     * This is the snapshot handed to displays.
+     * 
+     * @return std::vector<RaceLaneData> Data of the enabled lanes in lane order
+     */
+    std::vector<RaceLaneData> createLaneSnapshot() const;
+    
     /**
      * @brief Compare two lanes for position sorting
      * 
@@ -286,6 +325,87 @@ public:
      */
     uint32_t getRaceElapsedTime() const;
     
+    /**
+     * @brief Set the racer name shown for a lane
+     * 
+     * Names are kept across races and journal recovery; lanes default to
+     * "Racer <n>".
+     * 
+     * @param laneId Lane identifier (1-based, up to MAX_LANES)
+     * @param name Racer name
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo setRacerName(int laneId, const String& name);
+    
+    /**
+     * @brief Set the minimum lap time for a lane
+     * 
+     * Triggers arriving sooner than this after the lane's last accepted lap
+     * are rejected before lap registration.
+     * 
+     * @param laneId Lane identifier (1-based)
+     * @param minLapTimeMs Minimum lap time in milliseconds
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo setLaneMinLapTime(int laneId, uint32_t minLapTimeMs);
+    
+    /**
+     * @brief Set the glitch window for a lane
+     * 
+     * Triggers arriving sooner than this after the lane's previous trigger
+     * are treated as sensor bounce and rejected.
+     * 
+     * @param laneId Lane identifier (1-based)
+     * @param glitchWindowMs Glitch window in milliseconds
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo setLaneGlitchWindow(int laneId, uint32_t glitchWindowMs);
+    
+    /**
+     * @brief Get the accepted/rejected trigger counters for a lane
+     * 
+     * @param laneId Lane identifier (1-based)
+     * @return LapFilterStats Trigger counters for the lane
+     */
+    LapFilterStats getLapFilterStats(int laneId) const { return _lapFilter.getStats(laneId); }
+    
+    /**
+     * @brief Get the race event journal
+     * 
+     * Use this to attach storage sinks or to audit recorded events.
+     * 
+     * @return RaceJournal& The race event journal
+     */
+    RaceJournal& getJournal() { return _journal; }
+    
+    /**
+     * @brief Restore race state from a snapshot and the events recorded after it
+     * 
+     * Used after a reboot to rebuild the race from persisted journal data.
+     * Events with a sequence number not greater than the snapshot's are
+     * skipped. No callbacks are fired; callers should refresh displays.
+     * All restored timestamps are moved onto the current clock, so the race
+     * resumes from the last recorded moment; time spent powered off is not
+     * counted. Fails if an event cannot be applied (e.g. a lap removal with no lap
+     * to remove), since the rebuilt state would no longer match.
+     * 
+     * @param snapshot Snapshot to start from
+     * @param events Events recorded after the snapshot, in sequence order
+     * @param count Number of events
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo replayJournal(const RaceSnapshot& snapshot, const RaceEvent* events, size_t count);
+    
+    /**
+     * @brief Rebuild race state from the in-memory journal
+     * 
+     * Restores the latest snapshot and replays every event after it.
+     * Timestamps are kept as recorded, since the journal is from this session.
+     * 
+     * @return ErrorInfo Error information (success or failure)
+     */
+    ErrorInfo rebuildFromJournal();
+    
 private:
     // Private constructor for singleton pattern
     RaceModule();
@@ -314,6 +434,50 @@ private:
      */
     void updatePositions();
     
+    /**
+     * @brief Apply a lap at the given time to a lane
+     * 
+     * Shared by registerLap() and journal replay.
+     * 
+     * @param laneData Lane to update
+     * @param currentTime Lap timestamp in milliseconds
+     * @return uint32_t Lap time in milliseconds
+     */
+    uint32_t applyLap(RaceLaneData& laneData, uint32_t currentTime);
+    
+    /**
+     * @brief Clear race timing and lane progress
+     */
+    void clearRaceProgress();
+    
+    /**
+     * @brief Undo the most recent lap of a lane from its lap history
+     * 
+     * Shared by removeLap() and journal replay.
+     * 
+     * @param laneData Lane to update
+     * @return bool true if a lap was removed
+     */
+    bool applyLapRemoval(RaceLaneData& laneData);
+    
+    /**
+     * @brief Forget lap history for all lanes
+     */
+    void clearLapHistory();
+    
+    // Journal helpers
+    void captureSnapshot(RaceSnapshot& snapshot) const;
+    void restoreSnapshot(const RaceSnapshot& snapshot);
+    bool applyEvent(const RaceEvent& event);
+    void takeSnapshot();
+    
+    /**
+     * @brief Shift every restored timestamp by an offset
+     * 
+     * @param offsetMs Difference between the current clock and the recorded one
+     */
+    void rebaseTimestamps(uint32_t offsetMs);
+    
     // Member variables
     bool _initialized;
     bool _raceActive;
@@ -325,8 +489,6 @@ private:
     int _numLanes;
     int _numLaps;
     int _raceTimeSeconds;
-    uint32_t _lastUpdateTime;
-    uint32_t _updateIntervalMs;
     uint32_t _countdownTimeMs;
     uint32_t _countdownStartTime;
     RaceState _raceState;
@@ -336,6 +498,19 @@ private:
     
     // Lane data
     std::vector<RaceLaneData> _lanes;
+    
+    // Configured racer name per lane, applied on prepareRace() and journal recovery
+    String _racerNames[MAX_LANES];
+    
+    // Per-lane ring of pre-lap state, indexed by (lap number - 1) % RACE_LAP_HISTORY_DEPTH
+    LapHistoryEntry _lapHistory[MAX_LANES][RACE_LAP_HISTORY_DEPTH];
+    uint8_t _lapHistoryCount[MAX_LANES];
+    
+    // Per-lane debounce and false-trigger filtering ahead of registerLap
+    LapFilter _lapFilter;
+    
+    // Append-only record of race transitions
+    RaceJournal _journal;
 };
 
 // Global instance declaration
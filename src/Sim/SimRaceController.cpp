@@ -0,0 +1,205 @@
+#ifdef SIMULATOR
+
+#include "SimRaceController.h"
+#include "common/TimeManager.h"
+#include "InputModule/InputManager.h"
+#include "RaceModule/RaceModule.h"
+#include "DisplayModule/DisplayManager.h"
+
+// Race settings used until they are changed with input commands
+#define SIM_DEFAULT_LANES 4
+#define SIM_DEFAULT_LAPS 10
+#define SIM_DEFAULT_RACE_TIME 300
+
+SimRaceController* SimRaceController::_instance = nullptr;
+
+SimRaceController& SimRaceController::getInstance() {
+    if (_instance == nullptr) {
+        _instance = new SimRaceController();
+    }
+    return *_instance;
+}
+
+SimRaceController::SimRaceController()
+    : _raceCore("race", RACE_CORE)
+    , _displayCore("display", DISPLAY_CORE)
+    , _raceMode(RaceMode::LAPS)
+    , _numLanes(SIM_DEFAULT_LANES)
+    , _numLaps(SIM_DEFAULT_LAPS)
+    , _raceTimeSeconds(SIM_DEFAULT_RACE_TIME) {
+    _inputTask = _raceScheduler.addPeriodicTask("input", TaskPriority::Input, INPUT_POLL_INTERVAL_MS, [this]() {
+        drainInput();
+    });
+    _raceScheduler.addPeriodicTask("race", TaskPriority::Race, RACE_UPDATE_INTERVAL_MS, []() {
+        raceModule.update();
+    });
+    _publishTask = _raceScheduler.addPeriodicTask("publish", TaskPriority::Display, DISPLAY_UPDATE_INTERVAL_MS, [this]() {
+        if (DisplayManager::getInstance().publishRaceData()) {
+            wakeDisplay();
+        }
+    });
+    _displayTask = _displayScheduler.addPeriodicTask("display", TaskPriority::Display, DISPLAY_UPDATE_INTERVAL_MS, []() {
+        DisplayManager::getInstance().presentRaceData();
+        DisplayManager::getInstance().update();
+    });
+}
+
+uint32_t SimRaceController::update() {
+    uint32_t raceIdleMs = runRacePass();
+    uint32_t displayIdleMs = runDisplayPass(TimeManager::GetInstance().GetCurrentTimeMs());
+    return raceIdleMs < displayIdleMs ? raceIdleMs : displayIdleMs;
+}
+
+uint32_t SimRaceController::runRacePass() {
+    // Advance the shared clock before anything reads it
+    TimeManager& timeManager = TimeManager::GetInstance();
+    timeManager.Update();
+    
+    // A replay's clock only moves when the replay is polled
+    if (timeManager.IsReplayActive()) {
+        _raceScheduler.notify(_inputTask);
+    }
+    return _raceScheduler.runDue(timeManager.GetCurrentTimeMs());
+}
+
+uint32_t SimRaceController::runDisplayPass(uint32_t nowMs) {
+    DisplayManager::getInstance().runDeferredCalls();
+    return _displayScheduler.runDue(nowMs);
+}
+
+bool SimRaceController::startCores() {
+    if (_raceCore.isRunning()) {
+        return false;
+    }
+
+    // Display frames follow the wall clock; only the race core moves TimeManager
+    DisplayManager::getInstance().setDisplayCore(&_displayCore);
+    _displayCore.start([this]() {
+        return runDisplayPass(millis());
+    });
+    _raceCore.start([this]() {
+        return runRacePass();
+    });
+    return true;
+}
+
+void SimRaceController::stopCores() {
+    if (!_raceCore.isRunning()) {
+        return;
+    }
+    _raceCore.stop();
+    _displayCore.stop();
+    DisplayManager::getInstance().setDisplayCore(nullptr);
+    DisplayManager::getInstance().runDeferredCalls();
+}
+
+void SimRaceController::notifyInput() {
+    _raceScheduler.notify(_inputTask);
+    _raceCore.wake();
+}
+
+void SimRaceController::setInputPollInterval(uint32_t intervalMs) {
+    _raceScheduler.setInterval(_inputTask, intervalMs);
+}
+
+void SimRaceController::wakeDisplay() {
+    _displayScheduler.notify(_displayTask);
+    _displayCore.wake();
+}
+
+void SimRaceController::drainInput() {
+    InputEvent event;
+    for (int i = 0; i < INPUT_DRAIN_LIMIT; i++) {
+        if (!InputManager::getInstance().poll(event)) {
+            return;
+        }
+        ErrorInfo result = processInputEvent(event);
+        if (!result.isSuccess()) {
+            DisplayManager::getInstance().warning(String(result.message), "SimRaceController");
+        }
+        // Publish the change in this pass rather than on the next frame
+        _raceScheduler.notify(_publishTask);
+    }
+    // More may be waiting; the rest of this pass runs first
+    _raceScheduler.notify(_inputTask);
+}
+
+ErrorInfo SimRaceController::processInputEvent(const InputEvent& event) {
+    switch (event.command) {
+        case InputCommand::AddLap: {
+            ErrorInfo result = raceModule.registerLap(event.value);
+            if (result.isSuccess()) {
+                DisplayManager::getInstance().sendLapTelemetry(event.value);
+            }
+            return result;
+        }
+
+        case InputCommand::RemoveLap:
+            return raceModule.removeLap(event.value);
+
+        case InputCommand::StartCountdown: {
+            if (raceModule.getRaceState() != RaceState::Idle) {
+                raceModule.resetRace();
+            }
+            ErrorInfo result = raceModule.prepareRace(_raceMode, _numLanes, _numLaps, _raceTimeSeconds);
+            if (!result.isSuccess()) {
+                return result;
+            }
+            return raceModule.startCountdown();
+        }
+
+        case InputCommand::StartRace:
+            return raceModule.startRace();
+
+        case InputCommand::PauseRace:
+            return raceModule.pauseRace();
+
+        case InputCommand::ResumeRace:
+            return raceModule.resumeRace();
+
+        case InputCommand::StopRace:
+            return raceModule.stopRace();
+
+        case InputCommand::ResetRace:
+            return raceModule.resetRace();
+
+        case InputCommand::SetNumLaps:
+            if (event.value <= 0 || event.value > 100) {
+                return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid number of laps", "SimRaceController");
+            }
+            _numLaps = event.value;
+            return ErrorInfo(); // Success
+
+        case InputCommand::SetNumLanes:
+            if (event.value <= 0 || event.value > MAX_LANES) {
+                return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid number of lanes", "SimRaceController");
+            }
+            _numLanes = event.value;
+            return ErrorInfo(); // Success
+
+        case InputCommand::ChangeMode:
+            if (event.value < (int)RaceMode::LAPS || event.value > (int)RaceMode::PRACTISE) {
+                return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid race mode", "SimRaceController");
+            }
+            _raceMode = (RaceMode)event.value;
+            return ErrorInfo(); // Success
+
+        case InputCommand::SetRaceTime:
+            if (event.value <= 0 || event.value > 3600) {
+                return ErrorInfo(ErrorCode::INVALID_PARAMETER, "Invalid race time", "SimRaceController");
+            }
+            _raceTimeSeconds = event.value;
+            return ErrorInfo(); // Success
+
+        case InputCommand::EnableLane:
+            return raceModule.enableLane(event.value);
+
+        case InputCommand::DisableLane:
+            return raceModule.disableLane(event.value);
+
+        default:
+            return ErrorInfo(ErrorCode::NOT_IMPLEMENTED, "Command not supported in the simulator", "SimRaceController");
+    }
+}
+
+#endif // SIMULATOR
@@ -0,0 +1,125 @@
+#pragma once
+#include "common/ArduinoCompat.h"
+#include "common/CoreLoop.h"
+#include "common/TaskScheduler.h"
+#include "common/Types.h"
+#include "InputModule/InputCommand.h"
+
+/**
+ * SimRaceController - Race command handling for the headless simulator.
+ *
+ * Stands in for SystemController, which needs the ESP32 peripherals, and
+ * splits the same tasks the same way. The race core drains InputManager
+ * into the race, runs RaceModule::update() and publishes race data; the
+ * display core draws the newest race data and updates the displays.
+ * update() runs both on the calling thread; startCores() runs each on its
+ * own thread, as the ESP32 runs them on its two cores. Without
+ * LightsModule, the countdown is ended by an explicit StartRace command.
+ */
+class SimRaceController {
+public:
+    /**
+     * @brief Get the singleton instance
+     *
+     * @return SimRaceController& The singleton instance
+     */
+    static SimRaceController& getInstance();
+
+    /**
+     * @brief Run a race core pass, then a display core pass, on the calling thread
+     *
+     * @return uint32_t Milliseconds the caller can sleep before the next task is due
+     */
+    uint32_t update();
+
+    /**
+     * @brief Advance the clock and run the race core tasks that are due
+     *
+     * @return uint32_t Milliseconds until the next race core task is due
+     */
+    uint32_t runRacePass();
+
+    /**
+     * @brief Run queued display calls and the display core tasks that are due
+     *
+     * @param nowMs Current time; the display core does not advance the race clock
+     * @return uint32_t Milliseconds until the next display core task is due
+     */
+    uint32_t runDisplayPass(uint32_t nowMs);
+
+    /**
+     * @brief Run the race and display cores on two threads until stopCores()
+     *
+     * Display calls made by the race thread are queued for the display thread
+     * (see DisplayManager::setDisplayCore()). Input modules polled by the race
+     * thread must be safe to fill from another thread.
+     *
+     * @return bool false if the cores are already running
+     */
+    bool startCores();
+
+    /**
+     * @brief Stop both threads and run any display calls still queued
+     */
+    void stopCores();
+
+    bool areCoresRunning() const { return _raceCore.isRunning(); }
+
+    /**
+     * @brief Have the input task run on the next race core pass, e.g. after a typed command
+     */
+    void notifyInput();
+
+    /**
+     * @brief Set how often input modules are polled without a notifyInput()
+     *
+     * Only sources that produce events by themselves, such as a running
+     * ReplayInput, need polling; 0 polls on notifyInput() alone.
+     */
+    void setInputPollInterval(uint32_t intervalMs);
+
+    const TaskScheduler& getRaceScheduler() const { return _raceScheduler; }
+    const TaskScheduler& getDisplayScheduler() const { return _displayScheduler; }
+    const CoreLoop& getRaceCore() const { return _raceCore; }
+    const CoreLoop& getDisplayCore() const { return _displayCore; }
+
+    /**
+     * @brief Apply an input event to the race
+     *
+     * @param event Event as delivered by InputManager
+     * @return ErrorInfo Result of the race operation
+     */
+    ErrorInfo processInputEvent(const InputEvent& event);
+
+    RaceMode getRaceMode() const { return _raceMode; }
+    int getNumLanes() const { return _numLanes; }
+    int getNumLaps() const { return _numLaps; }
+
+private:
+    SimRaceController();
+
+    SimRaceController(const SimRaceController&) = delete;
+    SimRaceController& operator=(const SimRaceController&) = delete;
+
+    static SimRaceController* _instance;
+
+    void drainInput();
+    void wakeDisplay();
+
+    // Race core: input, race logic, race data publishing
+    TaskScheduler _raceScheduler;
+    TaskScheduler::TaskId _inputTask;
+    TaskScheduler::TaskId _publishTask;
+    CoreLoop _raceCore;
+
+    // Display core: drawing race data, display updates
+    TaskScheduler _displayScheduler;
+    TaskScheduler::TaskId _displayTask;
+    CoreLoop _displayCore;
+
+    // Settings used when a countdown prepares the next race
+    RaceMode _raceMode;
+    int _numLanes;
+    int _numLaps;
+    int _raceTimeSeconds;
+};
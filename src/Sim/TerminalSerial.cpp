@@ -59,6 +59,13 @@ bool TerminalSerial::available() {
     return !_inputQueue.empty();
 }
 
+bool TerminalSerial::waitForInput(uint32_t timeoutMs) {
+    std::unique_lock<std::mutex> lock(_inputMutex);
+    return _inputReady.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() {
+        return !_inputQueue.empty();
+    });
+}
+
 char TerminalSerial::read() {
     std::lock_guard<std::mutex> lock(_inputMutex);
     if (_inputQueue.empty()) return -1;
@@ -98,11 +105,14 @@ void TerminalSerial::inputThreadFunc() {
     while (_running) {
         if (_kbhit()) {
             char c = _getch();
-            std::lock_guard<std::mutex> lock(_inputMutex);
-            _inputQueue.push(c);
-            if (_echo && c != '\n' && c != '\r') {
-                std::cout << c << std::flush;
+            {
+                std::lock_guard<std::mutex> lock(_inputMutex);
+                _inputQueue.push(c);
+                if (_echo && c != '\n' && c != '\r') {
+                    std::cout << c << std::flush;
+                }
             }
+            _inputReady.notify_one();
         }
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
@@ -1,7 +1,9 @@
 #pragma once
 #include <string>
+#include <cstdint>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <queue>
 #include <atomic>
 
@@ -19,6 +21,8 @@ public:
     void print(unsigned long num, bool newLine = false);
     void print(short num, bool newLine = false);
     bool available();
+    // Block until input arrives or timeoutMs passes; true if input is available
+    bool waitForInput(uint32_t timeoutMs);
     char read();
     std::string readLine();
 
@@ -38,5 +42,6 @@ private:
     std::atomic<bool> _running;
     std::queue<char> _inputQueue;
     std::mutex _inputMutex;
+    std::condition_variable _inputReady;
     bool _echo;
 };
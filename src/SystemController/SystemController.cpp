@@ -69,7 +69,12 @@ SystemController::SystemController()
     , displayManager(DisplayManager::getInstance())
     , lightsModule(*(new LightsModule()))  // Temporary until we have a proper getInstance()
     , configModule(*(new ConfigModule()))  // Temporary until we have a proper getInstance()
-    , _initialized(false) {
+    , _initialized(false)
+    , _inputTask(-1)
+    , _publishTask(-1)
+    , _raceCore("race", RACE_CORE)
+    , _displayTask(-1)
+    , _displayCore("display", DISPLAY_CORE) {
     DEBUG_PRINT_METHOD();
     // Constructor implementation
 }
@@ -110,11 +115,21 @@ bool SystemController::initialize() {
     #endif
 
     #ifdef ENABLE_DISPLAYMODULE
-        DisplayType displayTypes[] = {DisplayType::Serial};
-        if (!displayManager.initialize(displayTypes, 1)) {
+        DisplayType displayTypes[2] = {DisplayType::Serial};
+        int displayCount = 1;
+        #ifdef ENABLE_OUTPUT_WEB
+            displayTypes[displayCount++] = DisplayType::Web;
+        #endif
+        if (!displayManager.initialize(displayTypes, displayCount)) {
             displayManager.error("Failed to initialize DisplayManager", "SystemController");
             return false;
         }
+        #ifdef ENABLE_OUTPUT_TELEMETRY
+            // Binary frames share the serial line with the text log; decoders skip the text
+            displayManager.setTelemetrySink([](const uint8_t* frame, size_t length) {
+                Serial.write(frame, length);
+            });
+        #endif
     #else  // !ENABLE_DISPLAYMODULE
         displayManager.debug("DisplayModule disabled", "SystemController");
     #endif
@@ -171,6 +186,30 @@ bool SystemController::initialize() {
         }, this);
     });
     
+    // Race core tasks; due ones run input first, then race logic, then publishing
+    _inputTask = _raceScheduler.addPeriodicTask("input", TaskPriority::Input, INPUT_POLL_INTERVAL_MS, [this]() {
+        this->drainInput();
+    });
+    _raceScheduler.addPeriodicTask("race", TaskPriority::Race, RACE_UPDATE_INTERVAL_MS, [this]() {
+        raceModule.update();
+    });
+    _raceScheduler.addPeriodicTask("lights", TaskPriority::Race, LIGHTS_UPDATE_INTERVAL_MS, [this]() {
+        lightsModule.update();
+    });
+    _publishTask = _raceScheduler.addPeriodicTask("publish", TaskPriority::Display, DISPLAY_UPDATE_INTERVAL_MS, [this]() {
+        // One race data snapshot per frame, however many changes came in since
+        if (displayManager.publishRaceData()) {
+            this->wakeDisplay();
+        }
+    });
+    
+    // Display core task
+    _displayTask = _displayScheduler.addPeriodicTask("display", TaskPriority::Display, DISPLAY_UPDATE_INTERVAL_MS, [this]() {
+        displayManager.presentRaceData();
+        // Periodic display work: LVGL rendering, the web display serving its browsers
+        displayManager.update();
+    });
+    
     // Set initial state
     _systemState = SystemState::Main;
     
@@ -185,15 +224,10 @@ void SystemController::update() {
         return;
     }
     
-    // Update all modules
-    raceModule.update();
-    lightsModule.update();
-    
-    // Poll for input events
-    InputEvent event;
-    if (inputManager.poll(event)) {
-        processInputEvent(event);
-    }
+    // Run the input, race, lights and display tasks that are due
+    uint32_t raceIdleMs = runRacePass();
+    uint32_t displayIdleMs = runDisplayPass(TimeManager::GetInstance().GetCurrentTimeMs());
+    uint32_t idleMs = raceIdleMs < displayIdleMs ? raceIdleMs : displayIdleMs;
     
     // Update system state based on current mode
     switch (_systemState) {
@@ -213,6 +247,68 @@ void SystemController::update() {
             // Stats mode updates are handled by StatsModule
             break;
     }
+    
+    // Sleep until the next task is due; other FreeRTOS tasks run meanwhile
+    delay(idleMs);
+}
+
+bool SystemController::startCores() {
+    DEBUG_PRINT_METHOD();
+    if (!_initialized || _raceCore.isRunning()) {
+        return false;
+    }
+    
+    // Display frames follow the wall clock; only the race core moves TimeManager
+    displayManager.setDisplayCore(&_displayCore);
+    if (!_displayCore.start([this]() { return this->runDisplayPass(millis()); })) {
+        displayManager.setDisplayCore(nullptr);
+        displayManager.error("Failed to start the display core", "SystemController");
+        return false;
+    }
+    if (!_raceCore.start([this]() { return this->runRacePass(); })) {
+        displayManager.error("Failed to start the race core", "SystemController");
+        return false;
+    }
+    displayManager.info("Race core on core " + String(RACE_CORE) + ", display core on core " + String(DISPLAY_CORE),
+                        "SystemController");
+    return true;
+}
+
+uint32_t SystemController::runRacePass() {
+    // Advance the shared clock before anything reads it
+    TimeManager& timeManager = TimeManager::GetInstance();
+    timeManager.Update();
+    
+    // A replay's clock only moves when the replay is polled
+    if (timeManager.IsReplayActive()) {
+        _raceScheduler.notify(_inputTask);
+    }
+    return _raceScheduler.runDue(timeManager.GetCurrentTimeMs());
+}
+
+uint32_t SystemController::runDisplayPass(uint32_t nowMs) {
+    // Screen changes and messages the race core asked for since the last pass
+    displayManager.runDeferredCalls();
+    return _displayScheduler.runDue(nowMs);
+}
+
+void SystemController::wakeDisplay() {
+    _displayScheduler.notify(_displayTask);
+    _displayCore.wake();
+}
+
+void SystemController::drainInput() {
+    InputEvent event;
+    for (int i = 0; i < INPUT_DRAIN_LIMIT; i++) {
+        if (!inputManager.poll(event)) {
+            return;
+        }
+        processInputEvent(event);
+        // Publish the change in this pass rather than on the next frame
+        _raceScheduler.notify(_publishTask);
+    }
+    // More may be waiting; the rest of this pass runs first
+    _raceScheduler.notify(_inputTask);
 }
 
 void SystemController::showMain() {
@@ -314,23 +410,22 @@ void SystemController::startRaceWithCountdown() {
 void SystemController::processInputEvent(const InputEvent& event) {
     DEBUG_PRINT_METHOD();
     // Skip debug print for AddLap events to avoid flooding the log
-    if (event.command == InputCommand::AddLap) {
-        return;
+    if (event.command != InputCommand::AddLap) {
+        // Log the input event with more detailed information
+        String eventInfo = "Input event: " + String(inputCommandToString(event.command));
+        eventInfo += ", Target: " + String((int)event.target);
+        eventInfo += ", Value: " + String(event.value);
+        eventInfo += ", Current state: " + String((int)_systemState);
+        displayManager.debug(eventInfo, "SystemController");
+        
+        // Add direct serial output for easier debugging
+        Serial.print("[SystemController] Received event - Command: ");
+        Serial.print(inputCommandToString(event.command));
+        Serial.print(", Target: ");
+        Serial.print((int)event.target);
+        Serial.print(", Value: ");
+        Serial.println(event.value);
     }
-    // Log the input event with more detailed information
-    String eventInfo = "Input event: " + String(inputCommandToString(event.command));
-    eventInfo += ", Target: " + String((int)event.target);
-    eventInfo += ", Value: " + String(event.value);
-    eventInfo += ", Current state: " + String((int)_systemState);
-    displayManager.debug(eventInfo, "SystemController");
-    
-    // Add direct serial output for easier debugging
-    Serial.print("[SystemController] Received event - Command: ");
-    Serial.print(inputCommandToString(event.command));
-    Serial.print(", Target: ");
-    Serial.print((int)event.target);
-    Serial.print(", Value: ");
-    Serial.println(event.value);
     
     // Debug current screen type
     ScreenType currentScreen = displayManager.getCurrentScreen();
@@ -416,6 +511,16 @@ void SystemController::processInputEvent(const InputEvent& event) {
         else if (event.command == InputCommand::AddLap) {
             raceModule.registerLap(event.value);
         }
+        else if (event.command == InputCommand::RemoveLap) {
+            ErrorInfo result = raceModule.removeLap(event.value);
+            if (result.isSuccess()) {
+                displayManager.showMessage("Lane " + String(event.value) + " lap removed");
+            } else {
+                Serial.print("[SystemController] Failed to remove lap: ");
+                Serial.println(result.message);
+            }
+            return;
+        }
         else if (event.command == InputCommand::PauseRace) {
             Serial.println("[SystemController] Handling PauseRace command");
             displayManager.debug("Pausing race - switching to PauseScreen", "SystemController");
@@ -587,16 +692,16 @@ void SystemController::onRaceStateChanged(RaceState state) {
                 // Get the current race mode from the race module
                 RaceMode currentRaceMode = raceModule.getRaceMode();
                 displayManager.showRaceActive(currentRaceMode);
-                displayManager.raceLog(displayManager.formatRaceStatus(raceModule, false));
+                displayManager.raceLog(displayManager.formatRaceStatus(raceModule, false).c_str());
                 
-                // Update race data display with the latest race lane data
-                displayManager.updateRaceData(createRaceDataSnapshot());
+                // Fill the new screen on the next flush
+                displayManager.markRaceDataDirty(true);
             }
             break;
             
         case RaceState::Paused:
             // Race is paused
-            displayManager.raceLog(displayManager.formatRaceStatus(raceModule, true));
+            displayManager.raceLog(displayManager.formatRaceStatus(raceModule, true).c_str());
             break;
             
         case RaceState::Finished:
@@ -612,73 +717,30 @@ void SystemController::onRaceStateChanged(RaceState state) {
 void SystemController::onSecondTick(uint32_t raceTimeMs) {
     // No debug print to avoid flooding the log with tick updates
     // Update race clock display every second
-    String formattedTime = formatTimeMMSS(raceTimeMs);
-    displayManager.showMessage("Race Time: " + formattedTime);
+    FixedString<32> message("Race Time: ");
+    message.appendTimeMMSS(raceTimeMs);
+    displayManager.showMessage(message.c_str());
     
     // Only update race data display if race is active or paused
     if (raceModule.getRaceState() == RaceState::Active || 
         raceModule.getRaceState() == RaceState::Paused) {
         // Update race data display with the latest race lane data
-        displayManager.updateRaceData(createRaceDataSnapshot());
+        displayManager.markRaceDataDirty();
     }
 }
 
 void SystemController::onLapRegistered(int lane, uint32_t lapTimeMs) {
     DEBUG_PRINT_METHOD();
     // Update lap display when a lap is registered
-    String formattedTime = formatTimeMMSSmmm(lapTimeMs);
-    displayManager.showMessage("Lane " + String(lane) + " Lap: " + formattedTime);
+    FixedString<32> message("Lane ");
+    message.appendInt(lane);
+    message += " Lap: ";
+    message.appendTimeMMSSmmm(lapTimeMs);
+    displayManager.showMessage(message.c_str());
     
     // Update race status display
-    displayManager.raceLog(displayManager.formatRaceStatus(raceModule, raceModule.isRacePaused()));
-    
-    // Update race data display with the latest race lane data
-    displayManager.updateRaceData(createRaceDataSnapshot());
-}
-
-String SystemController::formatTimeMMSS(uint32_t timeMs) {
-    // No debug print for utility functions to avoid performance impact
-    uint32_t totalSeconds = timeMs / 1000;
-    uint32_t minutes = totalSeconds / 60;
-    uint32_t seconds = totalSeconds % 60;
-    
-    char buffer[10]; // Increased buffer size for safety: MM:SS\0
-    snprintf(buffer, sizeof(buffer), "%02lu:%02lu", (unsigned long)minutes, (unsigned long)seconds);
-    return String(buffer);
-}
-
-String SystemController::formatTimeMMSSmmm(uint32_t timeMs) {
-    // No debug print for utility functions to avoid performance impact
-    uint32_t totalSeconds = timeMs / 1000;
-    uint32_t minutes = totalSeconds / 60;
-    uint32_t seconds = totalSeconds % 60;
-    uint32_t millis = timeMs % 1000;
-    
-    char buffer[16]; // Increased buffer size for safety: MM:SS:mmm\0
-    snprintf(buffer, sizeof(buffer), "%02lu:%02lu:%03lu", (unsigned long)minutes, (unsigned long)seconds, (unsigned long)millis);
-    return String(buffer);
-}
-
-std::vector<RaceLaneData> SystemController::createRaceDataSnapshot() {
-    DEBUG_PRINT_METHOD();
-    // Get the number of lanes from the race module
-    int numLanes = raceModule.getNumLanes();
-    std::vector<RaceLaneData> laneDataSnapshot;
-    
-    // Collect data for each lane
-    for (int i = 1; i <= numLanes; i++) {
-        // Get the lane data from the race module
-        RaceLaneData laneData = raceModule.getLaneData(i);
-        
-        // Only include enabled lanes
-        if (laneData.enabled) {
-            // Add the lane data to the snapshot
-            laneDataSnapshot.push_back(laneData);
-        }
-    }
-    
-    // Log that we created a race data snapshot
-    displayManager.debug("Created race data snapshot with " + String(laneDataSnapshot.size()) + " lanes", "SystemController");
+    displayManager.raceLog(displayManager.formatRaceStatus(raceModule, raceModule.isRacePaused()).c_str());
+    displayManager.sendLapTelemetry(lane);
     
-    return laneDataSnapshot;
+    // RaceModule has already marked the race data dirty for the display
 }
@@ -5,6 +5,8 @@
 #include "InputModule/InputManager.h"
 #include "common/Types.h"
 #include "common/TimeManager.h"
+#include "common/TaskScheduler.h"
+#include "common/CoreLoop.h"
 #include "RaceModule/RaceModule.h"
 #include "DisplayModule/DisplayManager.h"
 #include "LightsModule/LightsModule.h"
@@ -62,12 +64,39 @@ public:
     bool initialize();
     
     /**
-     * @brief Update the system state
+     * @brief Run the due tasks of both cores on the calling thread, then sleep until the next one is due
      * 
-     * This should be called regularly in the main loop.
+     * For a single loop; startCores() is the normal way to run. Input is
+     * drained first, then RaceModule and LightsModule are updated, then race
+     * data is published and drawn and the displays are updated, each at its
+     * own period (see common/Types.h).
      */
     void update();
     
+    /**
+     * @brief Run the race core pinned to core 0 and the display core to core 1
+     * 
+     * The race core drains input, updates RaceModule and LightsModule and
+     * publishes race data; the display core draws the newest published race
+     * data and runs LVGL and the other displays. Race data crosses over
+     * through a lock-free buffer and display calls made on the race core are
+     * queued for the display core, so rendering never delays lap timestamps.
+     * Call once, after initialize().
+     * 
+     * @return bool true if both FreeRTOS tasks were created
+     */
+    bool startCores();
+    
+    /**
+     * @brief Get the race core tasks, e.g. for their run time statistics
+     */
+    const TaskScheduler& getRaceScheduler() const { return _raceScheduler; }
+    
+    /**
+     * @brief Get the display core tasks, e.g. for their run time statistics
+     */
+    const TaskScheduler& getDisplayScheduler() const { return _displayScheduler; }
+    
     /**
      * @brief Show the main menu
      * 
@@ -130,23 +159,29 @@ private:
     // Initialization flag
     bool _initialized;
     
+    // Race core tasks (input, race, lights, publishing race data), registered by initialize()
+    TaskScheduler _raceScheduler;
+    TaskScheduler::TaskId _inputTask;
+    TaskScheduler::TaskId _publishTask;
+    CoreLoop _raceCore;
+    
+    // Display core tasks (drawing race data, display updates), registered by initialize()
+    TaskScheduler _displayScheduler;
+    TaskScheduler::TaskId _displayTask;
+    CoreLoop _displayCore;
+    
+    // Handle pending input events, up to INPUT_DRAIN_LIMIT per pass
+    void drainInput();
+    
+    // One pass of each core's due tasks; return the ms until the next is due
+    uint32_t runRacePass();
+    uint32_t runDisplayPass(uint32_t nowMs);
+    
+    // Have the display core draw newly published race data now
+    void wakeDisplay();
+    
     // Event handlers for observer pattern
     void onRaceStateChanged(RaceState state);
     void onSecondTick(uint32_t raceTimeMs);
     void onLapRegistered(int lane, uint32_t lapTimeMs);
-    
-    // Helper methods for formatting time
-    String formatTimeMMSS(uint32_t timeMs);
-    String formatTimeMMSSmmm(uint32_t timeMs);
-    
-    /**
-     * @brief Create a snapshot of the current race data for display
-     * 
-     * This method collects race data from RaceModule and formats it for display
-     * on the RaceActiveScreen UI. It includes position, lane number, last lap time,
-     * and current time for each active lane.
-     * 
-     * @return std::vector<RaceLaneData> Vector of lane data for display
-     */
-    std::vector<RaceLaneData> createRaceDataSnapshot();
 };
@@ -3,6 +3,210 @@
 #include <chrono>
 #include <thread>
 #include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+// ===== String =====
+
+String::AllocationHook String::_allocationHook = nullptr;
+uint32_t String::_allocationCount = 0;
+
+String& String::operator=(const String& other) {
+    if (this != &other) {
+        clear();
+        concat(other._buffer, other._length);
+    }
+    return *this;
+}
+
+String& String::operator=(String&& other) noexcept {
+    if (this != &other) {
+        release();
+        init();
+        moveFrom(other);
+    }
+    return *this;
+}
+
+String& String::operator=(const char* str) {
+    // May point into this string
+    if (str >= _buffer && str <= _buffer + _length) {
+        return *this = String(str);
+    }
+    clear();
+    concat(str);
+    return *this;
+}
+
+void String::release() {
+    if (!isInline()) {
+        delete[] _buffer;
+    }
+}
+
+void String::moveFrom(String& other) {
+    _length = other._length;
+    if (other.isInline()) {
+        memcpy(_inline, other._inline, other._length + 1);
+    } else {
+        // Take the heap block
+        _buffer = other._buffer;
+        _capacity = other._capacity;
+    }
+    other.init();
+}
+
+bool String::reserve(size_t length) {
+    if (length <= _capacity) {
+        return true;
+    }
+
+    char* buffer = new char[length + 1];
+    _allocationCount++;
+    if (_allocationHook) {
+        _allocationHook(length + 1);
+    }
+    memcpy(buffer, _buffer, _length + 1);
+    release();
+    _buffer = buffer;
+    _capacity = length;
+    return true;
+}
+
+void String::clear() {
+    _length = 0;
+    _buffer[0] = '\0';
+}
+
+bool String::concat(const char* str) {
+    return str ? concat(str, strlen(str)) : false;
+}
+
+bool String::grow(const char* str, size_t length) {
+    // Appending part of this string must survive the move to a new block
+    if (str >= _buffer && str < _buffer + _length) {
+        return concat(String(str, length));
+    }
+    // Grow geometrically so a sequence of appends stays amortized
+    size_t capacity = _capacity * 2;
+    reserve(capacity > _length + length ? capacity : _length + length);
+    return concat(str, length);
+}
+
+bool String::concat(unsigned long long num) {
+    // Digits are produced from the end; 20 covers the largest 64-bit value
+    char digits[20];
+    char* start = digits + sizeof(digits);
+    do {
+        *--start = (char)('0' + num % 10);
+        num /= 10;
+    } while (num != 0);
+    return concat(start, digits + sizeof(digits) - start);
+}
+
+bool String::concat(long long num) {
+    if (num < 0) {
+        concat('-');
+        return concat(0ULL - (unsigned long long)num);
+    }
+    return concat((unsigned long long)num);
+}
+
+bool String::concat(double num, int digits) {
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%.*f", digits < 0 ? 0 : digits, num);
+    return length > 0 && concat(buffer, (size_t)length < sizeof(buffer) ? (size_t)length : sizeof(buffer) - 1);
+}
+
+String& String::append(size_t count, char c) {
+    reserve(_length + count);
+    memset(_buffer + _length, c, count);
+    _length += count;
+    _buffer[_length] = '\0';
+    return *this;
+}
+
+size_t String::find(const char* str, size_t pos) const {
+    if (pos > _length) {
+        return npos;
+    }
+    const char* found = strstr(_buffer + pos, str);
+    return found ? (size_t)(found - _buffer) : npos;
+}
+
+size_t String::find(char c, size_t pos) const {
+    if (pos >= _length) {
+        return npos;
+    }
+    const char* found = (const char*)memchr(_buffer + pos, c, _length - pos);
+    return found ? (size_t)(found - _buffer) : npos;
+}
+
+String String::substr(size_t pos, size_t length) const {
+    if (pos > _length) {
+        return String();
+    }
+    if (length > _length - pos) {
+        length = _length - pos;
+    }
+    return String(_buffer + pos, length);
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t pos = find(c, from);
+    return pos == npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const char* str, unsigned int from) const {
+    size_t pos = find(str, from);
+    return pos == npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (to > _length) {
+        to = (unsigned int)_length;
+    }
+    if (from > to) {
+        return String();
+    }
+    return String(_buffer + from, to - from);
+}
+
+bool String::startsWith(const char* prefix) const {
+    size_t length = strlen(prefix);
+    return length <= _length && memcmp(_buffer, prefix, length) == 0;
+}
+
+int String::compare(const char* str) const {
+    return strcmp(_buffer, str ? str : "");
+}
+
+int String::compare(const String& str) const {
+    size_t length = _length < str._length ? _length : str._length;
+    int result = memcmp(_buffer, str._buffer, length);
+    if (result != 0) {
+        return result;
+    }
+    return _length < str._length ? -1 : (_length > str._length ? 1 : 0);
+}
+
+void String::trim() {
+    size_t start = 0;
+    while (start < _length && isspace((unsigned char)_buffer[start])) {
+        start++;
+    }
+    size_t end = _length;
+    while (end > start && isspace((unsigned char)_buffer[end - 1])) {
+        end--;
+    }
+    _length = end - start;
+    memmove(_buffer, _buffer + start, _length);
+    _buffer[_length] = '\0';
+}
+
+long String::toInt() const {
+    return strtol(_buffer, nullptr, 10);
+}
 
 // Time functions implementation
 static auto start_time = std::chrono::high_resolution_clock::now();
@@ -8,37 +8,249 @@
 #include <iostream>
 #include <ostream>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
 #include <SDL.h>
 
 // Arduino String compatibility
 // First, check if String is already defined as a typedef
 #ifndef String
 
-// Define String as a class with Arduino-like behavior
-class String : public std::string {
+// Characters a String holds without a heap allocation: lane and racer
+// names, formatted times and most log lines fit
+#define STRING_INLINE_CAPACITY 47
+
+/**
+ * @brief Arduino-compatible String for the simulator
+ *
+ * Text up to STRING_INLINE_CAPACITY characters is kept in the object itself;
+ * longer text moves to the heap and grows geometrically. Numbers are
+ * formatted in place, and appending to a temporary (`a + b + c`) extends it
+ * instead of creating a new String per operator, so the usual
+ * `"Lane " + String(id) + " Lap: " + ...` chains allocate at most once. For
+ * long lines, reserve() once and append with concat() or +=, which works
+ * the same on the ESP32's Arduino String.
+ *
+ * Every heap allocation is counted and can be reported to a hook, so
+ * simulator profiles show what the text paths would cost on the device.
+ */
+class String {
 public:
-    // Default constructors
-    String() : std::string() {}
-    String(const char* str) : std::string(str ? str : "") {}
-    String(const std::string& str) : std::string(str) {}
-    String(char c) : std::string(1, c) {}
-    
+    static const size_t npos = std::string::npos;
+
+    /**
+     * @brief Called with the size of every heap allocation made by a String
+     */
+    typedef void (*AllocationHook)(size_t bytes);
+
+    String() { init(); }
+    String(const char* str) { init(); concat(str); }
+    String(const char* str, size_t length) { init(); concat(str, length); }
+    String(const std::string& str) { init(); concat(str.data(), str.size()); }
+    String(const String& other) { init(); concat(other._buffer, other._length); }
+    String(String&& other) noexcept { init(); moveFrom(other); }
+    String(char c) { init(); concat(c); }
+
     // Integer constructors
-    String(int num) : std::string(std::to_string(num)) {}
-    String(unsigned int num) : std::string(std::to_string(num)) {}
-    String(long num) : std::string(std::to_string(num)) {}
-    String(unsigned long num) : std::string(std::to_string(num)) {}
-    String(long long num) : std::string(std::to_string(num)) {}
-    String(unsigned long long num) : std::string(std::to_string(num)) {}
-    
-    // Float constructors
-    String(float num, int digits = 2) : std::string(std::to_string(num)) {}
-    String(double num, int digits = 2) : std::string(std::to_string(num)) {}
-    
+    String(int num) { init(); concat(num); }
+    String(unsigned int num) { init(); concat(num); }
+    String(long num) { init(); concat(num); }
+    String(unsigned long num) { init(); concat(num); }
+    String(long long num) { init(); concat(num); }
+    String(unsigned long long num) { init(); concat(num); }
+
+    // Float constructors (digits after the decimal point, as on Arduino)
+    String(float num, int digits = 2) { init(); concat((double)num, digits); }
+    String(double num, int digits = 2) { init(); concat(num, digits); }
+
+    ~String() { release(); }
+
+    String& operator=(const String& other);
+    String& operator=(String&& other) noexcept;
+    String& operator=(const char* str);
+    String& operator=(const std::string& str) { return *this = String(str); }
+
+    // Access
+    const char* c_str() const { return _buffer; }
+    const char* data() const { return _buffer; }
+    size_t length() const { return _length; }
+    size_t size() const { return _length; }
+    size_t capacity() const { return _capacity; }
+    bool empty() const { return _length == 0; }
+    char operator[](size_t index) const { return _buffer[index]; }
+    char& operator[](size_t index) { return _buffer[index]; }
+    const char* begin() const { return _buffer; }
+    const char* end() const { return _buffer + _length; }
+    operator std::string() const { return std::string(_buffer, _length); }
+
+    /**
+     * @brief Make room for a length in characters, so appending up to it does not allocate
+     * @return true on success (always, in the simulator)
+     */
+    bool reserve(size_t length);
+    void clear();
+
+    // Appending (Arduino concat() and std::string append())
+    bool concat(const char* str);
+    bool concat(const char* str, size_t length) {
+        if (!str) {
+            return false;
+        }
+        if (_length + length > _capacity) {
+            return grow(str, length);
+        }
+        memcpy(_buffer + _length, str, length);
+        _length += length;
+        _buffer[_length] = '\0';
+        return true;
+    }
+    bool concat(const String& str) { return concat(str._buffer, str._length); }
+    bool concat(const std::string& str) { return concat(str.data(), str.size()); }
+    bool concat(char c) { return concat(&c, 1); }
+    bool concat(int num) { return concat((long long)num); }
+    bool concat(unsigned int num) { return concat((unsigned long long)num); }
+    bool concat(long num) { return concat((long long)num); }
+    bool concat(unsigned long num) { return concat((unsigned long long)num); }
+    bool concat(long long num);
+    bool concat(unsigned long long num);
+    bool concat(float num, int digits = 2) { return concat((double)num, digits); }
+    bool concat(double num, int digits = 2);
+    String& append(const char* str) { concat(str); return *this; }
+    String& append(const char* str, size_t length) { concat(str, length); return *this; }
+    String& append(const String& str) { concat(str); return *this; }
+    String& append(const std::string& str) { concat(str); return *this; }
+    String& append(size_t count, char c);
+
+    template<typename T>
+    String& operator+=(const T& value) { concat(value); return *this; }
+
+    // Searching
+    size_t find(const char* str, size_t pos = 0) const;
+    size_t find(char c, size_t pos = 0) const;
+    String substr(size_t pos, size_t length = npos) const;
+
     // Arduino compatibility methods
     bool isEmpty() const { return empty(); }
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const char* str, unsigned int from = 0) const;
+    String substring(unsigned int from, unsigned int to = (unsigned int)-1) const;
+    bool startsWith(const char* prefix) const;
+    void trim();
+    bool equals(const char* str) const { return compare(str) == 0; }
+    int compare(const char* str) const;
+    int compare(const String& str) const;
+    long toInt() const;
+
+    /**
+     * @brief Install a hook called for every heap allocation (nullptr to remove it)
+     */
+    static void setAllocationHook(AllocationHook hook) { _allocationHook = hook; }
+
+    /**
+     * @brief Heap allocations made by all Strings since startup
+     */
+    static uint32_t getAllocationCount() { return _allocationCount; }
+
+private:
+    char* _buffer;          // _inline, or a heap block of _capacity + 1 bytes
+    size_t _length;
+    size_t _capacity;
+    char _inline[STRING_INLINE_CAPACITY + 1];
+
+    static AllocationHook _allocationHook;
+    static uint32_t _allocationCount;
+
+    void init() {
+        _buffer = _inline;
+        _length = 0;
+        _capacity = STRING_INLINE_CAPACITY;
+        _inline[0] = '\0';
+    }
+    bool isInline() const { return _buffer == _inline; }
+    void release();
+    void moveFrom(String& other);
+    bool grow(const char* str, size_t length);
 };
 
+// Operators: a temporary left operand is extended in place
+inline String operator+(const String& lhs, const String& rhs) {
+    String result;
+    result.reserve(lhs.length() + rhs.length());
+    result.concat(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+inline String operator+(String&& lhs, const String& rhs) {
+    lhs.concat(rhs);
+    return std::move(lhs);
+}
+
+inline String operator+(const String& lhs, const char* rhs) {
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+inline String operator+(String&& lhs, const char* rhs) {
+    lhs.concat(rhs);
+    return std::move(lhs);
+}
+
+inline String operator+(const char* lhs, const String& rhs) {
+    String result;
+    result.reserve(strlen(lhs ? lhs : "") + rhs.length());
+    result.concat(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+inline String operator+(const String& lhs, char rhs) {
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+inline String operator+(String&& lhs, char rhs) {
+    lhs.concat(rhs);
+    return std::move(lhs);
+}
+
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline String operator+(const String& lhs, T rhs) {
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+inline String operator+(String&& lhs, T rhs) {
+    lhs.concat(rhs);
+    return std::move(lhs);
+}
+
+inline bool operator==(const String& lhs, const String& rhs) { return lhs.compare(rhs) == 0; }
+inline bool operator==(const String& lhs, const char* rhs) { return lhs.compare(rhs) == 0; }
+inline bool operator==(const char* lhs, const String& rhs) { return rhs.compare(lhs) == 0; }
+inline bool operator!=(const String& lhs, const String& rhs) { return lhs.compare(rhs) != 0; }
+inline bool operator!=(const String& lhs, const char* rhs) { return lhs.compare(rhs) != 0; }
+inline bool operator!=(const char* lhs, const String& rhs) { return rhs.compare(lhs) != 0; }
+inline bool operator<(const String& lhs, const String& rhs) { return lhs.compare(rhs) < 0; }
+
+inline std::ostream& operator<<(std::ostream& os, const String& str) {
+    return os.write(str.c_str(), str.length());
+}
+
+namespace std {
+    template<>
+    struct hash<String> {
+        size_t operator()(const String& str) const {
+            return hash<string>()(string(str.c_str(), str.length()));
+        }
+    };
+}
+
 // Arduino-compatible functions for simulator
 
 // Time functions
@@ -71,23 +283,6 @@ namespace ArduinoCompat {
     inline bool isEmpty(const std::string& str) { return str.empty(); }
 }
 
-// Extend std::string with Arduino-like constructors
-inline String operator+(const String& lhs, int rhs) {
-    return lhs + ArduinoCompat::toString(rhs);
-}
-
-inline String operator+(const String& lhs, unsigned int rhs) {
-    return lhs + ArduinoCompat::toString(rhs);
-}
-
-inline String operator+(const String& lhs, long rhs) {
-    return lhs + ArduinoCompat::toString(rhs);
-}
-
-inline String operator+(const String& lhs, unsigned long rhs) {
-    return lhs + ArduinoCompat::toString(rhs);
-}
-
 #endif // String not defined
 
 // Define common Arduino types
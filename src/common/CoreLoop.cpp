@@ -0,0 +1,118 @@
+#include "CoreLoop.h"
+
+CoreLoop::CoreLoop(const char* name, int core)
+    : _name(name)
+    , _core(core)
+    , _running(false)
+    , _passes(0)
+#ifdef SIMULATOR
+    , _wakePending(false)
+#else
+    , _task(nullptr)
+#endif
+{
+}
+
+CoreLoop::~CoreLoop() {
+    stop();
+}
+
+#ifdef SIMULATOR
+
+bool CoreLoop::start(Pass pass) {
+    if (_running || !pass) {
+        return false;
+    }
+    _pass = pass;
+    _wakePending = false;
+    _running = true;
+    _thread = std::thread(&CoreLoop::run, this);
+    return true;
+}
+
+void CoreLoop::stop() {
+    if (!_running) {
+        return;
+    }
+    _running = false;
+    wake();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void CoreLoop::wake() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _wakePending = true;
+    _wakeup.notify_one();
+}
+
+bool CoreLoop::isCurrentThread() const {
+    return _running && _thread.get_id() == std::this_thread::get_id();
+}
+
+void CoreLoop::run() {
+    while (_running) {
+        uint32_t idleMs = _pass();
+        _passes++;
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _wakeup.wait_for(lock, std::chrono::milliseconds(idleMs), [this]() {
+            return _wakePending || !_running;
+        });
+        _wakePending = false;
+    }
+}
+
+#else // ESP32
+
+bool CoreLoop::start(Pass pass) {
+    if (_running || !pass) {
+        return false;
+    }
+    _pass = pass;
+    _running = true;
+    if (xTaskCreatePinnedToCore(&CoreLoop::taskEntry, _name, CORE_LOOP_STACK_BYTES, this,
+                                CORE_LOOP_TASK_PRIORITY, &_task, _core) != pdPASS) {
+        _running = false;
+        _task = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void CoreLoop::stop() {
+    // The task deletes itself after its current pass
+    _running = false;
+    wake();
+}
+
+void CoreLoop::wake() {
+    TaskHandle_t task = _task;
+    if (task != nullptr) {
+        xTaskNotifyGive(task);
+    }
+}
+
+bool CoreLoop::isCurrentThread() const {
+    return _task != nullptr && xTaskGetCurrentTaskHandle() == _task;
+}
+
+void CoreLoop::taskEntry(void* param) {
+    CoreLoop* loop = static_cast<CoreLoop*>(param);
+    loop->run();
+    loop->_task = nullptr;
+    vTaskDelete(nullptr);
+}
+
+void CoreLoop::run() {
+    while (_running) {
+        uint32_t idleMs = _pass();
+        _passes++;
+
+        // Block until the next deadline or a wake(); a pending wake() returns at once
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idleMs));
+    }
+}
+
+#endif // SIMULATOR
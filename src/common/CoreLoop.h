@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+#ifdef SIMULATOR
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#else
+#include <Arduino.h>
+#endif
+
+// ESP32 cores: input and race timing on core 0, LVGL and the displays on core 1
+#define RACE_CORE 0
+#define DISPLAY_CORE 1
+
+// FreeRTOS task settings for a CoreLoop (ignored in the simulator)
+#define CORE_LOOP_STACK_BYTES 8192
+#define CORE_LOOP_TASK_PRIORITY 2
+
+/**
+ * @brief Runs a main loop pass over and over on its own thread
+ *
+ * The pass runs the tasks that are due (normally one TaskScheduler's
+ * runDue()) and returns how long the thread may sleep. On the ESP32 the
+ * thread is a FreeRTOS task pinned to one core; in the simulator it is a
+ * std::thread, so the same split into race and display loops runs on Linux.
+ *
+ * wake() cuts the current sleep short, e.g. after another thread queued
+ * work for this one; it may be called from any thread.
+ */
+class CoreLoop {
+public:
+    // Returns the milliseconds until the loop needs to run again
+    typedef std::function<uint32_t()> Pass;
+
+    /**
+     * @param name Thread name, kept by pointer (use a literal)
+     * @param core Core the ESP32 task is pinned to (RACE_CORE or DISPLAY_CORE)
+     */
+    CoreLoop(const char* name, int core);
+    ~CoreLoop();
+
+    /**
+     * @brief Start the thread running pass
+     *
+     * @return false if it is already running or the thread could not be created
+     */
+    bool start(Pass pass);
+
+    /**
+     * @brief Stop after the current pass; in the simulator, wait for the thread to end
+     */
+    void stop();
+
+    /**
+     * @brief Run the next pass now instead of after the sleep
+     */
+    void wake();
+
+    bool isRunning() const { return _running; }
+
+    /**
+     * @brief Whether the caller is running on this loop's thread
+     */
+    bool isCurrentThread() const;
+
+    const char* getName() const { return _name; }
+    int getCore() const { return _core; }
+    uint32_t getPassCount() const { return _passes; }
+
+private:
+    CoreLoop(const CoreLoop&) = delete;
+    CoreLoop& operator=(const CoreLoop&) = delete;
+
+    void run();
+
+    const char* _name;
+    int _core;
+    Pass _pass;
+    std::atomic<bool> _running;
+    std::atomic<uint32_t> _passes;
+
+#ifdef SIMULATOR
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _wakeup;
+    bool _wakePending;
+#else
+    static void taskEntry(void* param);
+
+    TaskHandle_t _task;
+#endif
+};
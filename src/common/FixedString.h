@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Size of a FixedString for one time: "MM:SS.mmm" with up to 5 minute digits
+#define TIME_STRING_SIZE 16
+
+/**
+ * @brief Text in a fixed buffer on the stack, with allocation-free formatting
+ *
+ * Numbers and times are appended digit by digit with integer divides; there
+ * is no printf and no heap. Appending past the capacity (N - 1 characters)
+ * truncates, and isTruncated() reports it. c_str() is always terminated.
+ *
+ * The same code runs on the ESP32 and in the simulator, so a FixedString
+ * can be formatted every tick and only turned into a String (one copy) where
+ * an interface still takes one.
+ */
+template<size_t N>
+class FixedString {
+    static_assert(N > 1, "FixedString needs room for a character and the terminator");
+
+public:
+    FixedString() : _length(0), _truncated(false) {
+        _buffer[0] = '\0';
+    }
+
+    explicit FixedString(const char* str) : FixedString() {
+        append(str);
+    }
+
+    const char* c_str() const { return _buffer; }
+    size_t length() const { return _length; }
+    bool isEmpty() const { return _length == 0; }
+    bool isTruncated() const { return _truncated; }
+    static constexpr size_t capacity() { return N - 1; }
+
+    void clear() {
+        _length = 0;
+        _truncated = false;
+        _buffer[0] = '\0';
+    }
+
+    FixedString& append(const char* str) {
+        return str ? append(str, strlen(str)) : *this;
+    }
+
+    FixedString& append(const char* str, size_t length) {
+        if (length > capacity() - _length) {
+            length = capacity() - _length;
+            _truncated = true;
+        }
+        memcpy(_buffer + _length, str, length);
+        _length += length;
+        _buffer[_length] = '\0';
+        return *this;
+    }
+
+    FixedString& append(char c) {
+        return append(&c, 1);
+    }
+
+    /**
+     * @brief Append an unsigned number, zero-padded to at least minDigits
+     */
+    FixedString& appendUnsigned(uint32_t value, uint8_t minDigits = 1) {
+        // Digits are produced from the end; 10 covers the largest 32-bit value
+        char digits[10];
+        char* start = digits + sizeof(digits);
+        do {
+            *--start = (char)('0' + value % 10);
+            value /= 10;
+        } while (value != 0 && start > digits);
+        while (start > digits && digits + sizeof(digits) - start < minDigits) {
+            *--start = '0';
+        }
+        return append(start, digits + sizeof(digits) - start);
+    }
+
+    FixedString& appendInt(int32_t value) {
+        if (value < 0) {
+            append('-');
+            return appendUnsigned(0u - (uint32_t)value);
+        }
+        return appendUnsigned((uint32_t)value);
+    }
+
+    /**
+     * @brief Append a time as "MM:SS" (minutes are not wrapped at an hour)
+     */
+    FixedString& appendTimeMMSS(uint32_t timeMs) {
+        uint32_t totalSeconds = timeMs / 1000;
+        appendUnsigned(totalSeconds / 60, 2);
+        append(':');
+        return appendUnsigned(totalSeconds % 60, 2);
+    }
+
+    /**
+     * @brief Append a time as "MM:SS.mmm" (minutes are not wrapped at an hour)
+     */
+    FixedString& appendTimeMMSSmmm(uint32_t timeMs) {
+        appendTimeMMSS(timeMs);
+        append('.');
+        return appendUnsigned(timeMs % 1000, 3);
+    }
+
+    FixedString& operator+=(const char* str) { return append(str); }
+    FixedString& operator+=(char c) { return append(c); }
+    FixedString& operator+=(int32_t value) { return appendInt(value); }
+    FixedString& operator+=(uint32_t value) { return appendUnsigned(value); }
+
+    bool operator==(const char* str) const { return strcmp(_buffer, str) == 0; }
+    bool operator!=(const char* str) const { return strcmp(_buffer, str) != 0; }
+
+private:
+    char _buffer[N];
+    size_t _length;
+    bool _truncated;
+};
+
+typedef FixedString<TIME_STRING_SIZE> TimeString;
+
+/**
+ * @brief Format a time as "MM:SS" without allocating
+ */
+inline TimeString formatTimeMMSS(uint32_t timeMs) {
+    TimeString text;
+    text.appendTimeMMSS(timeMs);
+    return text;
+}
+
+/**
+ * @brief Format a time as "MM:SS.mmm" without allocating
+ */
+inline TimeString formatTimeMMSSmmm(uint32_t timeMs) {
+    TimeString text;
+    text.appendTimeMMSSmmm(timeMs);
+    return text;
+}
@@ -70,7 +70,9 @@ public:
     /**
      * @brief Update the module state
      * 
-     * This should be called regularly in the main loop.
+     * Registered by the controller as a TaskScheduler task with the period
+     * the module needs (see common/Types.h), so the module does not throttle
+     * itself; every call is a due run.
      * Handles regular processing and state updates.
      */
     void update() {
@@ -79,18 +81,7 @@ public:
             return;
         }
         
-        // Example of using TimeManager for timing
-        unsigned long currentTime = TimeManager::GetInstance().GetCurrentTimeMs();
-        
-        // Only perform certain actions at specific intervals
-        if (currentTime - _lastUpdateTime >= _updateIntervalMs) {
-            _lastUpdateTime = currentTime;
-            
-            // Perform periodic updates
-            // ...
-        }
-        
-        // Regular processing
+        // Periodic processing, timed with TimeManager::GetInstance().GetCurrentTimeMs()
         // ...
     }
     
@@ -134,9 +125,7 @@ private:
      * @brief Private constructor (Singleton pattern)
      */
     ModuleTemplate() 
-        : _initialized(false)
-        , _lastUpdateTime(0)
-        , _updateIntervalMs(100) {
+        : _initialized(false) {
         // Constructor implementation
     }
     
@@ -156,10 +145,6 @@ private:
     // Flag to track if initialization has been performed
     bool _initialized;
     
-    // Timing variables
-    unsigned long _lastUpdateTime;
-    unsigned long _updateIntervalMs;
-    
     // Module-specific private members
     // ...
 };
@@ -0,0 +1,100 @@
+#include "SerialFraming.h"
+#include "TelemetryProtocol.h"
+#include <cstring>
+
+// ===== SerialFrameWriter =====
+
+bool SerialFrameWriter::append(SerialFrameType type, const uint8_t* payload, size_t length) {
+    if (length > SERIAL_FRAME_MAX_PAYLOAD) {
+        return false;
+    }
+
+    size_t start = _buffer.size();
+    _buffer.resize(start + SERIAL_FRAME_OVERHEAD + length);
+    uint8_t* frame = _buffer.data() + start;
+    frame[0] = SERIAL_FRAME_SYNC;
+    frame[1] = (uint8_t)type;
+    frame[2] = (uint8_t)length;
+    frame[3] = (uint8_t)(length >> 8);
+    frame[4] = frame[1] ^ frame[2] ^ frame[3] ^ SERIAL_FRAME_HEADER_SEED;
+    if (length > 0) {
+        memcpy(frame + SERIAL_FRAME_HEADER_BYTES, payload, length);
+    }
+
+    // Same CRC as the telemetry frames, over everything after the sync byte
+    uint16_t crc = TelemetryEncoder::crc16(frame + 1, SERIAL_FRAME_HEADER_BYTES - 1 + length);
+    frame[SERIAL_FRAME_HEADER_BYTES + length] = (uint8_t)crc;
+    frame[SERIAL_FRAME_HEADER_BYTES + length + 1] = (uint8_t)(crc >> 8);
+    return true;
+}
+
+// ===== SerialFrameReader =====
+
+SerialFrameReader::SerialFrameReader()
+    : _length(0)
+    , _framesReceived(0)
+    , _bytesDiscarded(0) {
+}
+
+void SerialFrameReader::feed(const uint8_t* data, size_t length, const SerialFrameHandler& handler) {
+    while (length > 0) {
+        // The buffer holds the largest frame, so a full buffer always completes or discards one
+        size_t space = sizeof(_frame) - _length;
+        size_t take = length < space ? length : space;
+        memcpy(_frame + _length, data, take);
+        _length += take;
+        data += take;
+        length -= take;
+
+        while (processFrame(handler)) {
+        }
+    }
+}
+
+// Hands over or discards the frame at the start of the buffer; false if more bytes are needed
+bool SerialFrameReader::processFrame(const SerialFrameHandler& handler) {
+    if (_length == 0) {
+        return false;
+    }
+
+    if (_frame[0] != SERIAL_FRAME_SYNC) {
+        const void* sync = memchr(_frame + 1, SERIAL_FRAME_SYNC, _length - 1);
+        discard(sync ? (const uint8_t*)sync - _frame : _length);
+        return true;
+    }
+
+    if (_length < SERIAL_FRAME_HEADER_BYTES) {
+        return false;
+    }
+    size_t payloadLength = _frame[2] | ((size_t)_frame[3] << 8);
+    if (_frame[4] != (_frame[1] ^ _frame[2] ^ _frame[3] ^ SERIAL_FRAME_HEADER_SEED) ||
+        payloadLength > SERIAL_FRAME_MAX_PAYLOAD) {
+        discard(1);
+        return true;
+    }
+    size_t frameLength = SERIAL_FRAME_OVERHEAD + payloadLength;
+    if (_length < frameLength) {
+        return false;
+    }
+
+    const uint8_t* crcBytes = _frame + SERIAL_FRAME_HEADER_BYTES + payloadLength;
+    uint16_t crc = (uint16_t)(crcBytes[0] | (crcBytes[1] << 8));
+    if (TelemetryEncoder::crc16(_frame + 1, SERIAL_FRAME_HEADER_BYTES - 1 + payloadLength) != crc) {
+        discard(1);
+        return true;
+    }
+
+    _framesReceived++;
+    if (handler) {
+        handler((SerialFrameType)_frame[1], _frame + SERIAL_FRAME_HEADER_BYTES, payloadLength);
+    }
+    _length -= frameLength;
+    memmove(_frame, _frame + frameLength, _length);
+    return true;
+}
+
+void SerialFrameReader::discard(size_t count) {
+    _bytesDiscarded += count;
+    _length -= count;
+    memmove(_frame, _frame + count, _length);
+}
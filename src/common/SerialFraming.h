@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/*
+ * Length-prefixed frames for the serial link between an ESP32 and the
+ * simulator (see SerialBridge).
+ *
+ *   sync | type | length | check | payload | crc16
+ *
+ *   sync     uint8     SERIAL_FRAME_SYNC
+ *   type     uint8     SerialFrameType
+ *   length   uint16    Payload bytes (little-endian, at most SERIAL_FRAME_MAX_PAYLOAD)
+ *   check    uint8     type ^ length bytes ^ SERIAL_FRAME_HEADER_SEED
+ *   crc16    uint16    CRC-16/CCITT-FALSE over type..payload (little-endian)
+ *
+ * A reader that sees a bad header or CRC drops the sync byte and looks for
+ * the next one, so it recovers from noise or from joining mid-stream. The
+ * header check keeps a stray sync byte from holding up the stream while
+ * the reader waits for a long payload that never comes.
+ */
+
+#define SERIAL_FRAME_SYNC 0xA5
+#define SERIAL_FRAME_MAX_PAYLOAD 1024
+#define SERIAL_FRAME_HEADER_SEED 0x5A
+#define SERIAL_FRAME_HEADER_BYTES 5
+#define SERIAL_FRAME_OVERHEAD (SERIAL_FRAME_HEADER_BYTES + 2)
+
+/**
+ * @brief What a frame carries
+ */
+enum class SerialFrameType : uint8_t {
+    Text = 1,       // Display text, as printed on the console
+    Command = 2,    // Input command line for the other side
+    Telemetry = 3   // A TelemetryProtocol frame
+};
+
+// Called for each complete frame; the payload is only valid during the call
+using SerialFrameHandler = std::function<void(SerialFrameType, const uint8_t*, size_t)>;
+
+/**
+ * @brief Collects frames into one buffer so they go out in a single write
+ *
+ * The buffer keeps its capacity across clear(), so batching does not
+ * allocate once it has grown to the usual batch size.
+ */
+class SerialFrameWriter {
+public:
+    /**
+     * @brief Append one frame to the batch
+     *
+     * @param type Frame type
+     * @param payload Payload bytes
+     * @param length Payload length (at most SERIAL_FRAME_MAX_PAYLOAD)
+     * @return false if the payload is too long
+     */
+    bool append(SerialFrameType type, const uint8_t* payload, size_t length);
+
+    const uint8_t* data() const { return _buffer.data(); }
+    size_t size() const { return _buffer.size(); }
+    bool empty() const { return _buffer.empty(); }
+    void clear() { _buffer.clear(); }
+
+    /**
+     * @brief Exchange batches with another writer, without copying
+     */
+    void swap(SerialFrameWriter& other) { _buffer.swap(other._buffer); }
+
+private:
+    std::vector<uint8_t> _buffer;
+};
+
+/**
+ * @brief Reassembles frames from a byte stream
+ *
+ * Bytes can arrive in chunks of any size; they are collected in one fixed
+ * buffer and each complete frame is handed to the handler from feed().
+ */
+class SerialFrameReader {
+public:
+    SerialFrameReader();
+
+    /**
+     * @brief Add received bytes, calling handler for every frame they complete
+     *
+     * @param data Received bytes
+     * @param length Number of bytes
+     * @param handler Receives each frame
+     */
+    void feed(const uint8_t* data, size_t length, const SerialFrameHandler& handler);
+
+    /**
+     * @brief Drop a partly received frame
+     */
+    void reset() { _length = 0; }
+
+    uint32_t getFramesReceived() const { return _framesReceived; }
+
+    /**
+     * @brief Bytes skipped while looking for a valid frame
+     */
+    uint32_t getBytesDiscarded() const { return _bytesDiscarded; }
+
+private:
+    bool processFrame(const SerialFrameHandler& handler);
+    void discard(size_t count);
+
+    uint8_t _frame[SERIAL_FRAME_OVERHEAD + SERIAL_FRAME_MAX_PAYLOAD];
+    size_t _length;
+    uint32_t _framesReceived;
+    uint32_t _bytesDiscarded;
+};
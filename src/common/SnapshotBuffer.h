@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Lock-free handoff of the latest value from one writer thread to one reader thread
+ *
+ * A double buffer with a spare slot: the writer fills its own slot and
+ * publish() swaps it with the shared one, and the reader swaps the shared
+ * slot with its own when something new was published. Both swaps are one
+ * atomic exchange, so neither side ever waits for the other, and a slot is
+ * only ever touched by one thread at a time. Values the reader did not get
+ * to are replaced by newer ones; the reader always sees the newest.
+ *
+ * Nothing is allocated here; a T that keeps its capacity (a vector that is
+ * assigned the same number of elements) is not reallocated once every slot
+ * has been written.
+ */
+template<typename T>
+class SnapshotBuffer {
+public:
+    SnapshotBuffer() : _writeSlot(0), _readSlot(1), _shared(2), _published(0), _taken(0) {}
+
+    /**
+     * @brief The writer's slot, to fill before publish(); holds an older value
+     */
+    T& beginWrite() { return _slots[_writeSlot]; }
+
+    /**
+     * @brief Make the writer's slot the latest value and take a free one for the next write
+     */
+    void publish() {
+        uint8_t previous = _shared.exchange((uint8_t)(_writeSlot | FRESH), std::memory_order_acq_rel);
+        _writeSlot = previous & SLOT_MASK;
+        _published.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Whether a value was published since the reader last took one
+     */
+    bool hasNew() const { return (_shared.load(std::memory_order_acquire) & FRESH) != 0; }
+
+    /**
+     * @brief Take the latest published value
+     *
+     * @return The value, valid until the next call on the reader's thread,
+     *         or nullptr if nothing was published since the last take
+     */
+    const T* takeLatest() {
+        if (!hasNew()) {
+            return nullptr;
+        }
+        uint8_t previous = _shared.exchange(_readSlot, std::memory_order_acq_rel);
+        _readSlot = previous & SLOT_MASK;
+        _taken.fetch_add(1, std::memory_order_relaxed);
+        return &_slots[_readSlot];
+    }
+
+    uint32_t getPublishedCount() const { return _published.load(std::memory_order_relaxed); }
+    uint32_t getTakenCount() const { return _taken.load(std::memory_order_relaxed); }
+
+private:
+    static const uint8_t SLOT_MASK = 0x03;
+    static const uint8_t FRESH = 0x04;   // The shared slot holds a value not yet taken
+
+    SnapshotBuffer(const SnapshotBuffer&) = delete;
+    SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+    T _slots[3];
+    uint8_t _writeSlot;                 // Writer thread only
+    uint8_t _readSlot;                  // Reader thread only
+    std::atomic<uint8_t> _shared;       // Slot being handed over, plus FRESH
+    std::atomic<uint32_t> _published;
+    std::atomic<uint32_t> _taken;
+};
@@ -0,0 +1,151 @@
+#include "TaskScheduler.h"
+#include "DebugUtils.h"
+#include <string.h>
+
+TaskScheduler::TaskScheduler() : _taskCount(0) {
+    memset(_order, 0, sizeof(_order));
+}
+
+TaskScheduler::TaskId TaskScheduler::addPeriodicTask(const char* name, TaskPriority priority, uint32_t intervalMs,
+                                                     TaskFunction function) {
+    return addTask(name, priority, intervalMs, function);
+}
+
+TaskScheduler::TaskId TaskScheduler::addEventTask(const char* name, TaskPriority priority, TaskFunction function) {
+    return addTask(name, priority, 0, function);
+}
+
+TaskScheduler::TaskId TaskScheduler::addTask(const char* name, TaskPriority priority, uint32_t intervalMs,
+                                             TaskFunction function) {
+    if (_taskCount >= TASK_SCHEDULER_MAX_TASKS || !function) {
+        return -1;
+    }
+
+    TaskId id = _taskCount++;
+    Task& task = _tasks[id];
+    task.function = function;
+    memset(&task.stats, 0, sizeof(task.stats));
+    strncpy(task.stats.name, name ? name : "", TASK_SCHEDULER_NAME - 1);
+    task.stats.priority = priority;
+    task.stats.intervalMs = intervalMs;
+    task.deadline = 0;
+    task.scheduled = false;
+    task.notified = false;
+
+    // Insert after every task of the same or a higher priority
+    int slot = id;
+    while (slot > 0 && _tasks[_order[slot - 1]].stats.priority > priority) {
+        _order[slot] = _order[slot - 1];
+        slot--;
+    }
+    _order[slot] = (uint8_t)id;
+    return id;
+}
+
+void TaskScheduler::notify(TaskId id) {
+    if (id >= 0 && id < _taskCount) {
+        _tasks[id].notified = true;
+    }
+}
+
+void TaskScheduler::setInterval(TaskId id, uint32_t intervalMs) {
+    if (id < 0 || id >= _taskCount) {
+        return;
+    }
+    _tasks[id].stats.intervalMs = intervalMs;
+    _tasks[id].scheduled = false;
+}
+
+uint32_t TaskScheduler::runDue(uint32_t nowMs) {
+    for (int i = 0; i < _taskCount; i++) {
+        Task& task = _tasks[_order[i]];
+        uint32_t interval = task.stats.intervalMs;
+
+        // A deadline more than a period away means the clock went backwards
+        if (task.scheduled && (int32_t)(task.deadline - nowMs) > (int32_t)interval) {
+            task.deadline = nowMs + interval;
+        }
+
+        bool due = interval > 0 && (!task.scheduled || (int32_t)(nowMs - task.deadline) >= 0);
+        bool notified = task.notified.exchange(false);
+        if (!due && !notified) {
+            continue;
+        }
+
+        if (due) {
+            if (task.scheduled && nowMs - task.deadline > task.stats.maxLateMs) {
+                task.stats.maxLateMs = nowMs - task.deadline;
+            }
+            // Missed runs are skipped, not made up
+            task.deadline = task.scheduled ? task.deadline + interval : nowMs + interval;
+            if ((int32_t)(nowMs - task.deadline) >= 0) {
+                task.deadline = nowMs + interval;
+            }
+            task.scheduled = true;
+        }
+        run(task);
+    }
+    return getTimeUntilNextMs(nowMs);
+}
+
+void TaskScheduler::run(Task& task) {
+    uint32_t start = micros();
+    task.function();
+    uint32_t elapsed = micros() - start;
+
+    task.stats.runs++;
+    task.stats.totalUs += elapsed;
+    if (elapsed > task.stats.maxUs) {
+        task.stats.maxUs = elapsed;
+    }
+}
+
+uint32_t TaskScheduler::getTimeUntilNextMs(uint32_t nowMs) const {
+    uint32_t wait = TASK_SCHEDULER_MAX_SLEEP_MS;
+    for (int i = 0; i < _taskCount; i++) {
+        const Task& task = _tasks[i];
+        if (task.notified) {
+            return 0;
+        }
+        if (task.stats.intervalMs == 0) {
+            continue;
+        }
+        if (!task.scheduled || (int32_t)(task.deadline - nowMs) <= 0) {
+            return 0;
+        }
+        if (task.deadline - nowMs < wait) {
+            wait = task.deadline - nowMs;
+        }
+    }
+    return wait;
+}
+
+const TaskStats* TaskScheduler::findTaskStats(const char* name) const {
+    for (int i = 0; i < _taskCount; i++) {
+        if (strcmp(_tasks[i].stats.name, name) == 0) {
+            return &_tasks[i].stats;
+        }
+    }
+    return nullptr;
+}
+
+void TaskScheduler::resetStats() {
+    for (int i = 0; i < _taskCount; i++) {
+        TaskStats& stats = _tasks[i].stats;
+        stats.runs = 0;
+        stats.totalUs = 0;
+        stats.maxUs = 0;
+        stats.maxLateMs = 0;
+    }
+}
+
+void TaskScheduler::printReport() const {
+    DPRINTF("Tasks (%d):\n", _taskCount);
+    for (int i = 0; i < _taskCount; i++) {
+        const TaskStats& stats = _tasks[_order[i]].stats;
+        uint32_t averageUs = stats.runs ? (uint32_t)(stats.totalUs / stats.runs) : 0;
+        DPRINTF("  %-12s prio %u, every %4u ms: %u runs, avg %u us, max %u us, late up to %u ms\n",
+                stats.name, (unsigned)stats.priority, (unsigned)stats.intervalMs, (unsigned)stats.runs,
+                (unsigned)averageUs, (unsigned)stats.maxUs, (unsigned)stats.maxLateMs);
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+// Tasks one scheduler can hold
+#define TASK_SCHEDULER_MAX_TASKS 8
+#define TASK_SCHEDULER_NAME 16
+
+// Longest wait runDue() reports, so a loop with no periodic task still comes around
+#define TASK_SCHEDULER_MAX_SLEEP_MS 1000
+
+/**
+ * @brief Order in which due tasks run within one pass, first to last
+ */
+enum class TaskPriority : uint8_t {
+    Input = 0,      // Draining sensors and other input sources
+    Race = 1,       // Race logic and the start lights
+    Display = 2     // Pushing race data and updating the displays
+};
+
+using TaskFunction = std::function<void()>;
+
+/**
+ * @brief Run time of one task
+ */
+struct TaskStats {
+    char name[TASK_SCHEDULER_NAME];
+    TaskPriority priority;
+    uint32_t intervalMs;    // 0 for a task that only runs when notified
+    uint32_t runs;
+    uint64_t totalUs;       // Time spent in the task over all runs
+    uint32_t maxUs;         // Longest single run
+    uint32_t maxLateMs;     // Most a periodic run started after its deadline
+};
+
+/**
+ * @brief Deadline-based cooperative scheduler for the main loop
+ *
+ * Modules register periodic tasks (run every intervalMs) and event tasks
+ * (run once after each notify()). runDue() runs every task that is due, in
+ * priority order, and returns how long the caller can sleep before the next
+ * deadline, so the loop neither spins nor sleeps a fixed time. A periodic
+ * task can also be notified to run early; its cadence is unchanged.
+ *
+ * Time comes from the caller, normally TimeManager. A task that falls behind
+ * skips the runs it missed instead of running them back to back, and a clock
+ * that jumps backwards (replay hands time back to the live clock) reschedules
+ * the tasks instead of stalling them.
+ *
+ * Tasks run on the thread that calls runDue(). notify() only sets a flag and
+ * may be called from other threads and interrupt handlers.
+ */
+class TaskScheduler {
+public:
+    typedef int TaskId;
+
+    TaskScheduler();
+
+    /**
+     * @brief Register a task that runs every intervalMs, starting with the next pass
+     *
+     * @return The task's id, or -1 if the scheduler is full
+     */
+    TaskId addPeriodicTask(const char* name, TaskPriority priority, uint32_t intervalMs, TaskFunction function);
+
+    /**
+     * @brief Register a task that runs once after each notify()
+     *
+     * @return The task's id, or -1 if the scheduler is full
+     */
+    TaskId addEventTask(const char* name, TaskPriority priority, TaskFunction function);
+
+    /**
+     * @brief Make a task due on the next pass; several notifies before it runs count once
+     */
+    void notify(TaskId id);
+
+    /**
+     * @brief Change a task's period; 0 turns it into an event task
+     */
+    void setInterval(TaskId id, uint32_t intervalMs);
+
+    /**
+     * @brief Run every due task once, highest priority first
+     *
+     * A task notified during the pass still runs in it when its priority
+     * comes later; otherwise it runs on the next pass.
+     *
+     * @param nowMs Current time
+     * @return Milliseconds from nowMs until the next task is due (0 if one already is)
+     */
+    uint32_t runDue(uint32_t nowMs);
+
+    /**
+     * @brief Milliseconds from nowMs until the next task is due, at most TASK_SCHEDULER_MAX_SLEEP_MS
+     */
+    uint32_t getTimeUntilNextMs(uint32_t nowMs) const;
+
+    int getTaskCount() const { return _taskCount; }
+    const TaskStats& getTaskStats(TaskId id) const { return _tasks[id].stats; }
+
+    /**
+     * @brief Find a task's statistics by name
+     *
+     * @return The statistics, or nullptr if there is no such task
+     */
+    const TaskStats* findTaskStats(const char* name) const;
+
+    /**
+     * @brief Clear the run counts and times, keeping the tasks
+     */
+    void resetStats();
+
+    /**
+     * @brief Print every task's runs and run time to the debug output
+     */
+    void printReport() const;
+
+private:
+    struct Task {
+        TaskFunction function;
+        TaskStats stats;
+        uint32_t deadline;
+        bool scheduled;             // deadline is set; false until the first run
+        std::atomic<bool> notified;
+    };
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    TaskId addTask(const char* name, TaskPriority priority, uint32_t intervalMs, TaskFunction function);
+    void run(Task& task);
+
+    Task _tasks[TASK_SCHEDULER_MAX_TASKS];
+    uint8_t _order[TASK_SCHEDULER_MAX_TASKS];   // Task ids by priority, then registration
+    int _taskCount;
+};
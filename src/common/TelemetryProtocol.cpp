@@ -0,0 +1,264 @@
+#include "TelemetryProtocol.h"
+
+// ===== Little-endian field helpers =====
+
+static uint8_t* put16(uint8_t* p, uint16_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    return p + 2;
+}
+
+static uint8_t* put32(uint8_t* p, uint32_t value) {
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+    return p + 4;
+}
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Header is version, type and sequence; payload follows
+#define TELEMETRY_HEADER_BYTES 4
+#define TELEMETRY_CRC_BYTES 2
+#define TELEMETRY_LANE_STATE_HEADER_BYTES 6
+
+// ===== TelemetryEncoder =====
+
+TelemetryEncoder::TelemetryEncoder()
+    : _sequence(0) {
+}
+
+size_t TelemetryEncoder::encodeLaneState(const TelemetryLaneState& state, uint8_t* out) {
+    uint8_t raw[TELEMETRY_MAX_RAW_BYTES];
+    uint8_t laneCount = state.laneCount < TELEMETRY_MAX_LANES ? state.laneCount : TELEMETRY_MAX_LANES;
+
+    uint8_t* p = raw + TELEMETRY_HEADER_BYTES;
+    p = put32(p, state.raceTimeMs);
+    *p++ = state.raceState;
+    *p++ = laneCount;
+    for (uint8_t i = 0; i < laneCount; i++) {
+        const TelemetryLane& lane = state.lanes[i];
+        *p++ = lane.laneId;
+        *p++ = lane.flags;
+        *p++ = lane.position;
+        p = put16(p, lane.currentLap);
+        p = put16(p, lane.totalLaps);
+        p = put32(p, lane.lastLapTime);
+        p = put32(p, lane.bestLapTime);
+        p = put32(p, lane.totalTime);
+    }
+    return finishFrame(TelemetryFrameType::LaneState, raw, p - raw - TELEMETRY_HEADER_BYTES, out);
+}
+
+size_t TelemetryEncoder::encodeLap(const TelemetryLap& lap, uint8_t* out) {
+    uint8_t raw[TELEMETRY_HEADER_BYTES + TELEMETRY_LAP_RECORD_BYTES + TELEMETRY_CRC_BYTES];
+    uint8_t* p = raw + TELEMETRY_HEADER_BYTES;
+    *p++ = lap.laneId;
+    p = put16(p, lap.lap);
+    p = put32(p, lap.lapTime);
+    p = put32(p, lap.timestamp);
+    return finishFrame(TelemetryFrameType::Lap, raw, TELEMETRY_LAP_RECORD_BYTES, out);
+}
+
+// Fills in the header and CRC around a payload already in raw, then frames it into out
+size_t TelemetryEncoder::finishFrame(TelemetryFrameType type, uint8_t* raw, size_t payloadLength, uint8_t* out) {
+    raw[0] = TELEMETRY_PROTOCOL_VERSION;
+    raw[1] = (uint8_t)type;
+    put16(raw + 2, _sequence++);
+    size_t length = TELEMETRY_HEADER_BYTES + payloadLength;
+    put16(raw + length, crc16(raw, length));
+    length += TELEMETRY_CRC_BYTES;
+
+    out[0] = 0;
+    size_t written = 1 + cobsEncode(raw, length, out + 1);
+    out[written++] = 0;
+    return written;
+}
+
+// CRC of every byte value, built at compile time so it can stay in flash
+struct Crc16Table {
+    uint16_t entries[256];
+
+    constexpr Crc16Table() : entries() {
+        for (int value = 0; value < 256; value++) {
+            uint16_t crc = (uint16_t)(value << 8);
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+            }
+            entries[value] = crc;
+        }
+    }
+};
+
+static constexpr Crc16Table CRC16_TABLE;
+
+uint16_t TelemetryEncoder::crc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc = (uint16_t)((crc << 8) ^ CRC16_TABLE.entries[(crc >> 8) ^ data[i]]);
+    }
+    return crc;
+}
+
+size_t TelemetryEncoder::cobsEncode(const uint8_t* data, size_t length, uint8_t* out) {
+    size_t write = 1;
+    size_t codeIndex = 0;
+    uint8_t code = 1;
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] == 0) {
+            out[codeIndex] = code;
+            codeIndex = write++;
+            code = 1;
+            continue;
+        }
+        out[write++] = data[i];
+        if (++code == 0xFF) {
+            out[codeIndex] = code;
+            codeIndex = write++;
+            code = 1;
+        }
+    }
+    out[codeIndex] = code;
+    return write;
+}
+
+size_t TelemetryEncoder::cobsDecode(const uint8_t* data, size_t length, uint8_t* out) {
+    size_t read = 0;
+    size_t write = 0;
+    while (read < length) {
+        uint8_t code = data[read++];
+        if (code == 0 || read + code - 1 > length) {
+            return 0;
+        }
+        for (uint8_t i = 1; i < code; i++) {
+            if (data[read] == 0) {
+                return 0;
+            }
+            out[write++] = data[read++];
+        }
+        if (code != 0xFF && read < length) {
+            out[write++] = 0;
+        }
+    }
+    return write;
+}
+
+// ===== TelemetryDecoder =====
+
+TelemetryDecoder::TelemetryDecoder()
+    : _encodedLength(0)
+    , _overflow(false)
+    , _hasSequence(false)
+    , _nextSequence(0)
+    , _framesDecoded(0)
+    , _framesRejected(0)
+    , _framesLost(0) {
+}
+
+void TelemetryDecoder::feed(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = data[i];
+        if (byte != 0) {
+            if (_encodedLength < sizeof(_encoded)) {
+                _encoded[_encodedLength++] = byte;
+            } else {
+                _overflow = true;
+            }
+            continue;
+        }
+
+        // Delimiter: back-to-back zeros between frames are not frames
+        if (_overflow) {
+            _framesRejected++;
+        } else if (_encodedLength > 0) {
+            decodeFrame();
+        }
+        _encodedLength = 0;
+        _overflow = false;
+    }
+}
+
+void TelemetryDecoder::decodeFrame() {
+    size_t length = TelemetryEncoder::cobsDecode(_encoded, _encodedLength, _raw);
+    if (length < TELEMETRY_HEADER_BYTES + TELEMETRY_CRC_BYTES ||
+        _raw[0] != TELEMETRY_PROTOCOL_VERSION ||
+        TelemetryEncoder::crc16(_raw, length - TELEMETRY_CRC_BYTES) != get16(_raw + length - TELEMETRY_CRC_BYTES)) {
+        _framesRejected++;
+        return;
+    }
+
+    const uint8_t* payload = _raw + TELEMETRY_HEADER_BYTES;
+    size_t payloadLength = length - TELEMETRY_HEADER_BYTES - TELEMETRY_CRC_BYTES;
+    TelemetryFrameType type = (TelemetryFrameType)_raw[1];
+    TelemetryLaneState state;
+    TelemetryLap lap;
+    switch (type) {
+        case TelemetryFrameType::LaneState:
+            if (!parseLaneState(payload, payloadLength, state)) {
+                _framesRejected++;
+                return;
+            }
+            break;
+        case TelemetryFrameType::Lap:
+            if (payloadLength != TELEMETRY_LAP_RECORD_BYTES) {
+                _framesRejected++;
+                return;
+            }
+            lap.laneId = payload[0];
+            lap.lap = get16(payload + 1);
+            lap.lapTime = get32(payload + 3);
+            lap.timestamp = get32(payload + 7);
+            break;
+        default:
+            // Newer frame types within the same version are counted but not handled
+            break;
+    }
+
+    uint16_t sequence = get16(_raw + 2);
+    if (_hasSequence) {
+        _framesLost += (uint16_t)(sequence - _nextSequence);
+    }
+    _hasSequence = true;
+    _nextSequence = sequence + 1;
+    _framesDecoded++;
+
+    if (type == TelemetryFrameType::LaneState && _laneStateHandler) {
+        _laneStateHandler(state);
+    } else if (type == TelemetryFrameType::Lap && _lapHandler) {
+        _lapHandler(lap);
+    }
+}
+
+bool TelemetryDecoder::parseLaneState(const uint8_t* payload, size_t length, TelemetryLaneState& state) const {
+    if (length < TELEMETRY_LANE_STATE_HEADER_BYTES) {
+        return false;
+    }
+    state.raceTimeMs = get32(payload);
+    state.raceState = payload[4];
+    state.laneCount = payload[5];
+    if (state.laneCount > TELEMETRY_MAX_LANES ||
+        length != TELEMETRY_LANE_STATE_HEADER_BYTES + (size_t)state.laneCount * TELEMETRY_LANE_RECORD_BYTES) {
+        return false;
+    }
+
+    const uint8_t* p = payload + TELEMETRY_LANE_STATE_HEADER_BYTES;
+    for (uint8_t i = 0; i < state.laneCount; i++, p += TELEMETRY_LANE_RECORD_BYTES) {
+        TelemetryLane& lane = state.lanes[i];
+        lane.laneId = p[0];
+        lane.flags = p[1];
+        lane.position = p[2];
+        lane.currentLap = get16(p + 3);
+        lane.totalLaps = get16(p + 5);
+        lane.lastLapTime = get32(p + 7);
+        lane.bestLapTime = get32(p + 11);
+        lane.totalTime = get32(p + 15);
+    }
+    return true;
+}
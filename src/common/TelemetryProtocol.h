@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/*
+ * Binary race telemetry for external scoreboards and timing software.
+ *
+ * This file and TelemetryProtocol.cpp only use the C++ standard library, so
+ * host programs can build them as they are to decode the stream.
+ *
+ * Frame on the wire:
+ *
+ *   0x00  COBS( version | type | sequence | payload | crc16 )  0x00
+ *
+ *   version   uint8     TELEMETRY_PROTOCOL_VERSION
+ *   type      uint8     TelemetryFrameType
+ *   sequence  uint16    Incremented for every frame, so a decoder can count lost frames
+ *   payload             See TelemetryFrameType
+ *   crc16     uint16    CRC-16/CCITT-FALSE over version..payload
+ *
+ * Multi-byte fields are little-endian. COBS keeps 0x00 out of the frame, so
+ * a decoder finds frame boundaries by the zero bytes alone and resyncs after
+ * noise. Text on the same serial line (log lines) has no zero bytes and is
+ * rejected by the CRC, which is why each frame also starts with a 0x00.
+ */
+
+#define TELEMETRY_PROTOCOL_VERSION 1
+
+// Lanes a LaneState frame can carry
+#define TELEMETRY_MAX_LANES 8
+
+// Encoded lane and lap record sizes in bytes
+#define TELEMETRY_LANE_RECORD_BYTES 19
+#define TELEMETRY_LAP_RECORD_BYTES 11
+
+// Largest frame before COBS: header, LaneState payload with every lane, CRC
+#define TELEMETRY_MAX_RAW_BYTES (4 + 6 + TELEMETRY_MAX_LANES * TELEMETRY_LANE_RECORD_BYTES + 2)
+
+// Largest frame on the wire: COBS overhead and both delimiters included
+#define TELEMETRY_MAX_FRAME_BYTES (TELEMETRY_MAX_RAW_BYTES + TELEMETRY_MAX_RAW_BYTES / 254 + 3)
+
+#define TELEMETRY_LANE_ENABLED  0x01
+#define TELEMETRY_LANE_FINISHED 0x02
+
+/**
+ * @brief Frame types
+ */
+enum class TelemetryFrameType : uint8_t {
+    LaneState = 1,  // raceTimeMs u32, raceState u8, laneCount u8, laneCount lane records
+    Lap = 2         // One lap record
+};
+
+/**
+ * @brief One lane in a LaneState frame
+ *
+ * Record: laneId u8, flags u8, position u8, currentLap u16, totalLaps u16,
+ * lastLapTime u32, bestLapTime u32, totalTime u32.
+ */
+struct TelemetryLane {
+    uint8_t laneId;         // Lane identifier (1-based)
+    uint8_t flags;          // TELEMETRY_LANE_* flags
+    uint8_t position;       // Race position
+    uint16_t currentLap;    // Laps completed
+    uint16_t totalLaps;     // Laps to complete
+    uint32_t lastLapTime;   // Last lap time in milliseconds
+    uint32_t bestLapTime;   // Best lap time in milliseconds
+    uint32_t totalTime;     // Total race time in milliseconds
+};
+
+/**
+ * @brief Every lane at one point of the race
+ */
+struct TelemetryLaneState {
+    uint32_t raceTimeMs;    // Race clock
+    uint8_t raceState;      // RaceState value
+    uint8_t laneCount;      // Lanes used in lanes[]
+    TelemetryLane lanes[TELEMETRY_MAX_LANES];
+};
+
+/**
+ * @brief A lap that was just registered
+ *
+ * Record: laneId u8, lap u16, lapTime u32, timestamp u32.
+ */
+struct TelemetryLap {
+    uint8_t laneId;         // Lane identifier (1-based)
+    uint16_t lap;           // Lap number just completed
+    uint32_t lapTime;       // Lap time in milliseconds
+    uint32_t timestamp;     // Time the lap was registered, in milliseconds
+};
+
+/**
+ * @brief Builds telemetry frames into caller buffers without allocating
+ */
+class TelemetryEncoder {
+public:
+    TelemetryEncoder();
+
+    /**
+     * @brief Encode a LaneState frame
+     *
+     * @param state Lane state; lanes beyond TELEMETRY_MAX_LANES are not sent
+     * @param out Buffer of at least TELEMETRY_MAX_FRAME_BYTES
+     * @return size_t Bytes written
+     */
+    size_t encodeLaneState(const TelemetryLaneState& state, uint8_t* out);
+
+    /**
+     * @brief Encode a Lap frame
+     *
+     * @param lap Lap event
+     * @param out Buffer of at least TELEMETRY_MAX_FRAME_BYTES
+     * @return size_t Bytes written
+     */
+    size_t encodeLap(const TelemetryLap& lap, uint8_t* out);
+
+    uint16_t getSequence() const { return _sequence; }
+
+    /**
+     * @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+     */
+    static uint16_t crc16(const uint8_t* data, size_t length);
+
+    /**
+     * @brief COBS-encode data, without delimiters
+     *
+     * @return size_t Bytes written to out (at most length + length / 254 + 1)
+     */
+    static size_t cobsEncode(const uint8_t* data, size_t length, uint8_t* out);
+
+    /**
+     * @brief Decode COBS data without delimiters
+     *
+     * @return size_t Bytes written to out, 0 if the data is not valid COBS
+     */
+    static size_t cobsDecode(const uint8_t* data, size_t length, uint8_t* out);
+
+private:
+    size_t finishFrame(TelemetryFrameType type, uint8_t* raw, size_t payloadLength, uint8_t* out);
+
+    uint16_t _sequence;
+};
+
+using TelemetryLaneStateHandler = std::function<void(const TelemetryLaneState&)>;
+using TelemetryLapHandler = std::function<void(const TelemetryLap&)>;
+
+/**
+ * @brief Incremental decoder for a telemetry byte stream
+ *
+ * Bytes can be fed in chunks of any size; complete frames are handed to the
+ * handlers from feed(). The decoder works in two fixed buffers and never
+ * allocates. Frames that are too long, fail the CRC or have a different
+ * version are counted and skipped.
+ */
+class TelemetryDecoder {
+public:
+    TelemetryDecoder();
+
+    /**
+     * @brief Decode bytes received from the stream
+     *
+     * @param data Received bytes
+     * @param length Number of bytes
+     */
+    void feed(const uint8_t* data, size_t length);
+
+    void setLaneStateHandler(TelemetryLaneStateHandler handler) { _laneStateHandler = handler; }
+    void setLapHandler(TelemetryLapHandler handler) { _lapHandler = handler; }
+
+    uint32_t getFramesDecoded() const { return _framesDecoded; }
+    uint32_t getFramesRejected() const { return _framesRejected; }
+
+    /**
+     * @brief Frames the sender numbered but that never arrived intact
+     */
+    uint32_t getFramesLost() const { return _framesLost; }
+
+private:
+    void decodeFrame();
+    bool parseLaneState(const uint8_t* payload, size_t length, TelemetryLaneState& state) const;
+
+    uint8_t _encoded[TELEMETRY_MAX_FRAME_BYTES];
+    uint8_t _raw[TELEMETRY_MAX_FRAME_BYTES];
+    size_t _encodedLength;
+    bool _overflow;             // Current frame is too long; skip to the next delimiter
+    bool _hasSequence;
+    uint16_t _nextSequence;
+    uint32_t _framesDecoded;
+    uint32_t _framesRejected;
+    uint32_t _framesLost;
+    TelemetryLaneStateHandler _laneStateHandler;
+    TelemetryLapHandler _lapHandler;
+};
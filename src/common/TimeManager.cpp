@@ -13,7 +13,7 @@ bool TimeManager::Initialize() {
 }
 
 void TimeManager::Update() {
-    if (!m_isPaused) {
+    if (!m_isPaused && !m_isReplayActive) {
         m_currentTimeMs = millis();
     }
 }
@@ -42,6 +42,20 @@ bool TimeManager::IsPaused() const {
     return m_isPaused;
 }
 
+void TimeManager::SetReplayTime(uint32_t timeMs) {
+    m_isReplayActive = true;
+    m_currentTimeMs = timeMs;
+}
+
+void TimeManager::ClearReplayTime() {
+    m_isReplayActive = false;
+    m_currentTimeMs = millis();
+}
+
+bool TimeManager::IsReplayActive() const {
+    return m_isReplayActive;
+}
+
 void TimeManager::updateTime() {
     if (!m_isPaused) {
         m_currentTimeMs = millis();
@@ -21,6 +21,11 @@ public:
     void Resume();
     bool IsPaused() const;
 
+    // Replay clock: while set, the current time follows the replayed trace
+    void SetReplayTime(uint32_t timeMs);
+    void ClearReplayTime();
+    bool IsReplayActive() const;
+
 private:
     TimeManager() = default;
     ~TimeManager() = default;
@@ -30,4 +35,5 @@ private:
     uint32_t m_currentTimeMs = 0;
     bool m_isPaused = false;
     uint32_t m_pausedTimeMs = 0;
+    bool m_isReplayActive = false;
 };
@@ -15,6 +15,27 @@
 // Default debounce time in milliseconds
 #define DEFAULT_DEBOUNCE_TIME 1000
 
+// Default glitch window in milliseconds (triggers closer than this are contact bounce)
+#define DEFAULT_GLITCH_TIME 50
+
+// Default rate at which changed race data is pushed to the displays (frames per second)
+#define DEFAULT_DISPLAY_FRAME_RATE 10
+
+// Minimum spacing of urgent (lap) display pushes in milliseconds, about one LCD refresh
+#define DISPLAY_URGENT_MIN_INTERVAL_MS 16
+
+// Main loop task periods in milliseconds (see common/TaskScheduler.h)
+#define INPUT_POLL_INTERVAL_MS 5        // Input modules are polled; sensors have no interrupt yet
+#define RACE_UPDATE_INTERVAL_MS 100     // RaceModule::update(): race clock, second ticks, journal flushes
+#define LIGHTS_UPDATE_INTERVAL_MS 10    // LightsModule::update(): countdown steps
+#define DISPLAY_UPDATE_INTERVAL_MS 16   // Race data pushes and DisplayManager::update(), one LVGL frame
+
+// Most input events handled per pass before race and display work get their turn
+#define INPUT_DRAIN_LIMIT 8
+
+// Display calls the race core can queue for the display core before new ones are dropped
+#define DISPLAY_DEFERRED_CALL_LIMIT 32
+
 // Explicit race modes for the system
 enum class RaceMode : uint8_t {
     LAPS = 1,
@@ -97,7 +118,6 @@ struct LaneData {
     uint8_t laneId;                 // Lane ID (0-7 for 8 lanes)
     bool isActive;                  // Whether this lane is active
     unsigned long startTime;        // Race start time for this lane
-    unsigned long lastTriggerTime;  // Last time a sensor was triggered (for debouncing)
     uint8_t lapCount;               // Number of completed laps
     LapData laps[MAX_LAPS];         // Array of lap data
 };
@@ -133,6 +153,7 @@ enum class ErrorCode {
     COMMUNICATION_ERROR = 7,    // Communication-related error
     RESOURCE_ERROR = 8,         // Resource allocation error
     NOT_IMPLEMENTED = 9,        // Feature not implemented
+    FILTERED = 10,              // Input dropped by a filter (e.g. sensor bounce)
     UNKNOWN_ERROR = 255         // Unknown error
 };
 
@@ -24,10 +24,22 @@
 // #include "DisplayModule/DisplayManager.h" // UI Removed
 // #include "DisplayModule/DisplayFactory.h" // UI Removed
 // #include "InputModule/drivers/SimulatorInputDriver/SDLInputHandler.h" // UI Removed
-#include <thread> // For std::this_thread::sleep_for
+#include <memory>
+#include <vector>
+#include "common/TimeManager.h"
+#include "DisplayModule/DisplayManager.h"
+#include "DisplayModule/WebDisplay.h"
+#include "RaceModule/RaceModule.h"
+#include "RaceModule/RaceJournalFile.h"
+#include "InputModule/InputManager.h"
+#include "InputModule/InputTrace.h"
+#include "InputModule/ReplayInput.h"
+#include "InputModule/drivers/SimulatorInputDriver/TerminalInput.h"
+#include "Sim/SimRaceController.h"
 #else
 // Production-specific includes
 #include <Arduino.h>
+#include "SystemController/SystemController.h"
 // Add any production-specific headers here
 // #include "DisplayModule/drivers/ESP32DisplayDriver.h"
 // #include "InputModule/drivers/ESP32InputDriver.h"
@@ -186,6 +198,125 @@ static void log_message(const char *format, ...)
 }
 
 #ifdef SIMULATOR
+// Race journal storage, enabled with --journal <path>
+static std::unique_ptr<RaceJournalFile> journalFile;
+
+// Restore the race from a journal file left by an earlier run, then keep persisting to it
+static void setupRaceJournal(const char *path)
+{
+    RaceSnapshot snapshot;
+    std::vector<RaceEvent> events;
+    if (RaceJournalFile::load(path, snapshot, events).isSuccess())
+    {
+        ErrorInfo result = raceModule.replayJournal(snapshot, events.data(), events.size());
+        if (result.isSuccess())
+        {
+            log_message("Recovered race from journal '%s' (%u events)", path, (unsigned)events.size());
+        }
+        else
+        {
+            log_message("ERROR: Failed to recover race from journal '%s': %s", path, result.message);
+        }
+    }
+    else
+    {
+        log_message("No race journal at '%s', starting fresh", path);
+    }
+
+    journalFile.reset(new RaceJournalFile(path));
+    journalFile->attach(raceModule.getJournal());
+}
+
+// Input capture and playback, enabled with --record <path> / --replay <path> [--speed realtime|max|<N>]
+static TerminalInput terminalInput;
+static InputTrace recordTrace;
+static InputTrace replayTrace;
+static std::unique_ptr<ReplayInput> replayInput; // Stays registered with InputManager until exit
+static bool replayReported = false;
+static const char *recordPath = nullptr;
+
+static bool parseReplaySpeed(const std::string &arg, ReplaySpeed &speed, uint32_t &multiplier)
+{
+    if (arg == "realtime")
+    {
+        speed = ReplaySpeed::RealTime;
+        return true;
+    }
+    if (arg == "max")
+    {
+        speed = ReplaySpeed::Maximum;
+        return true;
+    }
+    multiplier = (uint32_t)atoi(arg.c_str());
+    speed = ReplaySpeed::Accelerated;
+    return multiplier > 0;
+}
+
+// Queue a recorded trace ahead of terminal input; the race clock follows the trace while it plays
+static bool setupReplay(const char *path, ReplaySpeed speed, uint32_t multiplier)
+{
+    ErrorInfo result = replayTrace.loadFromFile(path);
+    if (!result.isSuccess())
+    {
+        log_message("ERROR: Failed to load input trace '%s': %s", path, result.message);
+        return false;
+    }
+
+    replayInput.reset(new ReplayInput(replayTrace));
+    InputManager::getInstance().addInputModule(replayInput.get());
+    replayInput->start(speed, multiplier);
+    log_message("Replaying %u input events from '%s'", (unsigned)replayTrace.size(), path);
+    return true;
+}
+
+// Binary race telemetry, enabled with --telemetry <path>
+static std::ofstream telemetryFile;
+
+static void setupTelemetry(const char *path)
+{
+    telemetryFile.open(path, std::ios::binary | std::ios::trunc);
+    if (!telemetryFile.is_open())
+    {
+        log_message("ERROR: Failed to open telemetry file '%s'", path);
+        return;
+    }
+    DisplayManager::getInstance().setTelemetrySink([](const uint8_t *frame, size_t length)
+    {
+        telemetryFile.write(reinterpret_cast<const char *>(frame), length);
+    });
+    log_message("Writing race telemetry to '%s'", path);
+}
+
+// Spectator race page, enabled with --web <port>; displays are set up before the other options are read
+static int findWebPort(int argc, char *argv[])
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "--web")
+        {
+            return atoi(argv[i + 1]);
+        }
+    }
+    return -1;
+}
+
+static void setupDisplays(int webPort)
+{
+    if (webPort >= 0)
+    {
+        WebDisplay *web = static_cast<WebDisplay *>(DisplayFactory::getInstance().getDisplay(DisplayType::Web));
+        web->setPort((uint16_t)webPort);
+        DisplayType displayTypes[] = {DisplayType::Web};
+        if (DisplayManager::getInstance().initialize(displayTypes, 1))
+        {
+            log_message("Race page at http://localhost:%u/", (unsigned)web->getPort());
+            return;
+        }
+        log_message("ERROR: Failed to start the web display on port %d", webPort);
+    }
+    DisplayManager::getInstance().initialize(nullptr, 0);
+}
+
 // Main function for simulator
 int main(int argc, char *argv[])
 {
@@ -205,7 +336,76 @@ int main(int argc, char *argv[])
     }
 
     log_message("Headless Simulator starting...");
+
+    // Race core without local displays; the terminal (and optionally the web page) is the front end
+    TimeManager::GetInstance().Initialize();
+    setupDisplays(findWebPort(argc, argv));
+    DisplayManager::getInstance().enableRenderThreads();
+    raceModule.initialize();
+    InputManager::getInstance().initialize();
+
+    const char *replayPath = nullptr;
+    ReplaySpeed replaySpeed = ReplaySpeed::RealTime;
+    uint32_t replayMultiplier = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--journal" && i + 1 < argc)
+        {
+            setupRaceJournal(argv[++i]);
+        }
+        else if (arg == "--record" && i + 1 < argc)
+        {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc)
+        {
+            replayPath = argv[++i];
+        }
+        else if (arg == "--speed" && i + 1 < argc && parseReplaySpeed(argv[i + 1], replaySpeed, replayMultiplier))
+        {
+            i++;
+        }
+        else if (arg == "--web" && i + 1 < argc)
+        {
+            i++; // Handled by setupDisplays()
+        }
+        else if (arg == "--telemetry" && i + 1 < argc)
+        {
+            setupTelemetry(argv[++i]);
+        }
+        else
+        {
+            log_message("Unknown argument: '%s'", argv[i]);
+        }
+    }
+
+    // Replayed events go first, so a trace is not interleaved with typed commands
+    if (replayPath != nullptr)
+    {
+        setupReplay(replayPath, replaySpeed, replayMultiplier);
+    }
+    else
+    {
+        // Typed commands wake the input task themselves; only a replay needs polling
+        SimRaceController::getInstance().setInputPollInterval(0);
+    }
+    InputManager::getInstance().addInputModule(&terminalInput);
+    if (recordPath != nullptr)
+    {
+        InputManager::getInstance().setRecorder(&recordTrace);
+        log_message("Recording input to '%s'", recordPath);
+    }
+
+    // A live session runs the race and display cores on their own threads, as
+    // the ESP32 runs them on its two cores; a replay is paced from this thread
+    if (replayInput == nullptr && SimRaceController::getInstance().startCores())
+    {
+        log_message("Race and display cores running on separate threads");
+    }
+
     Serial.println("Hello from Virtual Serial! This is the Headless Simulator.");
+    TerminalInput::printHelp();
     Serial.println("Type 'quit' to exit.");
 
     bool quit_flag = false;
@@ -221,15 +421,8 @@ int main(int argc, char *argv[])
             if (Serial.available() > 0)
             {
                 String incomingMessage = Serial.readLine();
-                // Trim leading/trailing whitespace from incomingMessage (std::string)
-                const std::string WHITESPACE_CHARS = " \n\r\t\f\v";
-                size_t start_pos = incomingMessage.find_first_not_of(WHITESPACE_CHARS);
-                if (std::string::npos == start_pos) { // String is all whitespace or empty
-                    incomingMessage.clear();
-                } else {
-                    size_t end_pos = incomingMessage.find_last_not_of(WHITESPACE_CHARS);
-                    incomingMessage = incomingMessage.substr(start_pos, end_pos - start_pos + 1);
-                }
+                // Trim leading/trailing whitespace from incomingMessage
+                incomingMessage.trim();
                 if (incomingMessage.length() > 0) {
                     log_message("Received command: '%s'", incomingMessage.c_str());
                     if (incomingMessage == "quit")
@@ -237,6 +430,10 @@ int main(int argc, char *argv[])
                         Serial.println("Quit command received. Exiting simulator...");
                         quit_flag = true;
                     }
+                    else if (terminalInput.pushLine(incomingMessage))
+                    {
+                        SimRaceController::getInstance().notifyInput();
+                    }
                     else
                     {
                         Serial.print("Echo: ");
@@ -245,6 +442,21 @@ int main(int argc, char *argv[])
                 }
             }
 
+            // With the cores on their own threads this loop only reads the terminal
+            uint32_t idleMs = TASK_SCHEDULER_MAX_SLEEP_MS;
+            if (!SimRaceController::getInstance().areCoresRunning())
+            {
+                idleMs = SimRaceController::getInstance().update();
+            }
+
+            if (replayInput && !replayReported && replayInput->isFinished() && !replayInput->isRunning())
+            {
+                log_message("Replay finished: %u events in %u ms",
+                            (unsigned)replayInput->getEventsReplayed(), (unsigned)replayInput->getWallTimeMs());
+                replayReported = true;
+                SimRaceController::getInstance().setInputPollInterval(0);
+            }
+
             // Periodically report that the simulator is still running
             unsigned long current_m = millis();
             if (current_m - last_report_time >= report_interval)
@@ -257,7 +469,17 @@ int main(int argc, char *argv[])
             // If ArduinoCompat or other systems create LVGL timers, this might be needed.
             // For a truly headless system with no LVGL UI or timers, this can be omitted.
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // Prevent high CPU usage
+            // Sleep until the next task is due or a key is typed, except while a
+            // trace replays as fast as possible. Task deadlines are on the race
+            // clock, which an accelerated replay runs faster than the wall clock.
+            if (!replayInput || !replayInput->isRunning() || replaySpeed != ReplaySpeed::Maximum)
+            {
+                if (replayInput && replayInput->isRunning() && replaySpeed == ReplaySpeed::Accelerated)
+                {
+                    idleMs /= replayMultiplier;
+                }
+                Serial.waitForInput(idleMs);
+            }
             loop_counter++;
         }
     }
@@ -270,12 +492,38 @@ int main(int argc, char *argv[])
         Serial.println("ERROR: Unknown exception in main loop.");
     }
 
+    SimRaceController::getInstance().stopCores();
+
+    if (recordPath != nullptr)
+    {
+        InputManager::getInstance().setRecorder(nullptr);
+        ErrorInfo result = recordTrace.saveToFile(recordPath);
+        if (result.isSuccess())
+        {
+            log_message("Saved %u input events to '%s'", (unsigned)recordTrace.size(), recordPath);
+        }
+        else
+        {
+            log_message("ERROR: Failed to save input trace '%s': %s", recordPath, result.message);
+        }
+    }
+
+    SimRaceController::getInstance().getRaceScheduler().printReport();
+    SimRaceController::getInstance().getDisplayScheduler().printReport();
+    log_message("Race data: %u snapshots published, %u drawn, handoff latency up to %u us",
+                (unsigned)DisplayManager::getInstance().getRaceDataPushCount(),
+                (unsigned)DisplayManager::getInstance().getRaceDataPresentCount(),
+                (unsigned)DisplayManager::getInstance().getMaxRaceDataLatencyUs());
+    DisplayManager::getInstance().disableRenderThreads();
     log_message("Exiting headless simulator main function.");
     // logFile is closed by exitHandler registered with atexit
     // SDLBackend::cleanup(); // UI Removed
     return 0;
 }
 #else
+// Set once SystemController runs the race and display cores as their own tasks
+static bool coresRunning = false;
+
 // Arduino setup function for production
 void setup()
 {
@@ -307,19 +555,25 @@ void setup()
     // Initialize UI
     // Example: showMainScreen();
 
+    // Race timing on core 0, LVGL and the displays on core 1
+    if (SystemController::getInstance().initialize())
+    {
+        coresRunning = SystemController::getInstance().startCores();
+    }
+
     Serial.println("Setup complete");
 }
 
 // Arduino loop function for production
 void loop()
 {
-    // Call LVGL task handler
-    lv_timer_handler();
-
-    // Production-specific loop code
-    // Example: processInputs();
+    // The race and display cores run the system; this task has nothing left to do
+    if (coresRunning)
+    {
+        vTaskDelete(nullptr);
+    }
 
-    // Small delay to prevent high CPU usage
-    delay(5);
+    // Without them, run both cores' tasks here; update() sleeps until the next is due
+    SystemController::getInstance().update();
 }
 #endif
@@ -0,0 +1,138 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the simulator's Arduino String (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <climits>
+#include <fstream>
+#include <utility>
+#include "common/ArduinoCompat.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+static size_t g_hookBytes = 0;
+
+static void countBytes(size_t bytes) {
+    g_hookBytes += bytes;
+}
+
+void setUp() {
+    g_hookBytes = 0;
+}
+
+void tearDown() {
+    String::setAllocationHook(nullptr);
+}
+
+// ===== Tests =====
+
+static void test_numbers_are_formatted_like_arduino() {
+    TEST_ASSERT_EQUAL_STRING("0", String(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("-42", String(-42).c_str());
+    TEST_ASSERT_EQUAL_STRING("4294967295", String(4294967295u).c_str());
+    TEST_ASSERT_EQUAL_STRING("-9223372036854775808", String(LLONG_MIN).c_str());
+    TEST_ASSERT_EQUAL_STRING("18446744073709551615", String(ULLONG_MAX).c_str());
+    TEST_ASSERT_EQUAL_STRING("1.50", String(1.5f).c_str());
+    TEST_ASSERT_EQUAL_STRING("3.142", String(3.14159, 3).c_str());
+
+    String text = "Lap ";
+    text += 7;
+    text += '/';
+    text += (uint8_t)10;
+    TEST_ASSERT_EQUAL_STRING("Lap 7/10", text.c_str());
+    TEST_ASSERT_EQUAL_STRING("Lane 3 of 4", ("Lane " + String(3) + " of " + 4).c_str());
+}
+
+static void test_short_text_stays_inline() {
+    uint32_t before = String::getAllocationCount();
+    String::setAllocationHook(countBytes);
+
+    String name = "Lane 1 - Speedy Gonzales";
+    name += " (best 00:04.321)";
+    String copy = name;
+    TEST_ASSERT_TRUE(copy.length() <= STRING_INLINE_CAPACITY);
+    TEST_ASSERT_EQUAL_UINT32(before, String::getAllocationCount());
+    TEST_ASSERT_EQUAL_UINT32(0, g_hookBytes);
+
+    // Past the inline buffer the text moves to the heap once
+    copy += copy;
+    TEST_ASSERT_EQUAL_UINT32(before + 1, String::getAllocationCount());
+    TEST_ASSERT_TRUE(g_hookBytes > STRING_INLINE_CAPACITY);
+    TEST_ASSERT_EQUAL_UINT32(name.length() * 2, copy.length());
+}
+
+static void test_operator_chain_allocates_at_most_once() {
+    uint32_t before = String::getAllocationCount();
+    String laneInfo = "Lane " + String(1) +
+                      " Lap: " + String(12) +
+                      "/" + String(20) +
+                      " Last: " + String(4321u) + "ms" +
+                      " Best: " + String(4000u) + "ms" +
+                      " Total: " + String(51234u) + "ms";
+    TEST_ASSERT_EQUAL_STRING("Lane 1 Lap: 12/20 Last: 4321ms Best: 4000ms Total: 51234ms", laneInfo.c_str());
+    TEST_ASSERT_EQUAL_UINT32(before + 1, String::getAllocationCount());
+
+    // Reserving first makes the appends free
+    before = String::getAllocationCount();
+    String reserved;
+    reserved.reserve(96);
+    for (int i = 0; i < 20; i++) {
+        reserved += i;
+        reserved += ' ';
+    }
+    TEST_ASSERT_EQUAL_UINT32(before + 1, String::getAllocationCount());
+}
+
+static void test_moves_take_the_buffer() {
+    String longText;
+    longText.append(100, 'x');
+    const char* buffer = longText.c_str();
+
+    String moved = std::move(longText);
+    TEST_ASSERT_TRUE(moved.c_str() == buffer);
+    TEST_ASSERT_TRUE(longText.isEmpty());
+
+    String shortText = "short";
+    String movedShort = std::move(shortText);
+    TEST_ASSERT_EQUAL_STRING("short", movedShort.c_str());
+    TEST_ASSERT_TRUE(shortText.isEmpty());
+
+    // Appending a string to itself across the growth
+    moved = "abcdefghijklmnopqrstuvwxyz0123456789";
+    moved += moved;
+    TEST_ASSERT_EQUAL_UINT32(72, moved.length());
+    TEST_ASSERT_EQUAL_STRING("abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789", moved.c_str());
+}
+
+static void test_search_and_std_string_interop() {
+    String text = "  race laps 10 \r\n";
+    text.trim();
+    TEST_ASSERT_EQUAL_STRING("race laps 10", text.c_str());
+    TEST_ASSERT_EQUAL_INT(5, text.indexOf("laps"));
+    TEST_ASSERT_EQUAL_INT(-1, text.indexOf('x'));
+    TEST_ASSERT_EQUAL_STRING("laps", text.substring(5, 9).c_str());
+    TEST_ASSERT_EQUAL_STRING("10", text.substr(10).c_str());
+    TEST_ASSERT_EQUAL_INT(10, text.substr(10).toInt());
+    TEST_ASSERT_TRUE(text.startsWith("race"));
+    TEST_ASSERT_TRUE(text == "race laps 10");
+    TEST_ASSERT_TRUE(String("a") < String("b"));
+
+    std::string standard = text;
+    TEST_ASSERT_EQUAL_STRING("race laps 10", standard.c_str());
+    String back = standard + String("!");
+    TEST_ASSERT_EQUAL_STRING("race laps 10!", back.c_str());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_numbers_are_formatted_like_arduino);
+    RUN_TEST(test_short_text_stays_inline);
+    RUN_TEST(test_operator_chain_allocates_at_most_once);
+    RUN_TEST(test_moves_take_the_buffer);
+    RUN_TEST(test_search_and_std_string_interop);
+    return UNITY_END();
+}
@@ -0,0 +1,232 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the digit atlas and TimeLabel (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <lvgl.h>
+#include <fstream>
+#include <string.h>
+#include "common/ArduinoCompat.h"
+#include "DisplayModule/lvgl/widgets/DigitAtlas.h"
+#include "DisplayModule/lvgl/widgets/TimeLabel.h"
+#include "DisplayModule/lvgl/screens/RaceScreen.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Offscreen LVGL display, flushed into a frame buffer =====
+
+#define TEST_HOR_RES 320
+#define TEST_VER_RES 120
+
+static lv_color_t frameBuffer[TEST_HOR_RES * TEST_VER_RES];
+static lv_obj_t* homeScreen = nullptr;
+
+static void testFlush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p) {
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        for (lv_coord_t x = area->x1; x <= area->x2; x++) {
+            frameBuffer[y * TEST_HOR_RES + x] = *color_p++;
+        }
+    }
+    lv_disp_flush_ready(disp);
+}
+
+static void initOffscreenDisplay() {
+    static lv_disp_draw_buf_t drawBuf;
+    static lv_color_t buf[TEST_HOR_RES * 20];
+    static lv_disp_drv_t dispDrv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&drawBuf, buf, nullptr, TEST_HOR_RES * 20);
+    lv_disp_drv_init(&dispDrv);
+    dispDrv.hor_res = TEST_HOR_RES;
+    dispDrv.ver_res = TEST_VER_RES;
+    dispDrv.flush_cb = testFlush;
+    dispDrv.draw_buf = &drawBuf;
+    lv_disp_drv_register(&dispDrv);
+}
+
+// A fresh screen with a background of the given opacity, fully redrawn
+static lv_obj_t* createScreen(lv_opa_t bgOpa) {
+    lv_obj_t* screen = lv_obj_create(nullptr);
+    lv_obj_remove_style_all(screen);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(0x202020), 0);
+    lv_obj_set_style_bg_opa(screen, bgOpa, 0);
+    lv_scr_load(screen);
+    return screen;
+}
+
+// Deleting the active screen would leave the display without one
+static void closeScreen(lv_obj_t* screen) {
+    lv_scr_load(homeScreen);
+    lv_obj_del(screen);
+}
+
+static void render() {
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(nullptr);
+}
+
+// Total brightness of the frame: the ink of the text on the background
+static uint32_t frameBrightness() {
+    uint32_t sum = 0;
+    for (const lv_color_t& color : frameBuffer) {
+        sum += lv_color_brightness(color);
+    }
+    return sum;
+}
+
+static void styleText(lv_obj_t* obj) {
+    lv_obj_set_style_text_font(obj, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_text_color(obj, lv_color_white(), 0);
+    lv_obj_set_pos(obj, 10, 10);
+}
+
+// Brightness of a text drawn by lv_label and by TimeLabel on the same background
+static void renderBoth(const char* text, lv_opa_t bgOpa, uint32_t* labelBrightness, uint32_t* timeBrightness) {
+    lv_obj_t* screen = createScreen(bgOpa);
+    lv_obj_t* label = lv_label_create(screen);
+    styleText(label);
+    lv_label_set_text(label, text);
+    render();
+    *labelBrightness = frameBrightness();
+    lv_obj_del(label);
+
+    TimeLabel timeLabel;
+    styleText(timeLabel.Create(screen));
+    timeLabel.SetText(text);
+    render();
+    *timeBrightness = frameBrightness();
+    closeScreen(screen);
+}
+
+static bool closeTo(uint32_t expected, uint32_t actual) {
+    uint32_t diff = expected > actual ? expected - actual : actual - expected;
+    return diff * 100 <= expected;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_atlas_digits_are_tabular() {
+    DigitAtlas* atlas = DigitAtlas::Get(&lv_font_montserrat_24);
+    TEST_ASSERT_NOT_NULL(atlas);
+    TEST_ASSERT_TRUE(DigitAtlas::Get(&lv_font_montserrat_24) == atlas);
+    TEST_ASSERT_EQUAL_INT(lv_font_get_line_height(&lv_font_montserrat_24), atlas->GetLineHeight());
+
+    // Every digit is as wide as the widest one, so a running time keeps its width
+    lv_coord_t digit = atlas->GetTextWidth("0");
+    TEST_ASSERT_TRUE(digit >= lv_font_get_glyph_width(&lv_font_montserrat_24, '1', 0));
+    for (char c = '1'; c <= '9'; c++) {
+        char text[2] = {c, '\0'};
+        TEST_ASSERT_EQUAL_INT(digit, atlas->GetTextWidth(text));
+    }
+    TEST_ASSERT_EQUAL_INT(atlas->GetTextWidth("00:00.000"), atlas->GetTextWidth("19:47.381"));
+
+    TEST_ASSERT_TRUE(DigitAtlas::Supports("--:--.---"));
+    TEST_ASSERT_FALSE(DigitAtlas::Supports("GO!"));
+    TEST_ASSERT_FALSE(DigitAtlas::Supports("3/10"));
+}
+
+static void test_opaque_background_matches_lv_label() {
+    uint32_t labelBrightness = 0;
+    uint32_t timeBrightness = 0;
+    renderBoth("00:00.000", LV_OPA_COVER, &labelBrightness, &timeBrightness);
+    TEST_ASSERT_TRUE(timeBrightness > 0);
+    TEST_ASSERT_TRUE(closeTo(labelBrightness, timeBrightness));
+}
+
+static void test_translucent_background_matches_lv_label() {
+    uint32_t labelBrightness = 0;
+    uint32_t timeBrightness = 0;
+    renderBoth("88:88.888", LV_OPA_30, &labelBrightness, &timeBrightness);
+    TEST_ASSERT_TRUE(timeBrightness > 0);
+    TEST_ASSERT_TRUE(closeTo(labelBrightness, timeBrightness));
+}
+
+static void test_other_text_falls_back_to_lv_label() {
+    uint32_t labelBrightness = 0;
+    uint32_t timeBrightness = 0;
+    renderBoth("GO!", LV_OPA_COVER, &labelBrightness, &timeBrightness);
+    TEST_ASSERT_TRUE(timeBrightness > 0);
+    TEST_ASSERT_EQUAL_UINT32(labelBrightness, timeBrightness);
+}
+
+static void test_time_label_invalidates_only_on_change() {
+    lv_obj_t* screen = createScreen(LV_OPA_COVER);
+    TimeLabel timeLabel;
+    styleText(timeLabel.Create(screen));
+    timeLabel.SetTime(83456);
+    TEST_ASSERT_EQUAL_STRING("01:23.456", timeLabel.GetText());
+    lv_refr_now(nullptr);
+
+    lv_disp_t* disp = lv_disp_get_default();
+    timeLabel.SetTime(83456);
+    TEST_ASSERT_EQUAL_INT(0, disp->inv_p);
+
+    lv_coord_t width = lv_obj_get_width(timeLabel.GetObj());
+    timeLabel.SetTime(83457);
+    TEST_ASSERT_TRUE(disp->inv_p > 0);
+    lv_refr_now(nullptr);
+    TEST_ASSERT_EQUAL_INT(width, lv_obj_get_width(timeLabel.GetObj()));
+
+    // Deleting the object with its parent leaves the label harmless
+    closeScreen(screen);
+    TEST_ASSERT_NULL(timeLabel.GetObj());
+    timeLabel.SetText("00:00.000");
+}
+
+static void test_timer_ui_time_columns_use_time_labels() {
+    lv_obj_t* screen = createScreen(LV_OPA_COVER);
+    TimerRaceUI timerUI(2);
+    timerUI.CreateUI(screen);
+
+    std::vector<RaceLaneData> lanes(1);
+    lanes[0].laneId = 1;
+    lanes[0].enabled = true;
+    lanes[0].currentLap = 3;
+    lanes[0].totalLaps = 0;
+    lanes[0].position = 1;
+    lanes[0].lastLapTime = 4321;
+    lanes[0].bestLapTime = 4000;
+    lanes[0].totalTime = 65000;
+    RaceModeUI& raceUI = timerUI;
+    raceUI.UpdateRaceData(lanes);
+    lv_refr_now(nullptr);
+
+    // Container > table > rows (header first) > cells > label
+    lv_obj_t* table = lv_obj_get_child(raceUI.GetContainer(), 0);
+    lv_obj_t* row = lv_obj_get_child(table, 1);
+    const char* expected[] = {"00:04.321", "00:04.000", "01:05"};
+    for (int i = 0; i < 3; i++) {
+        lv_obj_t* obj = lv_obj_get_child(lv_obj_get_child(row, 3 + i), 0);
+        TimeLabel* timeLabel = static_cast<TimeLabel*>(lv_obj_get_user_data(obj));
+        TEST_ASSERT_NOT_NULL(timeLabel);
+        TEST_ASSERT_EQUAL_STRING(expected[i], timeLabel->GetText());
+    }
+    TEST_ASSERT_EQUAL_STRING("3/0", lv_label_get_text(lv_obj_get_child(lv_obj_get_child(row, 2), 0)));
+
+    timerUI.Cleanup();
+    closeScreen(screen);
+}
+
+int main() {
+    initOffscreenDisplay();
+    homeScreen = lv_scr_act();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_atlas_digits_are_tabular);
+    RUN_TEST(test_opaque_background_matches_lv_label);
+    RUN_TEST(test_translucent_background_matches_lv_label);
+    RUN_TEST(test_other_text_falls_back_to_lv_label);
+    RUN_TEST(test_time_label_invalidates_only_on_change);
+    RUN_TEST(test_timer_ui_time_columns_use_time_labels);
+    DigitAtlas::ClearCache();
+    return UNITY_END();
+}
@@ -0,0 +1,121 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the coalesced race data push in DisplayManager (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <fstream>
+#include "common/ArduinoCompat.h"
+#include "common/TimeManager.h"
+#include "RaceModule/RaceModule.h"
+#include "DisplayModule/DisplayManager.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Helpers =====
+
+static uint32_t clockMs = 0;
+
+static void setClock(uint32_t ms) {
+    clockMs = ms;
+    TimeManager::GetInstance().SetReplayTime(ms);
+}
+
+// Flush and report how many pushes it made (0 or 1)
+static uint32_t flush() {
+    DisplayManager& display = DisplayManager::getInstance();
+    uint32_t before = display.getRaceDataPushCount();
+    display.flushRaceData();
+    return display.getRaceDataPushCount() - before;
+}
+
+void setUp() {
+    DisplayManager& display = DisplayManager::getInstance();
+    display.setRaceDataFrameRate(DEFAULT_DISPLAY_FRAME_RATE);
+
+    RaceModule& race = RaceModule::getInstance();
+    race.resetRace();
+    race.prepareRace(RaceMode::LAPS, 4, 10, 0);
+    race.startCountdown();
+    race.startRace();
+
+    // Start every test right after a push, with nothing pending
+    setClock(clockMs + 1000);
+    display.markRaceDataDirty();
+    flush();
+}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_nothing_pushed_without_changes() {
+    setClock(clockMs + 1000);
+    TEST_ASSERT_EQUAL_UINT32(0, flush());
+}
+
+static void test_lap_burst_is_one_push() {
+    setClock(clockMs + DISPLAY_URGENT_MIN_INTERVAL_MS);
+    RaceModule& race = RaceModule::getInstance();
+    for (int lane = 1; lane <= 4; lane++) {
+        TEST_ASSERT_TRUE(race.registerLap(lane).isSuccess());
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, flush());
+    TEST_ASSERT_EQUAL_UINT32(0, flush());
+}
+
+static void test_routine_changes_wait_for_next_frame() {
+    uint32_t frameMs = 1000 / DEFAULT_DISPLAY_FRAME_RATE;
+    DisplayManager& display = DisplayManager::getInstance();
+
+    setClock(clockMs + frameMs / 2);
+    display.markRaceDataDirty();
+    display.markRaceDataDirty();
+    TEST_ASSERT_EQUAL_UINT32(0, flush());
+
+    setClock(clockMs + frameMs / 2);
+    TEST_ASSERT_EQUAL_UINT32(1, flush());
+}
+
+static void test_lap_skips_frame_wait() {
+    DisplayManager& display = DisplayManager::getInstance();
+
+    // Within one LCD refresh of the last push even a lap waits
+    setClock(clockMs + DISPLAY_URGENT_MIN_INTERVAL_MS / 2);
+    TEST_ASSERT_TRUE(RaceModule::getInstance().registerLap(1).isSuccess());
+    TEST_ASSERT_EQUAL_UINT32(0, flush());
+
+    setClock(clockMs + DISPLAY_URGENT_MIN_INTERVAL_MS);
+    TEST_ASSERT_EQUAL_UINT32(1, flush());
+
+    // A routine change right after still waits for the frame
+    display.markRaceDataDirty();
+    setClock(clockMs + DISPLAY_URGENT_MIN_INTERVAL_MS);
+    TEST_ASSERT_EQUAL_UINT32(0, flush());
+}
+
+static void test_frame_rate_is_configurable() {
+    DisplayManager& display = DisplayManager::getInstance();
+    display.setRaceDataFrameRate(50);
+
+    setClock(clockMs + 20);
+    display.markRaceDataDirty();
+    TEST_ASSERT_EQUAL_UINT32(1, flush());
+}
+
+int main() {
+    TimeManager::GetInstance().Initialize();
+    DisplayManager::getInstance().initialize(nullptr, 0);
+    RaceModule::getInstance().initialize();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_nothing_pushed_without_changes);
+    RUN_TEST(test_lap_burst_is_one_push);
+    RUN_TEST(test_routine_changes_wait_for_next_frame);
+    RUN_TEST(test_lap_skips_frame_wait);
+    RUN_TEST(test_frame_rate_is_configurable);
+    return UNITY_END();
+}
@@ -0,0 +1,189 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the race core / display core split (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <atomic>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include "common/ArduinoCompat.h"
+#include "common/CoreLoop.h"
+#include "common/SnapshotBuffer.h"
+#include "common/TimeManager.h"
+#include "Sim/SimRaceController.h"
+#include "InputModule/InputManager.h"
+#include "InputModule/drivers/SimulatorInputDriver/TerminalInput.h"
+#include "RaceModule/RaceModule.h"
+#include "DisplayModule/DisplayManager.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Helpers =====
+
+// Wait up to timeoutMs for condition, checking every millisecond
+template<typename Condition>
+static bool waitFor(Condition condition, uint32_t timeoutMs) {
+    uint32_t start = millis();
+    while (!condition()) {
+        if (millis() - start > timeoutMs) {
+            return false;
+        }
+        delay(1);
+    }
+    return true;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_snapshot_buffer_hands_over_the_newest_value() {
+    SnapshotBuffer<int> buffer;
+    TEST_ASSERT_FALSE(buffer.hasNew());
+    TEST_ASSERT_NULL(buffer.takeLatest());
+
+    buffer.beginWrite() = 1;
+    buffer.publish();
+    TEST_ASSERT_TRUE(buffer.hasNew());
+    const int* value = buffer.takeLatest();
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_INT(1, *value);
+    TEST_ASSERT_NULL(buffer.takeLatest());
+
+    // Values the reader did not take are replaced; the one it holds is left alone
+    for (int i = 2; i <= 5; i++) {
+        buffer.beginWrite() = i;
+        buffer.publish();
+        TEST_ASSERT_EQUAL_INT(1, *value);
+    }
+    value = buffer.takeLatest();
+    TEST_ASSERT_EQUAL_INT(5, *value);
+    TEST_ASSERT_EQUAL_UINT32(5, buffer.getPublishedCount());
+    TEST_ASSERT_EQUAL_UINT32(2, buffer.getTakenCount());
+}
+
+static void test_snapshot_buffer_across_threads() {
+    const int frames = 20000;
+    SnapshotBuffer<std::vector<int>> buffer;
+    std::atomic<bool> done(false);
+
+    // Every element of a frame holds its number; a torn frame would mix two
+    std::thread writer([&]() {
+        for (int frame = 1; frame <= frames; frame++) {
+            buffer.beginWrite().assign(MAX_LANES, frame);
+            buffer.publish();
+        }
+        done = true;
+    });
+
+    int last = 0;
+    bool consistent = true;
+    bool ordered = true;
+    while (!done || buffer.hasNew()) {
+        const std::vector<int>* values = buffer.takeLatest();
+        if (values == nullptr) {
+            continue;
+        }
+        int frame = (*values)[0];
+        for (int value : *values) {
+            consistent = consistent && value == frame;
+        }
+        ordered = ordered && frame > last;
+        last = frame;
+    }
+    writer.join();
+
+    TEST_ASSERT_TRUE(consistent);
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_EQUAL_INT(frames, last);
+    TEST_ASSERT_EQUAL_UINT32(frames, buffer.getPublishedCount());
+}
+
+static void test_core_loop_sleeps_until_woken() {
+    CoreLoop loop("test", DISPLAY_CORE);
+    std::atomic<bool> onLoopThread(false);
+    TEST_ASSERT_FALSE(loop.start(CoreLoop::Pass()));
+
+    TEST_ASSERT_TRUE(loop.start([&]() {
+        onLoopThread = loop.isCurrentThread();
+        return (uint32_t)TASK_SCHEDULER_MAX_SLEEP_MS;
+    }));
+    TEST_ASSERT_FALSE(loop.start([]() { return 0u; }));
+    TEST_ASSERT_TRUE(waitFor([&]() { return loop.getPassCount() == 1; }, 500));
+    TEST_ASSERT_TRUE(onLoopThread);
+    TEST_ASSERT_FALSE(loop.isCurrentThread());
+
+    // A wake runs the next pass well before the sleep is over
+    loop.wake();
+    TEST_ASSERT_TRUE(waitFor([&]() { return loop.getPassCount() == 2; }, 200));
+
+    loop.stop();
+    TEST_ASSERT_FALSE(loop.isRunning());
+    TEST_ASSERT_EQUAL_UINT32(2, loop.getPassCount());
+}
+
+static void test_sim_cores_hand_race_data_to_the_display_thread() {
+    static TerminalInput terminal;
+    TimeManager::GetInstance().ClearReplayTime();
+    DisplayManager& display = DisplayManager::getInstance();
+    display.initialize(nullptr, 0);
+    RaceModule& race = RaceModule::getInstance();
+    race.initialize();
+    InputManager::getInstance().initialize();
+    InputManager::getInstance().addInputModule(&terminal);
+
+    SimRaceController& controller = SimRaceController::getInstance();
+    controller.setInputPollInterval(0);
+    TEST_ASSERT_TRUE(controller.startCores());
+    TEST_ASSERT_FALSE(controller.startCores());
+    TEST_ASSERT_TRUE(controller.areCoresRunning());
+
+    // Commands typed on this thread are run by the race thread
+    uint32_t presented = display.getRaceDataPresentCount();
+    terminal.pushLine("s");
+    terminal.pushLine("g");
+    terminal.pushLine("1");
+    terminal.pushLine("2");
+    controller.notifyInput();
+    TEST_ASSERT_TRUE(waitFor([&]() { return display.getRaceDataPresentCount() > presented; }, 1000));
+
+    // A screen change from this thread is queued for the display thread
+    display.setScreen(ScreenType::Stats);
+    TEST_ASSERT_TRUE(waitFor([&]() { return display.getCurrentScreen() == ScreenType::Stats; }, 1000));
+
+    controller.stopCores();
+    TEST_ASSERT_FALSE(controller.areCoresRunning());
+
+    TEST_ASSERT_EQUAL_INT(1, race.getLaneData(1).currentLap);
+    TEST_ASSERT_EQUAL_INT(1, race.getLaneData(2).currentLap);
+    TEST_ASSERT_TRUE(controller.getRaceCore().getPassCount() > 0);
+    TEST_ASSERT_TRUE(controller.getDisplayCore().getPassCount() > 0);
+    TEST_ASSERT_TRUE(controller.getDisplayScheduler().findTaskStats("display")->runs > 0);
+    TEST_ASSERT_NULL(controller.getDisplayScheduler().findTaskStats("race"));
+    TEST_ASSERT_NULL(controller.getRaceScheduler().findTaskStats("display"));
+
+    // Publishing wakes the display thread instead of waiting for its next frame
+    TEST_ASSERT_TRUE(display.getRaceDataPushCount() >= display.getRaceDataPresentCount());
+    TEST_ASSERT_TRUE(display.getMaxRaceDataLatencyUs() < 50000);
+    TEST_ASSERT_EQUAL_UINT32(0, display.getDroppedDisplayCalls());
+
+    // Stopped, display calls run directly again
+    display.setScreen(ScreenType::Main);
+    TEST_ASSERT_TRUE(display.getCurrentScreen() == ScreenType::Main);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_snapshot_buffer_hands_over_the_newest_value);
+    RUN_TEST(test_snapshot_buffer_across_threads);
+    RUN_TEST(test_core_loop_sleeps_until_woken);
+    RUN_TEST(test_sim_cores_hand_race_data_to_the_display_thread);
+    return UNITY_END();
+}
@@ -0,0 +1,93 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for FixedString and the time formatter (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <fstream>
+#include "common/ArduinoCompat.h"
+#include "common/FixedString.h"
+#include "common/TimeManager.h"
+#include "RaceModule/RaceModule.h"
+#include "DisplayModule/DisplayManager.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+void setUp() {}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_times_are_formatted_without_printf() {
+    TEST_ASSERT_EQUAL_STRING("00:00.000", formatTimeMMSSmmm(0).c_str());
+    TEST_ASSERT_EQUAL_STRING("00:04.321", formatTimeMMSSmmm(4321).c_str());
+    TEST_ASSERT_EQUAL_STRING("01:05.007", formatTimeMMSSmmm(65007).c_str());
+    TEST_ASSERT_EQUAL_STRING("59:59.999", formatTimeMMSSmmm(3599999).c_str());
+
+    // Minutes keep counting past the hour
+    TEST_ASSERT_EQUAL_STRING("61:01.000", formatTimeMMSSmmm(3661000).c_str());
+    TEST_ASSERT_EQUAL_STRING("71582:47.295", formatTimeMMSSmmm(UINT32_MAX).c_str());
+
+    TEST_ASSERT_EQUAL_STRING("00:00", formatTimeMMSS(999).c_str());
+    TEST_ASSERT_EQUAL_STRING("02:03", formatTimeMMSS(123456).c_str());
+}
+
+static void test_numbers_and_padding() {
+    FixedString<32> text;
+    text.appendInt(-42).append(' ').appendUnsigned(7, 3).append(' ').appendUnsigned(4294967295u);
+    TEST_ASSERT_EQUAL_STRING("-42 007 4294967295", text.c_str());
+
+    text.clear();
+    text.appendInt(INT32_MIN);
+    TEST_ASSERT_EQUAL_STRING("-2147483648", text.c_str());
+
+    text.clear();
+    text += "Lap ";
+    text += (int32_t)3;
+    text += '/';
+    text += (uint32_t)10;
+    TEST_ASSERT_TRUE(text == "Lap 3/10");
+    TEST_ASSERT_EQUAL_UINT32(8, text.length());
+}
+
+static void test_overflow_truncates() {
+    FixedString<8> text("Lane");
+    TEST_ASSERT_FALSE(text.isTruncated());
+    text.append(" 12345");
+    TEST_ASSERT_TRUE(text.isTruncated());
+    TEST_ASSERT_EQUAL_STRING("Lane 12", text.c_str());
+    TEST_ASSERT_EQUAL_UINT32(text.capacity(), text.length());
+
+    text.appendUnsigned(99);
+    TEST_ASSERT_EQUAL_STRING("Lane 12", text.c_str());
+
+    text.clear();
+    TEST_ASSERT_TRUE(text.isEmpty());
+    TEST_ASSERT_FALSE(text.isTruncated());
+}
+
+static void test_race_status_fits_all_lanes() {
+    TimeManager::GetInstance().SetReplayTime(1000);
+    RaceModule& race = RaceModule::getInstance();
+    race.initialize();
+    race.resetRace();
+    race.prepareRace(RaceMode::LAPS, MAX_LANES, 10, 0);
+
+    RaceStatusText status = DisplayManager::getInstance().formatRaceStatus(race, true);
+    TEST_ASSERT_FALSE(status.isTruncated());
+    TEST_ASSERT_TRUE(strstr(status.c_str(), "Mode: LAPS | State: PAUSED\n") == status.c_str());
+    TEST_ASSERT_NOT_NULL(strstr(status.c_str(), "Lane 8: 0/10 laps\n"));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_times_are_formatted_without_printf);
+    RUN_TEST(test_numbers_and_padding);
+    RUN_TEST(test_overflow_truncates);
+    RUN_TEST(test_race_status_fits_all_lanes);
+    return UNITY_END();
+}
@@ -0,0 +1,187 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the LVGL pool allocator (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <lvgl.h>
+#include <fstream>
+#include <vector>
+#include "common/ArduinoCompat.h"
+#include "DisplayModule/lvgl/utils/LvglMemory.h"
+#include "DisplayModule/lvgl/screens/RaceScreen.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Offscreen LVGL display =====
+
+#define TEST_HOR_RES 800
+#define TEST_VER_RES 480
+
+static void testFlush(lv_disp_drv_t* disp, const lv_area_t* /*area*/, lv_color_t* /*color_p*/) {
+    lv_disp_flush_ready(disp);
+}
+
+static void initOffscreenDisplay() {
+    static lv_disp_draw_buf_t drawBuf;
+    static lv_color_t buf[TEST_HOR_RES * 20];
+    static lv_disp_drv_t dispDrv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&drawBuf, buf, nullptr, TEST_HOR_RES * 20);
+    lv_disp_drv_init(&dispDrv);
+    dispDrv.hor_res = TEST_HOR_RES;
+    dispDrv.ver_res = TEST_VER_RES;
+    dispDrv.flush_cb = testFlush;
+    dispDrv.draw_buf = &drawBuf;
+    lv_disp_drv_register(&dispDrv);
+}
+
+void setUp() {
+    LvglMemory::getInstance().resetScreenStats();
+}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_small_blocks_come_from_the_pools() {
+    LvglMemory& memory = LvglMemory::getInstance();
+    size_t bytesBefore = memory.getBytesInUse();
+    size_t heapBefore = memory.getLargeBytesInUse();
+    uint16_t inUseBefore = memory.getPoolStats(1).inUse;
+
+    void* a = memory.allocate(20);
+    void* b = memory.allocate(32);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_NOT_NULL(b);
+    TEST_ASSERT_EQUAL_UINT32(inUseBefore + 2, memory.getPoolStats(1).inUse);
+    TEST_ASSERT_EQUAL_UINT32(bytesBefore + 52, memory.getBytesInUse());
+    TEST_ASSERT_EQUAL_UINT32(heapBefore, memory.getLargeBytesInUse());
+    TEST_ASSERT_TRUE(memory.getSlackBytes() >= 12);
+
+    // Growing within the size class keeps the block and its contents
+    memset(a, 0x5A, 20);
+    TEST_ASSERT_TRUE(memory.reallocate(a, 30) == a);
+    TEST_ASSERT_EQUAL_UINT8(0x5A, ((uint8_t*)a)[19]);
+
+    memory.release(a);
+    memory.release(b);
+    TEST_ASSERT_EQUAL_UINT32(inUseBefore, memory.getPoolStats(1).inUse);
+    TEST_ASSERT_EQUAL_UINT32(bytesBefore, memory.getBytesInUse());
+
+    // The freed block is the next one handed out
+    TEST_ASSERT_TRUE(memory.allocate(17) == b);
+    memory.release(b);
+}
+
+static void test_large_blocks_and_growth_move_to_the_heap() {
+    LvglMemory& memory = LvglMemory::getInstance();
+    size_t heapBefore = memory.getLargeBytesInUse();
+
+    uint8_t* text = (uint8_t*)memory.allocate(100);
+    for (int i = 0; i < 100; i++) {
+        text[i] = (uint8_t)i;
+    }
+    uint8_t* grown = (uint8_t*)memory.reallocate(text, LVGL_POOL_MAX_BLOCK + 1000);
+    TEST_ASSERT_NOT_NULL(grown);
+    TEST_ASSERT_TRUE(grown != text);
+    TEST_ASSERT_EQUAL_UINT8(99, grown[99]);
+    TEST_ASSERT_EQUAL_UINT32(heapBefore + LVGL_POOL_MAX_BLOCK + 1000, memory.getLargeBytesInUse());
+    TEST_ASSERT_TRUE(memory.getLargeHighWaterBytes() >= memory.getLargeBytesInUse());
+
+    memory.release(grown);
+    TEST_ASSERT_EQUAL_UINT32(heapBefore, memory.getLargeBytesInUse());
+}
+
+static void test_full_pool_spills_to_the_heap() {
+    LvglMemory& memory = LvglMemory::getInstance();
+    const int poolIndex = LVGL_POOL_CLASSES - 1;
+    const LvglPoolStats& pool = memory.getPoolStats(poolIndex);
+    uint32_t overflowsBefore = pool.overflows;
+    size_t heapBefore = memory.getLargeBytesInUse();
+
+    memory.beginScreen("Spill");
+    std::vector<void*> blocks;
+    int freeBlocks = pool.blockCount - pool.inUse;
+    for (int i = 0; i < freeBlocks + 2; i++) {
+        blocks.push_back(memory.allocate(LVGL_POOL_MAX_BLOCK));
+    }
+    TEST_ASSERT_EQUAL_UINT32(pool.blockCount, pool.highWater);
+    TEST_ASSERT_EQUAL_UINT32(overflowsBefore + 2, pool.overflows);
+    TEST_ASSERT_EQUAL_UINT32(heapBefore + 2 * LVGL_POOL_MAX_BLOCK, memory.getLargeBytesInUse());
+
+    const LvglScreenMemoryStats* spill = memory.findScreenStats("Spill");
+    TEST_ASSERT_NOT_NULL(spill);
+    TEST_ASSERT_EQUAL_UINT32(freeBlocks + 2, spill->allocations);
+    TEST_ASSERT_EQUAL_UINT32(2, spill->overflows);
+
+    for (void* block : blocks) {
+        memory.release(block);
+    }
+    TEST_ASSERT_EQUAL_UINT32(heapBefore, memory.getLargeBytesInUse());
+    TEST_ASSERT_EQUAL_UINT32(pool.blockCount - freeBlocks, pool.inUse);
+}
+
+static void test_screen_rebuilds_do_not_grow_memory() {
+    LvglMemory& memory = LvglMemory::getInstance();
+    memory.beginScreen("Race");
+    LapsRaceUI lapsUI(MAX_LANES);
+    lapsUI.CreateUI(lv_scr_act());
+    size_t built = memory.getBytesInUse();
+
+    // Rebuilding the table returns every block it took
+    for (int i = 0; i < 20; i++) {
+        lapsUI.Cleanup();
+        lapsUI.CreateUI(lv_scr_act());
+        TEST_ASSERT_EQUAL_UINT32(built, memory.getBytesInUse());
+    }
+
+    const LvglScreenMemoryStats* race = memory.findScreenStats("Race");
+    TEST_ASSERT_NOT_NULL(race);
+    TEST_ASSERT_EQUAL_UINT32(1, race->activations);
+    TEST_ASSERT_TRUE(race->allocations > 20);
+    TEST_ASSERT_TRUE(race->peakBytes >= built);
+    TEST_ASSERT_EQUAL_UINT32(0, memory.getFailedAllocations());
+    lapsUI.Cleanup();
+}
+
+static void test_screens_are_recorded_separately() {
+    LvglMemory& memory = LvglMemory::getInstance();
+    memory.beginScreen("Config");
+    lv_obj_t* screen = lv_obj_create(nullptr);
+    for (int i = 0; i < 10; i++) {
+        lv_label_set_text(lv_label_create(screen), "Lane 1");
+    }
+    size_t configPeak = memory.getBytesInUse();
+
+    memory.beginScreen("Stats");
+    lv_obj_del(screen);
+    memory.beginScreen("Stats");     // Already current: no new activation
+    memory.beginScreen("Config");
+
+    TEST_ASSERT_EQUAL_UINT32(2, memory.getScreenCount());
+    const LvglScreenMemoryStats* config = memory.findScreenStats("Config");
+    const LvglScreenMemoryStats* stats = memory.findScreenStats("Stats");
+    TEST_ASSERT_EQUAL_UINT32(2, config->activations);
+    TEST_ASSERT_EQUAL_UINT32(1, stats->activations);
+    TEST_ASSERT_TRUE(config->peakBytes >= configPeak);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->allocations);
+    TEST_ASSERT_TRUE(config->peakBytes > memory.getBytesInUse());
+    TEST_ASSERT_NULL(memory.findScreenStats("Pause"));
+}
+
+int main() {
+    initOffscreenDisplay();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_small_blocks_come_from_the_pools);
+    RUN_TEST(test_large_blocks_and_growth_move_to_the_heap);
+    RUN_TEST(test_full_pool_spills_to_the_heap);
+    RUN_TEST(test_screen_rebuilds_do_not_grow_memory);
+    RUN_TEST(test_screens_are_recorded_separately);
+    return UNITY_END();
+}
@@ -0,0 +1,283 @@
+/**
+ * @file test_main.cpp
+ * @brief Native unit tests for the race core (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <fstream>
+#include <vector>
+#include "common/ArduinoCompat.h"
+#include "common/TimeManager.h"
+#include "RaceModule/RaceModule.h"
+#include "RaceModule/RaceJournalFile.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Helpers =====
+
+static void setClock(uint32_t ms) {
+    TimeManager::GetInstance().SetReplayTime(ms);
+}
+
+static void startRace(RaceMode mode, int numLanes, int numLaps) {
+    RaceModule& race = RaceModule::getInstance();
+    race.resetRace();
+    race.prepareRace(mode, numLanes, numLaps, mode == RaceMode::TIMER ? 600 : 0);
+    race.startCountdown();
+    race.startRace();
+}
+
+static ErrorInfo lapAt(int lane, uint32_t ms) {
+    setClock(ms);
+    return RaceModule::getInstance().registerLap(lane);
+}
+
+// Race-level and per-lane state that must survive a journal rebuild unchanged
+static void assertSameRace(const std::vector<RaceLaneData>& expected, RaceState expectedState) {
+    RaceModule& race = RaceModule::getInstance();
+    TEST_ASSERT_EQUAL_INT((int)expectedState, (int)race.getRaceState());
+
+    const std::vector<RaceLaneData>& lanes = race.getAllLaneData();
+    TEST_ASSERT_EQUAL_INT((int)expected.size(), (int)lanes.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        TEST_ASSERT_EQUAL_INT(expected[i].laneId, lanes[i].laneId);
+        TEST_ASSERT_EQUAL_INT(expected[i].currentLap, lanes[i].currentLap);
+        TEST_ASSERT_EQUAL_INT(expected[i].finished, lanes[i].finished);
+        TEST_ASSERT_EQUAL_INT(expected[i].enabled, lanes[i].enabled);
+        TEST_ASSERT_EQUAL_UINT32(expected[i].bestLapTime, lanes[i].bestLapTime);
+        TEST_ASSERT_EQUAL_UINT32(expected[i].lastLapTime, lanes[i].lastLapTime);
+        TEST_ASSERT_EQUAL_UINT32(expected[i].totalTime, lanes[i].totalTime);
+        TEST_ASSERT_EQUAL_UINT32(expected[i].lastLapTimestamp, lanes[i].lastLapTimestamp);
+        TEST_ASSERT_EQUAL_INT(expected[i].position, lanes[i].position);
+    }
+}
+
+// Events the journal still holds after its snapshot, as a storage sink would have seen them
+static std::vector<RaceEvent> eventsSinceSnapshot() {
+    const RaceJournal& journal = RaceModule::getInstance().getJournal();
+    std::vector<RaceEvent> events;
+    RaceEvent event;
+    for (uint32_t seq = journal.getSnapshot().sequence + 1; seq <= journal.getLastSequence(); seq++) {
+        TEST_ASSERT_TRUE(journal.getEvent(seq, event));
+        events.push_back(event);
+    }
+    return events;
+}
+
+void setUp() {
+    setClock(1000);
+    RaceModule::getInstance().initialize();
+    startRace(RaceMode::LAPS, 2, 10);
+}
+
+void tearDown() {}
+
+// ===== Lap filter =====
+
+static void test_filter_rejection_returns_filtered() {
+    TEST_ASSERT_TRUE(lapAt(1, 5000).isSuccess());
+
+    // Bounce inside the glitch window
+    TEST_ASSERT_EQUAL_INT((int)ErrorCode::FILTERED, (int)lapAt(1, 5010).code);
+
+    // Second crossing faster than the minimum lap time
+    TEST_ASSERT_EQUAL_INT((int)ErrorCode::FILTERED, (int)lapAt(1, 5500).code);
+
+    LapFilterStats stats = RaceModule::getInstance().getLapFilterStats(1);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.accepted);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.rejectedGlitch);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.rejectedMinLap);
+    TEST_ASSERT_EQUAL_INT(1, RaceModule::getInstance().getLaneData(1).currentLap);
+}
+
+static void test_remove_lap_rolls_back_min_lap_filter() {
+    RaceModule& race = RaceModule::getInstance();
+    TEST_ASSERT_TRUE(lapAt(1, 5000).isSuccess());
+
+    // A false trigger slips through and is removed by the race official
+    TEST_ASSERT_TRUE(lapAt(1, 6100).isSuccess());
+    TEST_ASSERT_TRUE(race.removeLap(1).isSuccess());
+
+    // The genuine crossing is within the minimum lap time of the removed lap,
+    // but not of the lap before it
+    TEST_ASSERT_TRUE(lapAt(1, 6900).isSuccess());
+    TEST_ASSERT_EQUAL_INT(2, race.getLaneData(1).currentLap);
+    TEST_ASSERT_EQUAL_UINT32(1900, race.getLaneData(1).lastLapTime);
+}
+
+static void test_remove_first_lap_clears_min_lap_filter() {
+    RaceModule& race = RaceModule::getInstance();
+    TEST_ASSERT_TRUE(lapAt(1, 5000).isSuccess());
+    TEST_ASSERT_TRUE(race.removeLap(1).isSuccess());
+
+    // With no lap left the next crossing is only glitch filtered
+    TEST_ASSERT_TRUE(lapAt(1, 5200).isSuccess());
+    TEST_ASSERT_EQUAL_INT(1, race.getLaneData(1).currentLap);
+}
+
+// ===== Lap removal =====
+
+static void test_remove_lap_only_restores_that_lane() {
+    RaceModule& race = RaceModule::getInstance();
+    startRace(RaceMode::LAPS, 2, 2);
+    TEST_ASSERT_TRUE(lapAt(1, 3000).isSuccess());
+    TEST_ASSERT_TRUE(lapAt(2, 4000).isSuccess());
+    TEST_ASSERT_TRUE(lapAt(1, 6000).isSuccess());
+    TEST_ASSERT_TRUE(lapAt(2, 8000).isSuccess());
+    TEST_ASSERT_EQUAL_INT((int)RaceState::Finished, (int)race.getRaceState());
+
+    TEST_ASSERT_TRUE(race.removeLap(1).isSuccess());
+
+    // Lane 2 finished after lane 1's removed lap and must keep its result
+    TEST_ASSERT_FALSE(race.getLaneData(1).finished);
+    TEST_ASSERT_EQUAL_INT(1, race.getLaneData(1).currentLap);
+    TEST_ASSERT_TRUE(race.getLaneData(2).finished);
+    TEST_ASSERT_EQUAL_INT(1, race.getLaneData(2).position);
+    TEST_ASSERT_EQUAL_INT(2, race.getLaneData(1).position);
+    TEST_ASSERT_EQUAL_INT((int)RaceState::Active, (int)race.getRaceState());
+}
+
+static void test_remove_lap_stops_at_snapshot() {
+    RaceModule& race = RaceModule::getInstance();
+    startRace(RaceMode::LAPS, 2, 100);
+    uint32_t t = 1000;
+    for (int i = 0; i < 70; i++) {
+        t += 1500;
+        TEST_ASSERT_TRUE(lapAt(1, t).isSuccess());
+    }
+
+    // update() snapshots the journal once enough events have piled up
+    setClock(t + 200);
+    race.update();
+    TEST_ASSERT_EQUAL_UINT32(0, race.getJournal().getEventsSinceSnapshot());
+
+    // Laps before the snapshot cannot be replayed as removed, so they stay
+    TEST_ASSERT_EQUAL_INT((int)ErrorCode::INVALID_STATE, (int)race.removeLap(1).code);
+
+    std::vector<RaceLaneData> live = race.getAllLaneData();
+    TEST_ASSERT_TRUE(race.rebuildFromJournal().isSuccess());
+    assertSameRace(live, RaceState::Active);
+    TEST_ASSERT_EQUAL_INT(70, race.getLaneData(1).currentLap);
+}
+
+// ===== Journal replay =====
+
+static void test_rebuild_matches_live_state() {
+    RaceModule& race = RaceModule::getInstance();
+    startRace(RaceMode::LAPS, 3, 60);
+    uint32_t t = 1000;
+    for (int i = 0; i < 50; i++) {
+        t += 1500;
+        TEST_ASSERT_TRUE(lapAt(1, t).isSuccess());
+        TEST_ASSERT_TRUE(lapAt(2, t + 300).isSuccess());
+        if (i % 3 == 0 && i < 30) {
+            TEST_ASSERT_TRUE(lapAt(3, t + 700).isSuccess());
+        }
+        if (i % 7 == 6) {
+            TEST_ASSERT_TRUE(race.removeLap(2).isSuccess());
+        }
+        if (i == 20) {
+            setClock(t + 800);
+            TEST_ASSERT_TRUE(race.pauseRace().isSuccess());
+            setClock(t + 1000);
+            TEST_ASSERT_TRUE(race.resumeRace().isSuccess());
+        }
+        if (i == 30) {
+            TEST_ASSERT_TRUE(race.disableLane(3).isSuccess());
+        }
+        setClock(t + 1200);
+        race.update();
+    }
+
+    RaceState state = race.getRaceState();
+    std::vector<RaceLaneData> live = race.getAllLaneData();
+    TEST_ASSERT_TRUE(race.rebuildFromJournal().isSuccess());
+    assertSameRace(live, state);
+}
+
+static void test_replay_fails_on_unmatched_lap_removal() {
+    RaceModule& race = RaceModule::getInstance();
+    RaceSnapshot snapshot = race.getJournal().getSnapshot();
+
+    RaceEvent removal = {};
+    removal.sequence = snapshot.sequence + 1;
+    removal.timestamp = 2000;
+    removal.value = 1;
+    removal.type = RaceEventType::LapRemoved;
+    removal.lane = 1;
+
+    TEST_ASSERT_EQUAL_INT((int)ErrorCode::INVALID_STATE, (int)race.replayJournal(snapshot, &removal, 1).code);
+}
+
+static void test_replay_rebases_to_current_clock() {
+    RaceModule& race = RaceModule::getInstance();
+    TEST_ASSERT_TRUE(race.setRacerName(2, "Alice").isSuccess());
+    race.resetRace();
+    race.prepareRace(RaceMode::LAPS, 2, 10);
+    race.startCountdown();
+    race.startRace();
+    TEST_ASSERT_TRUE(lapAt(1, 5000).isSuccess());
+    TEST_ASSERT_TRUE(lapAt(2, 6000).isSuccess());
+
+    RaceSnapshot snapshot = race.getJournal().getSnapshot();
+    std::vector<RaceEvent> events = eventsSinceSnapshot();
+
+    // After a reboot the clock starts over far below the recorded timestamps
+    setClock(200);
+    TEST_ASSERT_TRUE(race.replayJournal(snapshot, events.data(), events.size()).isSuccess());
+    TEST_ASSERT_EQUAL_UINT32(5000, race.getRaceTimeMs());
+    TEST_ASSERT_EQUAL_STRING("Alice", race.getLaneData(2).racerName.c_str());
+
+    // Lap times carry on as if the race had not been interrupted
+    TEST_ASSERT_TRUE(lapAt(1, 1200).isSuccess());
+    TEST_ASSERT_EQUAL_UINT32(2000, race.getLaneData(1).lastLapTime);
+    TEST_ASSERT_EQUAL_UINT32(6000, race.getLaneData(1).totalTime);
+
+    TEST_ASSERT_TRUE(race.setRacerName(2, "Racer 2").isSuccess());
+}
+
+static void test_journal_file_round_trip() {
+    const char* path = "test_race_journal.rjnl";
+    RaceModule& race = RaceModule::getInstance();
+    RaceJournal& journal = race.getJournal();
+    RaceJournalFile file(path);
+    file.attach(journal);
+
+    startRace(RaceMode::LAPS, 2, 10);
+    setClock(1500);
+    race.update();
+    TEST_ASSERT_TRUE(lapAt(1, 5000).isSuccess());
+    TEST_ASSERT_TRUE(lapAt(2, 6000).isSuccess());
+    setClock(6500);
+    race.update();
+
+    RaceSnapshot snapshot;
+    std::vector<RaceEvent> events;
+    ErrorInfo result = RaceJournalFile::load(path, snapshot, events);
+    journal.setEventSink(nullptr);
+    journal.setSnapshotSink(nullptr);
+    remove(path);
+
+    TEST_ASSERT_TRUE(result.isSuccess());
+    TEST_ASSERT_EQUAL_MEMORY(&journal.getSnapshot(), &snapshot, sizeof(snapshot));
+    std::vector<RaceEvent> expected = eventsSinceSnapshot();
+    TEST_ASSERT_EQUAL_INT((int)expected.size(), (int)events.size());
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), events.data(), expected.size() * sizeof(RaceEvent));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_filter_rejection_returns_filtered);
+    RUN_TEST(test_remove_lap_rolls_back_min_lap_filter);
+    RUN_TEST(test_remove_first_lap_clears_min_lap_filter);
+    RUN_TEST(test_remove_lap_only_restores_that_lane);
+    RUN_TEST(test_remove_lap_stops_at_snapshot);
+    RUN_TEST(test_rebuild_matches_live_state);
+    RUN_TEST(test_replay_fails_on_unmatched_lap_removal);
+    RUN_TEST(test_replay_rebases_to_current_clock);
+    RUN_TEST(test_journal_file_round_trip);
+    return UNITY_END();
+}
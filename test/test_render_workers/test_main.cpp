@@ -0,0 +1,261 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the simulator's per-display render threads (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "common/ArduinoCompat.h"
+#include "DisplayModule/drivers/SimulatorDisplayDriver/ThreadedDisplay.h"
+#include "DisplayModule/DisplayManager.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Fake display =====
+
+/**
+ * Records the calls it gets and the thread they arrive on. Drawing race data
+ * takes drawDelayMs, and while hold is set every call waits for it to clear.
+ */
+class FakeDisplay : public IGraphicalDisplay {
+public:
+    explicit FakeDisplay(uint32_t drawDelayMs = 0) : drawDelayMs(drawDelayMs) {}
+
+    bool initialize() override { record("initialize"); return true; }
+    void update() override { record("update"); }
+    void clear() override { record("clear"); }
+    void print(const String& message, bool newLine = true) override { (void)newLine; record("print " + message); }
+    void printf(const char* format, ...) override { record(format); }
+    DisplayType getDisplayType() const override { return DisplayType::LCD; }
+
+    void setCursor(int, int) override {}
+    void setTextColor(uint32_t) override {}
+    void setTextSize(uint8_t) override {}
+    void drawRect(int, int, int, int, uint32_t) override {}
+    void fillRect(int, int, int, int, uint32_t) override {}
+    void drawCircle(int, int, int, uint32_t) override {}
+    void fillCircle(int, int, int, uint32_t) override {}
+    int getWidth() const override { return 800; }
+    int getHeight() const override { return 480; }
+    void drawMain() override { record("drawMain"); }
+    void drawRaceReady() override { record("drawRaceReady"); }
+    void drawConfig() override { record("drawConfig"); }
+    void drawRaceActive(RaceMode) override { record("drawRaceActive"); }
+    void startLightSequence() override {}
+    void drawStats() override {}
+    void drawPause() override {}
+    void drawStop() override {}
+
+    void updateRaceData(const std::vector<RaceLaneData>& laneData) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(drawDelayMs));
+        record("race " + String(laneData.empty() ? 0 : laneData[0].currentLap));
+    }
+
+    std::vector<String> getCalls() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return calls;
+    }
+
+    std::thread::id lastThread() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return thread;
+    }
+
+    uint32_t drawDelayMs;
+    std::atomic<bool> hold{false};
+    std::atomic<int> started{0};
+
+private:
+    void record(const String& call) {
+        started++;
+        while (hold) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        calls.push_back(call);
+        thread = std::this_thread::get_id();
+    }
+
+    std::mutex mutex;
+    std::vector<String> calls;
+    std::thread::id thread;
+};
+
+// ===== Helpers =====
+
+// One-lane snapshot tagged with its sequence number
+static std::vector<RaceLaneData> snapshot(int sequence) {
+    RaceLaneData lane = RaceLaneData();
+    lane.laneId = 1;
+    lane.enabled = true;
+    lane.currentLap = sequence;
+    return std::vector<RaceLaneData>(1, lane);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_calls_run_on_render_thread() {
+    FakeDisplay fake;
+    ThreadedGraphicalDisplay display(&fake);
+
+    TEST_ASSERT_TRUE(display.initialize());
+    TEST_ASSERT_TRUE(fake.lastThread() != std::this_thread::get_id());
+    TEST_ASSERT_EQUAL_INT(800, display.getWidth());
+    TEST_ASSERT_TRUE(display.getDisplayType() == DisplayType::LCD);
+}
+
+static void test_jobs_keep_their_order() {
+    FakeDisplay fake;
+    ThreadedGraphicalDisplay display(&fake);
+
+    // Park the worker inside the first job while the rest is queued
+    fake.hold = true;
+    display.drawMain();
+    while (fake.started == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    display.drawRaceActive(RaceMode::LAPS);
+    display.updateRaceData(snapshot(1));
+    display.print("done");
+    fake.hold = false;
+    display.getWorker().drain();
+
+    std::vector<String> calls = fake.getCalls();
+    TEST_ASSERT_EQUAL_INT(4, (int)calls.size());
+    TEST_ASSERT_EQUAL_STRING("drawMain", calls[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("drawRaceActive", calls[1].c_str());
+    // Queued calls run before the pending snapshot is drawn
+    TEST_ASSERT_EQUAL_STRING("print done", calls[2].c_str());
+    TEST_ASSERT_EQUAL_STRING("race 1", calls[3].c_str());
+}
+
+static void test_slow_display_does_not_hold_up_others() {
+    const int snapshots = 40;
+    FakeDisplay slow(20);
+    FakeDisplay fast;
+    ThreadedGraphicalDisplay slowDisplay(&slow);
+    ThreadedGraphicalDisplay fastDisplay(&fast);
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 1; i <= snapshots; i++) {
+        slowDisplay.updateRaceData(snapshot(i));
+        fastDisplay.updateRaceData(snapshot(i));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+
+    // Drawing every snapshot on the slow display would take 800 ms
+    TEST_ASSERT_TRUE(elapsed.count() < 400);
+
+    slowDisplay.getWorker().drain();
+    fastDisplay.getWorker().drain();
+
+    RenderWorker& slowWorker = slowDisplay.getWorker();
+    TEST_ASSERT_TRUE(slowWorker.getReplacedSnapshots() > 0);
+    TEST_ASSERT_EQUAL_UINT32(snapshots, slowWorker.getDrawnSnapshots() + slowWorker.getReplacedSnapshots());
+    TEST_ASSERT_TRUE(fastDisplay.getWorker().getDrawnSnapshots() > slowWorker.getDrawnSnapshots());
+
+    // Both end on the newest snapshot
+    TEST_ASSERT_EQUAL_STRING("race 40", slow.getCalls().back().c_str());
+    TEST_ASSERT_EQUAL_STRING("race 40", fast.getCalls().back().c_str());
+}
+
+static void test_full_queue_drops_new_jobs() {
+    FakeDisplay fake;
+    ThreadedGraphicalDisplay display(&fake);
+
+    // Park the worker inside the first job
+    fake.hold = true;
+    display.clear();
+    while (fake.started == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (int i = 0; i < RENDER_WORKER_QUEUE_DEPTH + 5; i++) {
+        display.update();
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, display.getWorker().getDroppedJobs());
+
+    fake.hold = false;
+    display.getWorker().drain();
+    TEST_ASSERT_EQUAL_INT(RENDER_WORKER_QUEUE_DEPTH + 1, (int)fake.getCalls().size());
+}
+
+static void test_text_display_prints_newest_snapshot() {
+    FakeDisplay fake;
+    std::atomic<int> printed{0};
+    ThreadedBaseDisplay display(&fake, [&printed](IBaseDisplay* target, const std::vector<RaceLaneData>& laneData) {
+        target->print("lap " + String(laneData[0].currentLap));
+        printed++;
+    });
+
+    fake.hold = true;
+    display.print("first");
+    while (fake.started == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    for (int i = 1; i <= 5; i++) {
+        display.updateRaceData(snapshot(i));
+    }
+    fake.hold = false;
+    display.getWorker().drain();
+
+    TEST_ASSERT_EQUAL_INT(1, printed.load());
+    TEST_ASSERT_EQUAL_UINT32(4, display.getWorker().getReplacedSnapshots());
+    TEST_ASSERT_EQUAL_STRING("print lap 5", fake.getCalls().back().c_str());
+}
+
+static void test_stop_runs_queued_jobs() {
+    FakeDisplay fake;
+    {
+        ThreadedGraphicalDisplay display(&fake);
+        fake.hold = true;
+        display.drawMain();
+        display.drawConfig();
+        display.drawRaceReady();
+        fake.hold = false;
+    }
+    TEST_ASSERT_EQUAL_INT(3, (int)fake.getCalls().size());
+    TEST_ASSERT_EQUAL_STRING("drawRaceReady", fake.getCalls().back().c_str());
+}
+
+static void test_display_manager_moves_displays_to_threads() {
+    DisplayManager& manager = DisplayManager::getInstance();
+    DisplayType types[] = {DisplayType::Serial};
+    TEST_ASSERT_TRUE(manager.initialize(types, 1));
+
+    TEST_ASSERT_EQUAL_INT(1, manager.enableRenderThreads());
+    // A second call keeps the threads it already has
+    TEST_ASSERT_EQUAL_INT(1, manager.enableRenderThreads());
+
+    manager.updateRaceData(snapshot(1));
+    manager.updateRaceData(snapshot(2));
+    manager.disableRenderThreads();
+
+    // Back on the calling thread
+    manager.updateRaceData(snapshot(3));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_calls_run_on_render_thread);
+    RUN_TEST(test_jobs_keep_their_order);
+    RUN_TEST(test_slow_display_does_not_hold_up_others);
+    RUN_TEST(test_full_queue_drops_new_jobs);
+    RUN_TEST(test_text_display_prints_newest_snapshot);
+    RUN_TEST(test_stop_runs_queued_jobs);
+    RUN_TEST(test_display_manager_moves_displays_to_threads);
+    return UNITY_END();
+}
@@ -0,0 +1,94 @@
+/**
+ * @file test_main.cpp
+ * @brief Replays a recorded input trace through the simulator race path (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <cstring>
+#include <fstream>
+#include "common/ArduinoCompat.h"
+#include "common/TimeManager.h"
+#include "RaceModule/RaceModule.h"
+#include "InputModule/InputManager.h"
+#include "InputModule/InputTrace.h"
+#include "InputModule/ReplayInput.h"
+#include "DisplayModule/DisplayManager.h"
+#include "Sim/SimRaceController.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// Recorded with the simulator: 2 lanes, 3 laps, a filtered bounce on lane 1,
+// a removed false trigger on lane 2 and a 2 s pause
+#define RACE_LAPS_TRACE "test/traces/race_laps.itrc"
+
+static InputTrace trace;
+static InputTrace rerecorded;
+
+// Play the whole trace as fast as possible, the way `--replay <file> --speed max` does
+static void replayTrace(ReplayInput& replay) {
+    replay.start(ReplaySpeed::Maximum, 1);
+    for (size_t i = 0; i <= trace.size() && replay.isRunning(); i++) {
+        SimRaceController::getInstance().update();
+    }
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+static void test_replay_reproduces_race() {
+    ReplayInput replay(trace);
+    InputManager::getInstance().addInputModule(&replay);
+    InputManager::getInstance().setRecorder(&rerecorded);
+
+    replayTrace(replay);
+    InputManager::getInstance().setRecorder(nullptr);
+
+    TEST_ASSERT_FALSE(replay.isRunning());
+    TEST_ASSERT_EQUAL_UINT32(trace.size(), replay.getEventsReplayed());
+    TEST_ASSERT_FALSE(TimeManager::GetInstance().IsReplayActive());
+
+    RaceModule& race = RaceModule::getInstance();
+    const RaceLaneData& lane1 = race.getLaneData(1);
+    const RaceLaneData& lane2 = race.getLaneData(2);
+    // Lap times run from the green light at 5000 ms; the bounce and the removed
+    // trigger leave no trace, and total time excludes the pause
+    TEST_ASSERT_EQUAL_INT((int)RaceState::Idle, (int)race.getRaceState());
+    TEST_ASSERT_EQUAL_INT(3, lane1.currentLap);
+    TEST_ASSERT_TRUE(lane1.finished);
+    TEST_ASSERT_EQUAL_UINT32(4100, lane1.bestLapTime);
+    TEST_ASSERT_EQUAL_UINT32(12600, lane1.totalTime);
+    TEST_ASSERT_EQUAL_INT(1, lane1.position);
+    TEST_ASSERT_EQUAL_INT(3, lane2.currentLap);
+    TEST_ASSERT_TRUE(lane2.finished);
+    TEST_ASSERT_EQUAL_UINT32(4400, lane2.bestLapTime);
+    TEST_ASSERT_EQUAL_UINT32(5900, lane2.lastLapTime);
+    TEST_ASSERT_EQUAL_UINT32(13100, lane2.totalTime);
+    TEST_ASSERT_EQUAL_INT(2, lane2.position);
+}
+
+static void test_rerecorded_trace_matches() {
+    TEST_ASSERT_EQUAL_UINT32(trace.size(), rerecorded.size());
+    for (size_t i = 0; i < trace.size(); i++) {
+        TEST_ASSERT_EQUAL_MEMORY(&trace.at(i), &rerecorded.at(i), sizeof(InputTraceRecord));
+    }
+}
+
+int main() {
+    TimeManager::GetInstance().Initialize();
+    DisplayManager::getInstance().initialize(nullptr, 0);
+    RaceModule::getInstance().initialize();
+    InputManager::getInstance().initialize();
+    if (!trace.loadFromFile(RACE_LAPS_TRACE).isSuccess()) {
+        printf("Cannot load %s; run from the project directory\n", RACE_LAPS_TRACE);
+        return 1;
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_replay_reproduces_race);
+    RUN_TEST(test_rerecorded_trace_matches);
+    return UNITY_END();
+}
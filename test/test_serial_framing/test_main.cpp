@@ -0,0 +1,123 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the framed serial protocol used by SerialBridge (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/ArduinoCompat.h"
+#include "common/SerialFraming.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Helpers =====
+
+struct ReceivedFrame {
+    SerialFrameType type;
+    std::string payload;
+};
+
+static std::vector<ReceivedFrame> received;
+
+static void collect(SerialFrameType type, const uint8_t* payload, size_t length) {
+    received.push_back({type, std::string((const char*)payload, length)});
+}
+
+static void appendText(SerialFrameWriter& writer, const std::string& text) {
+    TEST_ASSERT_TRUE(writer.append(SerialFrameType::Text, (const uint8_t*)text.data(), text.size()));
+}
+
+void setUp() {
+    received.clear();
+}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_batch_is_reassembled_from_any_split() {
+    SerialFrameWriter writer;
+    appendText(writer, "Lane 1 Lap 3");
+    appendText(writer, "");
+    TEST_ASSERT_TRUE(writer.append(SerialFrameType::Command, (const uint8_t*)"s", 1));
+    std::string stream((const char*)writer.data(), writer.size());
+
+    // Every split point, as the bytes may arrive in any chunks
+    for (size_t split = 0; split <= stream.size(); split++) {
+        SerialFrameReader reader;
+        received.clear();
+        reader.feed((const uint8_t*)stream.data(), split, collect);
+        reader.feed((const uint8_t*)stream.data() + split, stream.size() - split, collect);
+
+        TEST_ASSERT_EQUAL_UINT32(3, received.size());
+        TEST_ASSERT_EQUAL_STRING("Lane 1 Lap 3", received[0].payload.c_str());
+        TEST_ASSERT_EQUAL_UINT32(0, received[1].payload.size());
+        TEST_ASSERT_TRUE(received[2].type == SerialFrameType::Command);
+        TEST_ASSERT_EQUAL_UINT32(0, reader.getBytesDiscarded());
+    }
+}
+
+static void test_reader_resyncs_after_noise_and_corruption() {
+    SerialFrameWriter writer;
+    appendText(writer, "first");
+    appendText(writer, "second");
+    appendText(writer, "third");
+    std::string frames((const char*)writer.data(), writer.size());
+
+    // Joining mid-stream, with a sync byte in the noise, and a corrupted second frame
+    std::string stream = "boot log\xA5\x01";
+    size_t secondPayload = SERIAL_FRAME_OVERHEAD + 5 + SERIAL_FRAME_HEADER_BYTES;
+    frames[secondPayload] ^= 0x01;
+    stream += frames;
+
+    SerialFrameReader reader;
+    reader.feed((const uint8_t*)stream.data(), stream.size(), collect);
+
+    TEST_ASSERT_EQUAL_UINT32(2, received.size());
+    TEST_ASSERT_EQUAL_STRING("first", received[0].payload.c_str());
+    TEST_ASSERT_EQUAL_STRING("third", received[1].payload.c_str());
+    TEST_ASSERT_TRUE(reader.getBytesDiscarded() >= 10 + SERIAL_FRAME_OVERHEAD + 6);
+}
+
+static void test_oversized_payload_is_refused() {
+    SerialFrameWriter writer;
+    std::string big(SERIAL_FRAME_MAX_PAYLOAD + 1, 'x');
+    TEST_ASSERT_FALSE(writer.append(SerialFrameType::Text, (const uint8_t*)big.data(), big.size()));
+    TEST_ASSERT_TRUE(writer.empty());
+
+    big.resize(SERIAL_FRAME_MAX_PAYLOAD);
+    appendText(writer, big);
+    SerialFrameReader reader;
+    reader.feed(writer.data(), writer.size(), collect);
+    TEST_ASSERT_EQUAL_UINT32(1, received.size());
+    TEST_ASSERT_EQUAL_UINT32(SERIAL_FRAME_MAX_PAYLOAD, received[0].payload.size());
+}
+
+static void test_writer_keeps_capacity_between_batches() {
+    SerialFrameWriter writer;
+    SerialFrameWriter inFlight;
+    appendText(writer, "warm up the buffer");
+    writer.swap(inFlight);
+    TEST_ASSERT_TRUE(writer.empty());
+    const uint8_t* buffer = inFlight.data();
+
+    // The drained batch goes back to the writer and is reused
+    inFlight.clear();
+    inFlight.swap(writer);
+    appendText(writer, "next");
+    TEST_ASSERT_TRUE(writer.data() == buffer);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_batch_is_reassembled_from_any_split);
+    RUN_TEST(test_reader_resyncs_after_noise_and_corruption);
+    RUN_TEST(test_oversized_payload_is_refused);
+    RUN_TEST(test_writer_keeps_capacity_between_batches);
+    return UNITY_END();
+}
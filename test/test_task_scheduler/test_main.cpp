@@ -0,0 +1,227 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the main loop TaskScheduler (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <fstream>
+#include <string>
+#include "common/ArduinoCompat.h"
+#include "common/TaskScheduler.h"
+#include "common/TimeManager.h"
+#include "Sim/SimRaceController.h"
+#include "InputModule/InputManager.h"
+#include "RaceModule/RaceModule.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// Task names in the order they ran
+static std::string g_runs;
+
+static TaskFunction record(const char* name) {
+    return [name]() {
+        g_runs += name;
+        g_runs += ' ';
+    };
+}
+
+void setUp() {
+    g_runs.clear();
+}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_due_tasks_run_by_priority() {
+    TaskScheduler scheduler;
+    scheduler.addPeriodicTask("display", TaskPriority::Display, 16, record("display"));
+    scheduler.addPeriodicTask("race", TaskPriority::Race, 100, record("race"));
+    scheduler.addPeriodicTask("input", TaskPriority::Input, 5, record("input"));
+    scheduler.addPeriodicTask("lights", TaskPriority::Race, 10, record("lights"));
+
+    // Every task is due on the first pass; equal priorities keep their registration order
+    TEST_ASSERT_EQUAL_UINT32(5, scheduler.runDue(1000));
+    TEST_ASSERT_EQUAL_STRING("input race lights display ", g_runs.c_str());
+
+    g_runs.clear();
+    TEST_ASSERT_EQUAL_UINT32(5, scheduler.runDue(1005));
+    TEST_ASSERT_EQUAL_STRING("input ", g_runs.c_str());
+
+    g_runs.clear();
+    TEST_ASSERT_EQUAL_UINT32(4, scheduler.runDue(1016));
+    TEST_ASSERT_EQUAL_STRING("input lights display ", g_runs.c_str());
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.findTaskStats("input")->runs);
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler.findTaskStats("race")->runs);
+    TEST_ASSERT_NULL(scheduler.findTaskStats("sensor"));
+}
+
+static void test_periodic_task_skips_missed_runs() {
+    TaskScheduler scheduler;
+    TaskScheduler::TaskId id = scheduler.addPeriodicTask("race", TaskPriority::Race, 100, record("race"));
+
+    scheduler.runDue(0);
+    TEST_ASSERT_EQUAL_UINT32(40, scheduler.getTimeUntilNextMs(60));
+    TEST_ASSERT_EQUAL_UINT32(40, scheduler.runDue(60));
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler.getTaskStats(id).runs);
+
+    // Late by 3 ms: the cadence holds
+    TEST_ASSERT_EQUAL_UINT32(97, scheduler.runDue(103));
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.getTaskStats(id).maxLateMs);
+
+    // Three periods missed: one run, then a full period
+    TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue(450));
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.getTaskStats(id).runs);
+    TEST_ASSERT_EQUAL_UINT32(250, scheduler.getTaskStats(id).maxLateMs);
+
+    // The clock going back (a replay handing time back) does not stall the task
+    TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue(20));
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.getTaskStats(id).runs);
+    scheduler.runDue(120);
+    TEST_ASSERT_EQUAL_UINT32(4, scheduler.getTaskStats(id).runs);
+
+    // Deadlines carry on across the 32-bit wrap
+    TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue(UINT32_MAX - 10));
+    TEST_ASSERT_EQUAL_UINT32(10, scheduler.runDue(79));
+    TEST_ASSERT_EQUAL_UINT32(4, scheduler.getTaskStats(id).runs);
+    scheduler.runDue(89);
+    TEST_ASSERT_EQUAL_UINT32(5, scheduler.getTaskStats(id).runs);
+}
+
+static void test_event_tasks_run_when_notified() {
+    TaskScheduler scheduler;
+    TaskScheduler::TaskId display = scheduler.addEventTask("display", TaskPriority::Display, record("display"));
+    TaskScheduler::TaskId input = scheduler.addEventTask("input", TaskPriority::Input, [&]() {
+        g_runs += "input ";
+        scheduler.notify(display);
+    });
+
+    // Nothing periodic: the caller comes back after the longest sleep
+    TEST_ASSERT_EQUAL_UINT32(TASK_SCHEDULER_MAX_SLEEP_MS, scheduler.runDue(0));
+    TEST_ASSERT_EQUAL_STRING("", g_runs.c_str());
+
+    // Notifies coalesce, and a lower priority notified during the pass runs in it
+    scheduler.notify(input);
+    scheduler.notify(input);
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler.getTimeUntilNextMs(0));
+    TEST_ASSERT_EQUAL_UINT32(TASK_SCHEDULER_MAX_SLEEP_MS, scheduler.runDue(1));
+    TEST_ASSERT_EQUAL_STRING("input display ", g_runs.c_str());
+
+    // A higher priority notified during the pass waits for the next one
+    g_runs.clear();
+    TaskScheduler::TaskId race = scheduler.addEventTask("race", TaskPriority::Race, [&]() {
+        g_runs += "race ";
+        scheduler.notify(input);
+    });
+    scheduler.notify(race);
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler.runDue(2));
+    TEST_ASSERT_EQUAL_STRING("race ", g_runs.c_str());
+    scheduler.runDue(2);
+    TEST_ASSERT_EQUAL_STRING("race input display ", g_runs.c_str());
+
+    // Invalid ids are ignored
+    scheduler.notify(-1);
+    scheduler.notify(TASK_SCHEDULER_MAX_TASKS);
+    TEST_ASSERT_EQUAL_UINT32(TASK_SCHEDULER_MAX_SLEEP_MS, scheduler.getTimeUntilNextMs(3));
+}
+
+static void test_interval_changes_and_notified_periodic_tasks() {
+    TaskScheduler scheduler;
+    TaskScheduler::TaskId id = scheduler.addPeriodicTask("input", TaskPriority::Input, 5, record("input"));
+    scheduler.runDue(0);
+
+    // Notified early, the task runs without moving its deadline
+    scheduler.notify(id);
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.runDue(2));
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler.getTaskStats(id).runs);
+
+    // Interval 0: only notifies run it
+    scheduler.setInterval(id, 0);
+    TEST_ASSERT_EQUAL_UINT32(TASK_SCHEDULER_MAX_SLEEP_MS, scheduler.runDue(50));
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler.getTaskStats(id).runs);
+    scheduler.notify(id);
+    scheduler.runDue(51);
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.getTaskStats(id).runs);
+
+    // Back to periodic: due right away
+    scheduler.setInterval(id, 20);
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler.getTimeUntilNextMs(52));
+    TEST_ASSERT_EQUAL_UINT32(20, scheduler.runDue(52));
+    TEST_ASSERT_EQUAL_UINT32(4, scheduler.getTaskStats(id).runs);
+}
+
+static void test_run_time_is_measured() {
+    TaskScheduler scheduler;
+    TaskScheduler::TaskId id = scheduler.addPeriodicTask("slow", TaskPriority::Race, 10, []() {
+        delayMicroseconds(2000);
+    });
+    scheduler.runDue(0);
+    scheduler.runDue(10);
+
+    const TaskStats& stats = scheduler.getTaskStats(id);
+    TEST_ASSERT_EQUAL_STRING("slow", stats.name);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.runs);
+    TEST_ASSERT_TRUE(stats.maxUs >= 2000);
+    TEST_ASSERT_TRUE(stats.totalUs >= 4000);
+    TEST_ASSERT_TRUE(stats.totalUs >= stats.maxUs);
+
+    scheduler.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats.runs);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.maxUs);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.intervalMs);
+}
+
+static void test_full_scheduler_rejects_tasks() {
+    TaskScheduler scheduler;
+    for (int i = 0; i < TASK_SCHEDULER_MAX_TASKS; i++) {
+        TEST_ASSERT_EQUAL_INT(i, scheduler.addEventTask("task", TaskPriority::Display, record("task")));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, scheduler.addEventTask("extra", TaskPriority::Input, record("extra")));
+    TEST_ASSERT_EQUAL_INT(-1, TaskScheduler().addEventTask("empty", TaskPriority::Input, TaskFunction()));
+    TEST_ASSERT_EQUAL_INT(TASK_SCHEDULER_MAX_TASKS, scheduler.getTaskCount());
+}
+
+static void test_sim_controller_runs_race_and_display_tasks() {
+    TimeManager::GetInstance().SetReplayTime(5000);
+    RaceModule::getInstance().initialize();
+    InputManager::getInstance().initialize();
+    SimRaceController& controller = SimRaceController::getInstance();
+    const TaskScheduler& raceTasks = controller.getRaceScheduler();
+    const TaskScheduler& displayTasks = controller.getDisplayScheduler();
+
+    // Until the first pass every task is due; afterwards the input task is next
+    controller.update();
+    TEST_ASSERT_EQUAL_UINT32(1, raceTasks.findTaskStats("race")->runs);
+    TEST_ASSERT_EQUAL_UINT32(1, raceTasks.findTaskStats("publish")->runs);
+    TEST_ASSERT_EQUAL_UINT32(1, displayTasks.findTaskStats("display")->runs);
+    TEST_ASSERT_EQUAL_UINT32(INPUT_POLL_INTERVAL_MS, controller.update());
+
+    // Without polling, the loop sleeps until the display frame
+    controller.setInputPollInterval(0);
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_UPDATE_INTERVAL_MS, controller.update());
+    controller.notifyInput();
+    uint32_t inputRuns = raceTasks.findTaskStats("input")->runs;
+    controller.update();
+    TEST_ASSERT_EQUAL_UINT32(inputRuns + 1, raceTasks.findTaskStats("input")->runs);
+
+    TimeManager::GetInstance().SetReplayTime(5000 + RACE_UPDATE_INTERVAL_MS);
+    controller.update();
+    TEST_ASSERT_EQUAL_UINT32(2, raceTasks.findTaskStats("race")->runs);
+    controller.setInputPollInterval(INPUT_POLL_INTERVAL_MS);
+    TimeManager::GetInstance().ClearReplayTime();
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_due_tasks_run_by_priority);
+    RUN_TEST(test_periodic_task_skips_missed_runs);
+    RUN_TEST(test_event_tasks_run_when_notified);
+    RUN_TEST(test_interval_changes_and_notified_periodic_tasks);
+    RUN_TEST(test_run_time_is_measured);
+    RUN_TEST(test_full_scheduler_rejects_tasks);
+    RUN_TEST(test_sim_controller_runs_race_and_display_tasks);
+    return UNITY_END();
+}
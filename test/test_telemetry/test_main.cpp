@@ -0,0 +1,169 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the binary race telemetry encoder and decoder (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/ArduinoCompat.h"
+#include "common/TimeManager.h"
+#include "common/TelemetryProtocol.h"
+#include "RaceModule/RaceModule.h"
+#include "DisplayModule/DisplayManager.h"
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Helpers =====
+
+static std::vector<TelemetryLaneState> laneStates;
+static std::vector<TelemetryLap> laps;
+
+static void attach(TelemetryDecoder& decoder) {
+    laneStates.clear();
+    laps.clear();
+    decoder.setLaneStateHandler([](const TelemetryLaneState& state) { laneStates.push_back(state); });
+    decoder.setLapHandler([](const TelemetryLap& lap) { laps.push_back(lap); });
+}
+
+static TelemetryLaneState sampleState() {
+    TelemetryLaneState state = TelemetryLaneState();
+    state.raceTimeMs = 65432;
+    state.raceState = 3;
+    state.laneCount = 2;
+    state.lanes[0] = {1, TELEMETRY_LANE_ENABLED, 2, 4, 10, 4210, 4100, 17000};
+    state.lanes[1] = {2, TELEMETRY_LANE_ENABLED | TELEMETRY_LANE_FINISHED, 1, 10, 10, 0, 256, 0x01000000};
+    return state;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_crc_matches_check_value() {
+    const char* check = "123456789";
+    TEST_ASSERT_EQUAL_UINT32(0x29B1, TelemetryEncoder::crc16((const uint8_t*)check, strlen(check)));
+}
+
+static void test_cobs_round_trip() {
+    uint8_t data[300];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i < 10 ? 0 : i);    // Zeros, then a run longer than one COBS block
+    }
+    uint8_t encoded[320];
+    size_t encodedLength = TelemetryEncoder::cobsEncode(data, sizeof(data), encoded);
+    TEST_ASSERT_TRUE(memchr(encoded, 0, encodedLength) == nullptr);
+
+    uint8_t decoded[320];
+    TEST_ASSERT_EQUAL_UINT32(sizeof(data), TelemetryEncoder::cobsDecode(encoded, encodedLength, decoded));
+    TEST_ASSERT_EQUAL_MEMORY(data, decoded, sizeof(data));
+}
+
+static void test_frames_decode_when_fed_byte_by_byte() {
+    TelemetryEncoder encoder;
+    TelemetryDecoder decoder;
+    attach(decoder);
+
+    uint8_t frame[TELEMETRY_MAX_FRAME_BYTES];
+    size_t length = encoder.encodeLaneState(sampleState(), frame);
+    for (size_t i = 0; i < length; i++) {
+        decoder.feed(frame + i, 1);
+    }
+    TelemetryLap lap = {3, 7, 3999, 123456};
+    length = encoder.encodeLap(lap, frame);
+    decoder.feed(frame, length);
+
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.getFramesDecoded());
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.getFramesRejected());
+    TEST_ASSERT_EQUAL_UINT32(1, laneStates.size());
+    const TelemetryLaneState& state = laneStates[0];
+    TEST_ASSERT_EQUAL_UINT32(65432, state.raceTimeMs);
+    TEST_ASSERT_EQUAL_UINT32(2, state.laneCount);
+    TEST_ASSERT_EQUAL_UINT32(4210, state.lanes[0].lastLapTime);
+    TEST_ASSERT_EQUAL_UINT32(TELEMETRY_LANE_ENABLED | TELEMETRY_LANE_FINISHED, state.lanes[1].flags);
+    TEST_ASSERT_EQUAL_UINT32(0x01000000, state.lanes[1].totalTime);
+
+    TEST_ASSERT_EQUAL_UINT32(1, laps.size());
+    TEST_ASSERT_EQUAL_UINT32(3, laps[0].laneId);
+    TEST_ASSERT_EQUAL_UINT32(7, laps[0].lap);
+    TEST_ASSERT_EQUAL_UINT32(3999, laps[0].lapTime);
+    TEST_ASSERT_EQUAL_UINT32(123456, laps[0].timestamp);
+}
+
+static void test_decoder_skips_text_and_counts_lost_frames() {
+    TelemetryEncoder encoder;
+    TelemetryDecoder decoder;
+    attach(decoder);
+    TelemetryLap lap = {1, 1, 4000, 5000};
+    uint8_t frame[TELEMETRY_MAX_FRAME_BYTES];
+
+    // Log text in front of a frame, as on a shared serial line
+    std::string stream = "LC: Lane 1 Lap 1\r\n";
+    stream.append((const char*)frame, encoder.encodeLap(lap, frame));
+
+    // A frame lost on the way, then one corrupted
+    encoder.encodeLap(lap, frame);
+    size_t length = encoder.encodeLap(lap, frame);
+    frame[length / 2] ^= frame[length / 2] == 0x40 ? 0x20 : 0x40;
+    stream.append((const char*)frame, length);
+
+    stream.append((const char*)frame, encoder.encodeLap(lap, frame));
+    decoder.feed((const uint8_t*)stream.data(), stream.size());
+
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.getFramesDecoded());
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.getFramesRejected());
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.getFramesLost());
+    TEST_ASSERT_EQUAL_UINT32(2, laps.size());
+}
+
+static void test_display_manager_sends_lane_state_and_laps() {
+    TimeManager::GetInstance().SetReplayTime(1000);
+    DisplayManager& display = DisplayManager::getInstance();
+    RaceModule& race = RaceModule::getInstance();
+    race.prepareRace(RaceMode::LAPS, 2, 5, 0);
+    race.startCountdown();
+    race.startRace();
+
+    TelemetryDecoder decoder;
+    attach(decoder);
+    display.setTelemetrySink([&decoder](const uint8_t* frame, size_t length) { decoder.feed(frame, length); });
+
+    TimeManager::GetInstance().SetReplayTime(5000);
+    TEST_ASSERT_TRUE(race.registerLap(2).isSuccess());
+    display.sendLapTelemetry(2);
+    display.flushRaceData();
+    display.setTelemetrySink(nullptr);
+
+    TEST_ASSERT_EQUAL_UINT32(1, laps.size());
+    TEST_ASSERT_EQUAL_UINT32(2, laps[0].laneId);
+    TEST_ASSERT_EQUAL_UINT32(1, laps[0].lap);
+    TEST_ASSERT_EQUAL_UINT32(race.getLaneData(2).lastLapTime, laps[0].lapTime);
+
+    TEST_ASSERT_EQUAL_UINT32(1, laneStates.size());
+    TEST_ASSERT_EQUAL_UINT32(2, laneStates[0].laneCount);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)RaceState::Active, laneStates[0].raceState);
+    TEST_ASSERT_EQUAL_UINT32(2, laneStates[0].lanes[1].laneId);
+    TEST_ASSERT_EQUAL_UINT32(1, laneStates[0].lanes[1].currentLap);
+    TEST_ASSERT_EQUAL_UINT32(laps[0].lapTime, laneStates[0].lanes[1].lastLapTime);
+}
+
+int main() {
+    TimeManager::GetInstance().Initialize();
+    DisplayManager::getInstance().initialize(nullptr, 0);
+    RaceModule::getInstance().initialize();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_crc_matches_check_value);
+    RUN_TEST(test_cobs_round_trip);
+    RUN_TEST(test_frames_decode_when_fed_byte_by_byte);
+    RUN_TEST(test_decoder_skips_text_and_counts_lost_frames);
+    RUN_TEST(test_display_manager_sends_lane_state_and_laps);
+    return UNITY_END();
+}
@@ -0,0 +1,287 @@
+/**
+ * @file test_main.cpp
+ * @brief Native tests for the web display: delta encoding, backpressure and a localhost client (env:test)
+ *
+ * Run with: pio test -e test
+ */
+#include <unity.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "common/ArduinoCompat.h"
+#include "DisplayModule/WebDisplay.h"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+// Globals normally defined by main.cpp
+TerminalSerial Serial;
+std::ofstream logFile;
+
+// ===== Helpers =====
+
+static RaceLaneData lane(int id, int lap, uint32_t lastLapTime) {
+    RaceLaneData data = RaceLaneData();
+    data.laneId = id;
+    data.enabled = true;
+    data.currentLap = lap;
+    data.totalLaps = 10;
+    data.lastLapTime = lastLapTime;
+    data.position = id;
+    return data;
+}
+
+// Blocking test client with a short receive timeout
+class TestClient {
+public:
+    explicit TestClient(uint16_t port) {
+        _socket = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        _connected = connect(_socket, (struct sockaddr*)&address, sizeof(address)) == 0;
+#ifdef _WIN32
+        DWORD timeout = 20;
+        setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&timeout, sizeof(timeout));
+#else
+        struct timeval timeout = {0, 20000};
+        setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#endif
+    }
+
+    ~TestClient() {
+#ifdef _WIN32
+        closesocket(_socket);
+#else
+        close(_socket);
+#endif
+    }
+
+    bool connected() const { return _connected; }
+
+    void sendText(const std::string& text) {
+        send(_socket, text.data(), (int)text.size(), 0);
+    }
+
+    // Pump the server until the received data contains marker
+    bool receiveUntil(WebDisplay& display, const std::string& marker) {
+        for (int i = 0; i < 50; i++) {
+            pump(display);
+            if (_received.find(marker) != std::string::npos) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Read the next unmasked server frame's payload out of the received data
+    bool nextFrame(WebDisplay& display, std::string& payload) {
+        for (int i = 0; i < 50; i++) {
+            if (_received.size() >= 2) {
+                size_t length = (uint8_t)_received[1] & 0x7F;
+                size_t offset = 2;
+                if (length == 126) {
+                    length = _received.size() >= 4
+                        ? ((size_t)(uint8_t)_received[2] << 8) | (uint8_t)_received[3]
+                        : SIZE_MAX;
+                    offset = 4;
+                }
+                if (length != SIZE_MAX && _received.size() >= offset + length) {
+                    payload = _received.substr(offset, length);
+                    _received.erase(0, offset + length);
+                    return true;
+                }
+            }
+            pump(display);
+        }
+        return false;
+    }
+
+    // Consume the HTTP response in front of the frames
+    bool finishHandshake(WebDisplay& display) {
+        if (!receiveUntil(display, "\r\n\r\n")) {
+            return false;
+        }
+        size_t end = _received.find("\r\n\r\n");
+        _response = _received.substr(0, end + 4);
+        _received.erase(0, end + 4);
+        return true;
+    }
+
+    const std::string& response() const { return _response; }
+    const std::string& received() const { return _received; }
+
+private:
+    // Let the server run once, then take whatever arrived within the timeout
+    void pump(WebDisplay& display) {
+        display.update();
+        char buffer[4096];
+        int received = recv(_socket, buffer, sizeof(buffer), 0);
+        if (received > 0) {
+            _received.append(buffer, received);
+        }
+    }
+
+#ifdef _WIN32
+    SOCKET _socket;
+#else
+    int _socket;
+#endif
+    bool _connected;
+    std::string _received;
+    std::string _response;
+};
+
+static const char UPGRADE_REQUEST[] =
+    "GET /ws HTTP/1.1\r\n"
+    "Host: localhost\r\n"
+    "Upgrade: websocket\r\n"
+    "Connection: Upgrade\r\n"
+    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+    "Sec-WebSocket-Version: 13\r\n\r\n";
+
+void setUp() {}
+
+void tearDown() {}
+
+// ===== Tests =====
+
+static void test_accept_key_matches_rfc_example() {
+    TEST_ASSERT_EQUAL_STRING("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=",
+                             WebSocketProtocol::acceptKey("dGhlIHNhbXBsZSBub25jZQ==").c_str());
+}
+
+static void test_feed_sends_only_changed_fields() {
+    WebRaceFeed feed;
+    std::vector<RaceLaneData> lanes = {lane(1, 0, 0), lane(2, 0, 0)};
+    std::string message;
+
+    TEST_ASSERT_TRUE(feed.encodeUpdate(lanes, message));
+    TEST_ASSERT_EQUAL_STRING("{\"type\":\"full\",\"lanes\":["
+                             "{\"id\":1,\"name\":\"\",\"on\":true,\"fin\":false,\"lap\":0,\"laps\":10,\"pos\":1,\"last\":0,\"best\":0,\"total\":0},"
+                             "{\"id\":2,\"name\":\"\",\"on\":true,\"fin\":false,\"lap\":0,\"laps\":10,\"pos\":2,\"last\":0,\"best\":0,\"total\":0}]}",
+                             message.c_str());
+
+    TEST_ASSERT_FALSE(feed.encodeUpdate(lanes, message));
+
+    lanes[1].currentLap = 1;
+    lanes[1].lastLapTime = 4211;
+    TEST_ASSERT_TRUE(feed.encodeUpdate(lanes, message));
+    TEST_ASSERT_EQUAL_STRING("{\"type\":\"delta\",\"lanes\":[{\"id\":2,\"lap\":1,\"last\":4211}]}", message.c_str());
+
+    // A lane more: everyone starts over from a full message
+    lanes.push_back(lane(3, 0, 0));
+    TEST_ASSERT_TRUE(feed.encodeUpdate(lanes, message));
+    TEST_ASSERT_EQUAL_STRING("{\"type\":\"full\"", message.substr(0, 14).c_str());
+}
+
+static void test_send_queue_drops_waiting_frames_when_full() {
+    WebSendQueue queue(100);
+    TEST_ASSERT_TRUE(queue.push(std::string(40, 'a')));
+    TEST_ASSERT_TRUE(queue.push(std::string(40, 'b')));
+
+    // Half of the first frame is on the wire
+    queue.consume(20);
+    TEST_ASSERT_FALSE(queue.push(std::string(41, 'c')));
+    TEST_ASSERT_TRUE(queue.needsResync());
+    TEST_ASSERT_EQUAL_UINT32(2, queue.getDroppedFrames());
+
+    // Only the rest of the partly sent frame is left
+    size_t length;
+    const char* data = queue.front(length);
+    TEST_ASSERT_EQUAL_UINT32(20, length);
+    TEST_ASSERT_TRUE(data[0] == 'a');
+    queue.consume(length);
+    TEST_ASSERT_TRUE(queue.empty());
+
+    // An empty queue takes a frame of any size
+    TEST_ASSERT_TRUE(queue.push(std::string(500, 'f')));
+}
+
+static void test_serves_race_page() {
+    WebDisplay display(0);
+    TEST_ASSERT_TRUE(display.initialize());
+    TEST_ASSERT_TRUE(display.getPort() != 0);
+
+    TestClient client(display.getPort());
+    TEST_ASSERT_TRUE(client.connected());
+    client.sendText("GET / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    TEST_ASSERT_TRUE(client.receiveUntil(display, "</html>"));
+    TEST_ASSERT_EQUAL_STRING("HTTP/1.1 200 OK", client.received().substr(0, 15).c_str());
+}
+
+static void test_websocket_receives_full_state_then_deltas() {
+    WebDisplay display(0);
+    TEST_ASSERT_TRUE(display.initialize());
+    std::vector<RaceLaneData> lanes = {lane(1, 0, 0), lane(2, 0, 0)};
+    display.updateRaceData(lanes);
+
+    TestClient client(display.getPort());
+    client.sendText(UPGRADE_REQUEST);
+    TEST_ASSERT_TRUE(client.finishHandshake(display));
+    TEST_ASSERT_TRUE(client.response().find("101 Switching Protocols") != std::string::npos);
+    TEST_ASSERT_TRUE(client.response().find("Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=") != std::string::npos);
+
+    std::string payload;
+    TEST_ASSERT_TRUE(client.nextFrame(display, payload));
+    TEST_ASSERT_EQUAL_STRING("{\"type\":\"full\"", payload.substr(0, 14).c_str());
+
+    lanes[0].currentLap = 1;
+    lanes[0].lastLapTime = 3900;
+    display.updateRaceData(lanes);
+    TEST_ASSERT_TRUE(client.nextFrame(display, payload));
+    TEST_ASSERT_EQUAL_STRING("{\"type\":\"delta\",\"lanes\":[{\"id\":1,\"lap\":1,\"last\":3900}]}", payload.c_str());
+    TEST_ASSERT_EQUAL_INT(1, display.getClientCount());
+}
+
+static void test_client_that_falls_behind_gets_full_state() {
+    WebDisplay display(0);
+    TEST_ASSERT_TRUE(display.initialize());
+    std::vector<RaceLaneData> lanes = {lane(1, 0, 0)};
+    display.updateRaceData(lanes);
+
+    TestClient client(display.getPort());
+    client.sendText(UPGRADE_REQUEST);
+    TEST_ASSERT_TRUE(client.finishHandshake(display));
+    std::string payload;
+    TEST_ASSERT_TRUE(client.nextFrame(display, payload));
+
+    // Far more deltas than the queue holds, without letting the server send
+    for (int lap = 1; lap <= 1000; lap++) {
+        lanes[0].currentLap = lap;
+        lanes[0].lastLapTime = 1000 + lap;
+        display.updateRaceData(lanes);
+    }
+
+    // The client catches up through one full message with the newest state
+    std::string last;
+    while (client.nextFrame(display, payload)) {
+        last = payload;
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, display.getResyncCount());
+    TEST_ASSERT_EQUAL_STRING("{\"type\":\"full\"", last.substr(0, 14).c_str());
+    TEST_ASSERT_TRUE(last.find("\"lap\":1000") != std::string::npos);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_accept_key_matches_rfc_example);
+    RUN_TEST(test_feed_sends_only_changed_fields);
+    RUN_TEST(test_send_queue_drops_waiting_frames_when_full);
+    RUN_TEST(test_serves_race_page);
+    RUN_TEST(test_websocket_receives_full_state_then_deltas);
+    RUN_TEST(test_client_that_falls_behind_gets_full_state);
+    return UNITY_END();
+}